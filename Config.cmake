@@ -18,4 +18,47 @@ set(LINKER_SCRIPT_PATH "${CMAKE_SOURCE_DIR}/Core/linker/STM32F407ZGTX_FLASH.ld")
 set(HSE_VALUE 8000000 CACHE STRING "外部晶振频率，常见 8000000 或 25000000")
 
 # 强制把 HSE_VALUE 塞进编译宏（这一行必须有！）
-add_compile_definitions(HSE_VALUE=${HSE_VALUE})
\ No newline at end of file
+add_compile_definitions(HSE_VALUE=${HSE_VALUE})
+
+# 图片资源格式：ON = 构建时转换为原生 16 位 RGB565 (16 位 SPI DMA，DMA 请求数减半)
+#              OFF = 直接使用取模软件导出的大端字节流 (8 位 SPI DMA)
+option(LCD_IMAGE_NATIVE16 "图片数组在构建时转换为原生 16 位 RGB565" ON)
+
+# 大号 ASCII 字库 (30x60 时钟数字、16x32)：ON = 构建时压缩为包围盒 + 行程编码，逐行解码上屏
+#                                      OFF = 直接使用取模软件导出的位图
+option(LCD_FONT_RLE "大号 ASCII 字库在构建时压缩为包围盒 + 行程编码" ON)
+
+# 汉字字库裁剪：ON = 构建时按源码字符串、Resources/Font/font_vocab.txt 与城市库重新生成 hzk16/hzk_week_20，
+#                    只收录用到的字；手工字库中没有的字用下面的 TrueType 字体渲染 (需要 Pillow)
+#               OFF = 直接使用手工维护的字库 (缺字运行时显示红色占位块)
+option(LCD_FONT_SUBSET "汉字字库在构建时按固件用到的字裁剪" OFF)
+set(LCD_FONT_TTF_16 "" CACHE FILEPATH "渲染 16 点阵缺字的字体 (宋体，如 C:/Windows/Fonts/simsun.ttc)")
+set(LCD_FONT_TTF_20 "" CACHE FILEPATH "渲染 20 点阵缺字的字体 (华文中宋，如 C:/Windows/Fonts/STZHONGS.TTF)")
+
+# 抗锯齿字库：ON = 构建时从位图生成 4-bpp 灰度字模 (30x60 时钟数字、20 点阵日期/城市名)，
+#                  按 (前景色, 背景色) 查表混色，Flash 约为位图的 4 倍
+#             OFF = 1-bpp 位图
+option(LCD_FONT_AA "时钟与 20 点阵字体使用 4-bpp 灰度 (抗锯齿) 字模" OFF)
+
+# 外部字库：ON = 片内字库缺字时到 W25Qxx (SPI1，片选 PB14) 中的 GBK 字库查找，结果缓存在 RAM
+#               (镜像由 Utils/font_ext_image.py 生成，用编程器写到 Flash 0 地址)
+#          OFF = 只用片内字库
+option(LCD_FONT_EXT "缺字时从外部 SPI Flash 的 GBK 字库读取" OFF)
+
+# 8 位调色板影子帧缓冲：ON = 全屏绘制先写 76.8K 索引缓冲，按脏行查表上屏 (占用大量 SRAM)
+option(ST7789_FB8 "启用 240x320 8 位调色板影子帧缓冲" OFF)
+
+# 像素转换内核自检：ON = 启动时把 DSP 指令优化的字模展开/字节序交换/RGB888 转换与参考实现逐像素对比，
+#                       并用 DWT 周期计数器计时，结果打印到调试串口
+option(ST7789_PIX_BENCH "启动时对比并测量像素转换内核" OFF)
+
+# 屏幕传输层：SPI  = SPI2 + DMA1 (默认接法，约 2.6MB/s)
+#            FSMC = 8080 16 位并口 + DMA2 存储器到存储器 (需按 st7789.h 中的 FSMC 引脚接线)
+set(ST7789_BUS "SPI" CACHE STRING "屏幕传输层：SPI 或 FSMC")
+set_property(CACHE ST7789_BUS PROPERTY STRINGS SPI FSMC)
+
+# CCM (64K) 分配：瓦片层副本 = 15 x 行数 x 512 字节，剩余部分全部给字模缓存
+#   8 = 瓦片覆盖 y 0~127 (状态栏 + 时间区)，占 60K，字模缓存 4K (默认)
+#   2 = 瓦片只覆盖状态栏 y 0~31，占 15K，字模缓存 49K (时钟数字全部缓存，时间区不再合成)
+set(ST7789_TILE_ROWS "8" CACHE STRING "瓦片层行数 (每行 16 像素)：8 或 2")
+set_property(CACHE ST7789_TILE_ROWS PROPERTY STRINGS 8 2)
@@ -18,6 +18,7 @@
 #define UI_SCREEN_W 240
 #define UI_SCREEN_H 320
 #define UI_GAP 5 // 模块间距
+#define UI_SPLASH_MS 2000 // 开机画面停留时长 (ms)，期间主循环照常运行
 
 /* ==================================================================
  * 2. 模块坐标定义 (Layout Coordinates)
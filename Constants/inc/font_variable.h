@@ -16,46 +16,90 @@
  * ================================================================== */
 
 /**
- * @brief 16点阵汉字结构体
- * @note  用于存储单个汉字的索引和点阵数据
+ * @brief 字符区间 (码点连续的一段字模)
+ * @note  字体只需收录用到的字符，如时钟字体只有 '-' 与 '0'~':' 两段；
+ *        查找时在按 first 升序的区间表中二分，开销只与区间数的对数相关。
  */
 typedef struct
 {
-    const char* index_str;  ///< 汉字索引 字符串指针，自动适应编码
-    uint8_t     matrix[32]; ///< 点阵数据 (16*16/8 = 32字节)
-} HZK_16_t;
+    uint16_t first;  ///< 区间首字符码点
+    uint16_t count;  ///< 区间字符数
+    uint16_t offset; ///< 区间第一个字在字模数组中的序号
+} font_range_t;
 
 /**
- * @brief 20点阵汉字结构体 (周日专用)
- * @note  用于存储周日汉字的索引和点阵数据
+ * @brief 比例字宽 (单个字模的绘制窗口)
+ * @note  只画字符格内 [left, left + advance) 这几列，光标前进 advance，
+ *        窗口应覆盖字模的全部前景像素，窗口外的列被裁掉。
  */
 typedef struct
 {
-    const char* index_str;  ///< 汉字索引 字符串指针，自动适应编码
-    uint8_t     matrix[60]; ///< 点阵数据 ((20+7)/8*20 = 60字节)
-} HZK_Week_20_t;
+    uint8_t left;    ///< 窗口起始列 (裁掉左侧空白)
+    uint8_t advance; ///< 步进宽度 (px)，即窗口宽度
+} font_metric_t;
+
+/**
+ * @brief 压缩字模描述 (包围盒 + 行程编码)
+ * @note  只存字符格内前景像素的包围盒，四周的空白在解码时补背景色。
+ *        包围盒内的行按 "行组" 编码，相同的连续行合并为一组，每组以 1 字节组头开始：
+ *        - bit6~0: 本组的行数 (1~127)
+ *        - bit7 = 1 原始行：后跟 (w + 7) / 8 字节位图 (LSB First)
+ *        - bit7 = 0 行程行：后跟 1 字节半字节数 n 与 (n + 1) / 2 字节行程 (低半字节在前)。
+ *          行程从背景色开始前景/背景交替，超过 15 的行程拆成 15、0、余数，行尾未编码的部分为背景色
+ *        由 Utils/font_rle_compress.py 在构建时从取模软件导出的位图生成 (LCD_FONT_RLE=ON)，
+ *        汉字字库由 Utils/font_subset.py 裁剪后生成 (LCD_FONT_SUBSET=ON)。
+ */
+typedef struct
+{
+    uint16_t offset; ///< 行组数据在 font_rle_t.data 中的偏移
+    uint8_t  x, y;   ///< 包围盒左上角在字符格内的位置 (px)
+    uint8_t  w, h;   ///< 包围盒宽高 (px)，空白字为 0
+} font_rle_glyph_t;
+
+/**
+ * @brief 压缩字库 (字模顺序与位图一致：ASCII 由字体的区间表寻址，汉字与码点表一一对应)
+ */
+typedef struct
+{
+    const font_rle_glyph_t* glyphs; ///< 字模描述表
+    const uint8_t*          data;   ///< 行组数据
+} font_rle_t;
 
 /**
  * @brief 字体配置描述符
  * @note  用于描述一套字体的属性（宽、高、字库地址等）
+ * @note  4-bpp 灰度字模 (抗锯齿，ascii_gray / hzk_gray) 与位图字模顺序相同，每像素 4 位：
+ *        0 为背景色，15 为前景色，中间为过渡色。逐行存放，每行 (w + 1) / 2 字节，
+ *        低半字节为左边的像素。显示时按 (前景色, 背景色) 查 16 级混色表 (lcd_font_gray.h)，
+ *        由 Utils/font_gray.py 在构建时从位图生成 (LCD_FONT_AA=ON)。
  */
 typedef struct
 {
     // === ASCII 部分 ===
-    uint8_t        ascii_w;   ///< ASCII 字符宽度 (px)
-    uint8_t        ascii_h;   ///< ASCII 字符高度 (px)
-    const uint8_t* ascii_map; ///< ASCII 字库数组指针 (0x20~0x7E)
+    uint8_t              ascii_w;           ///< ASCII 字符宽度 (px)
+    uint8_t              ascii_h;           ///< ASCII 字符高度 (px)
+    const uint8_t*       ascii_map;         ///< ASCII 字库数组指针
+    const font_rle_t*    ascii_rle;         ///< 压缩的 ASCII 字库，非 NULL 时代替 ascii_map
+    const uint8_t*       ascii_gray;        ///< 4-bpp 灰度 ASCII 字库，非 NULL 时代替以上两者
+    const font_range_t*  ascii_ranges;      ///< 字符区间表，NULL 表示完整的 0x20~0x7E
+    uint8_t              ascii_range_count; ///< 区间数
+    const font_metric_t* ascii_metrics;     ///< 比例字宽，按字模序号索引，NULL 表示等宽 ascii_w
 
     // === 汉字 部分 ===
-    uint8_t     cn_w;      ///< 汉字宽度 (px)
-    uint8_t     cn_h;      ///< 汉字高度 (px)
-    const void* hzk_table; ///< 汉字字库结构体数组指针
+    uint8_t           cn_w;      ///< 汉字宽度 (px)
+    uint8_t           cn_h;      ///< 汉字高度 (px)
+    const uint16_t*   hzk_code;  ///< Unicode 码点表 (严格升序，二分查找)
+    const uint8_t*    hzk_glyph; ///< 字模数组，第 i 个字模对应 hzk_code[i]
+    const font_rle_t* hzk_rle;   ///< 压缩的汉字字库，非 NULL 时代替 hzk_glyph
+    const uint8_t*    hzk_gray;  ///< 4-bpp 灰度汉字字库，非 NULL 时代替以上两者
+    uint8_t           hzk_ext;   ///< 1: 码点表中没有的字到外部 Flash 字库查找 (LCD_FONT_EXT)
 
     // === 寻址参数 ===
-    uint16_t hzk_count;       ///< 汉字总数
-    uint16_t hzk_struct_size; ///< 单个汉字结构体的大小 (字节)
-    uint16_t hzk_data_offset; ///< 字模数据在结构体中的偏移量 (字节)
-    uint16_t hzk_data_size;   ///< 单个字模的数据大小 (字节)
+    uint16_t hzk_count;     ///< 汉字总数
+    uint16_t hzk_data_size; ///< 单个字模的数据大小 (字节)
+
+    // === 渲染选项 ===
+    uint8_t glyph_cache; ///< 1: 展开后的 RGB565 字模进入 LRU 缓存 (每秒重绘的时钟字体)
 
 } font_info_t;
 
@@ -64,18 +108,34 @@ typedef struct
  * ================================================================== */
 
 // 原始字库数组 (定义在 Resources/Font/src/*.c 中)
-extern const HZK_16_t      HZK_16[];
-extern const HZK_Week_20_t HZK_Week_20[];
-extern const uint8_t       ASCII_8x16[];
-extern const uint8_t       ASCII_10x20[];
-extern const uint8_t       ASCII_30x60[];
+extern const uint16_t HZK_16_Code[];
+extern const uint8_t  HZK_16[][32];
+extern const uint16_t HZK_Week_20_Code[];
+extern const uint8_t  HZK_Week_20[][60];
+extern const uint8_t  ASCII_8x16[];
+extern const uint8_t  ASCII_10x20[];
+extern const uint8_t  ASCII_16x32[];
+extern const uint8_t  ASCII_30x60[];
+
+// 比例字宽表 (与同名字库放在一起)
+extern const font_metric_t ASCII_8x16_Metrics[];
+
+// 构建时压缩的字库 (LCD_FONT_RLE=ON 时由 Utils/font_rle_compress.py 生成)
+extern const font_rle_t ASCII_16x32_RLE;
+extern const font_rle_t ASCII_30x60_RLE;
+
+// 构建时生成的灰度字库 (LCD_FONT_AA=ON 时由 Utils/font_gray.py 生成)
+extern const uint8_t ASCII_10x20_GRAY[];
+extern const uint8_t ASCII_30x60_GRAY[];
 
 /**
  * @brief 全局点阵字体配置对象
  * @note  给 APP_ui.c 使用
  */
 extern font_info_t font_16;
+extern font_info_t font_16_prop;
 extern font_info_t font_time_20;
 extern font_info_t font_time_30x60;
+extern font_info_t font_ascii_16x32;
 
 #endif /* __FONT_VARIABLE_H */
\ No newline at end of file
@@ -1,7 +1,8 @@
 /**
  * @file    st7789.h
  * @brief   ST7789 LCD 屏幕底层驱动接口
- * @note    负责 SPI 初始化、屏幕配置、基础绘图（画点、填充）。
+ * @note    负责屏幕配置、基础绘图（画点、填充）与异步传输队列；总线访问经由
+ *          st7789_bus.h 传输层 (SPI2 + DMA 后端见 st7789_bus_spi.c)。
  *          字符显示等高级功能建议上层实现，保持驱动层纯净。
  * @author  meng-ming
  * @version 1.0
@@ -11,7 +12,15 @@
 #ifndef __ST7789_H
 #define __ST7789_H
 
+#if defined(ST7789_BUS_EMU) || defined(ST7789_FSMC_MOCK)
+// 主机构建 (仿真后端 / FSMC 地址窗口模拟)：没有 SPL，也没有 TE 引脚，TE 由仿真定时器产生
+#define ST7789_BUS_HOST
+#ifndef ST7789_TE_SIMULATED
+#define ST7789_TE_SIMULATED
+#endif
+#else
 #include "stm32f4xx.h"
+#endif
 #include <stdint.h>
 
 /* ==================================================================
@@ -53,6 +62,31 @@
 #define ST7789_BL_PORT GPIOB
 #define ST7789_BL_PIN GPIO_Pin_15
 
+/**
+ * @brief TE (Tearing Effect) 输入引脚定义 (EXTI 上升沿)
+ */
+#define ST7789_TE_PORT GPIOE
+#define ST7789_TE_PIN GPIO_Pin_4
+#define ST7789_TE_CLK RCC_AHB1Periph_GPIOE
+#define ST7789_TE_PORT_SOURCE EXTI_PortSourceGPIOE
+#define ST7789_TE_PIN_SOURCE EXTI_PinSource4
+#define ST7789_TE_EXTI_LINE EXTI_Line4
+#define ST7789_TE_IRQn EXTI4_IRQn
+#define ST7789_TE_IRQHandler EXTI4_IRQHandler
+
+/**
+ * @brief 8080 16 位并口 (FSMC) 定义，CMake 选项 ST7789_BUS=FSMC 时使用
+ * @note  片选接 FSMC_NE4 (PG12)，RS(DC) 接 FSMC_A6 (PF12)：
+ *        16 位总线下 HADDR[7] 驱动 A6，因此命令地址 A6=0，数据地址 A6=1 (偏移 0x80)。
+ *        数据线 D0~D15、NOE、NWE 为 FSMC 固定引脚 (PD0/1/4/5/8/9/10/14/15, PE7~PE15)，
+ *        RST/BL/TE 与 SPI 接法共用。
+ */
+#define ST7789_FSMC_BANK FSMC_Bank1_NORSRAM4
+#define ST7789_FSMC_BASE 0x6C000000U
+#define ST7789_FSMC_RS_LINE 6
+#define ST7789_FSMC_CMD_ADDR ST7789_FSMC_BASE
+#define ST7789_FSMC_DATA_ADDR (ST7789_FSMC_BASE | (1U << (ST7789_FSMC_RS_LINE + 1)))
+
 /* ==================================================================
  * 2. 引脚操作宏 (Pin Operation Macros)
  * ================================================================== */
@@ -119,6 +153,31 @@
 #define LCD_DMA_CHANNEL DMA_Channel_0
 #define LCD_DMA_CLK RCC_AHB1Periph_DMA1
 #define LCD_DMA_FLAG_TC DMA_FLAG_TCIF4
+#define LCD_DMA_IT_TC DMA_IT_TCIF4
+#define LCD_DMA_IRQn DMA1_Stream4_IRQn
+
+/**
+ * @brief FSMC 后端的 DMA 配置 (DMA2 Stream0 存储器到存储器)
+ * @note  只有 DMA2 支持存储器到存储器；FSMC 地址窗口作为固定目的地址
+ */
+#define LCD_FSMC_DMA_STREAM DMA2_Stream0
+#define LCD_FSMC_DMA_CHANNEL DMA_Channel_0
+#define LCD_FSMC_DMA_CLK RCC_AHB1Periph_DMA2
+#define LCD_FSMC_DMA_IT_TC DMA_IT_TCIF0
+#define LCD_FSMC_DMA_IRQn DMA2_Stream0_IRQn
+#define LCD_FSMC_DMA_IRQHandler DMA2_Stream0_IRQHandler
+
+/**
+ * @brief DMA 传输完成中断优先级
+ * @note  低于串口 (抢占优先级 1)，保证刷屏期间 ESP32 数据不丢
+ */
+#define LCD_DMA_IRQ_PRIORITY 2
+
+/**
+ * @brief TE 中断优先级
+ * @note  必须与 DMA 中断相同：两者都会调度传输队列，同级不嵌套即可免锁
+ */
+#define LCD_TE_IRQ_PRIORITY LCD_DMA_IRQ_PRIORITY
 
 /* ==================================================================
  * 6. 颜色转换宏 (Color Conversion Macros)
@@ -136,15 +195,33 @@
  * ================================================================== */
 
 /**
- * @brief  初始化 ST7789 屏幕
- * @note   包含 GPIO、SPI 初始化及屏幕上电序列配置
+ * @brief  初始化 ST7789 屏幕 (阻塞)
+ * @note   包含 GPIO、SPI 初始化及屏幕上电序列配置。
+ *         等价于 ST7789_Init_Start() 后循环调用 ST7789_Init_Poll() 直到完成。
  * @retval None
  */
 void ST7789_Init(void);
 
+/**
+ * @brief  开始非阻塞初始化
+ * @note   初始化传输层并拉低复位脚后立即返回。上电序列是一张常量命令表
+ *         (命令, 参数个数, 参数..., [延时])，由 ST7789_Init_Poll() 逐条执行，
+ *         每条命令连同参数在一次 CS 有效期内发出；复位、Sleep Out 等延时
+ *         只记录截止时刻，期间主循环可以初始化 RTC、复位 ESP32。
+ * @retval None
+ */
+void ST7789_Init_Start(void);
+
+/**
+ * @brief  推进非阻塞初始化
+ * @note   执行命令表直到遇到尚未到期的延时。完成前不要调用任何绘制接口。
+ * @retval 1: 初始化完成 (屏幕已开显示)  0: 仍在进行
+ */
+uint8_t ST7789_Init_Poll(void);
+
 /**
  * @brief  SPI 发送一个字节
- * @note   阻塞式发送单个字节
+ * @note   阻塞式发送单个字节 (SPI 传输层后端内部使用，其余代码请经由 st7789_bus.h)
  * @param  byte: 要发送的数据 (8位)
  * @retval None
  */
@@ -166,6 +243,27 @@ void TFT_SEND_CMD(uint8_t cmd);
  */
 void TFT_SEND_DATA(uint8_t data);
 
+/**
+ * @brief  发送命令及其参数 (一次 CS 有效期)
+ * @note   比逐字节调用 TFT_SEND_CMD/TFT_SEND_DATA 少了每字节一次的 CS 翻转与 BSY 等待。
+ *         阻塞接口，会先等待传输队列发完。
+ * @param  cmd:  命令字节
+ * @param  args: 参数数组 (可为 NULL)
+ * @param  argc: 参数个数
+ * @retval None
+ */
+void ST7789_Write_Cmd(uint8_t cmd, const uint8_t* args, uint8_t argc);
+
+/**
+ * @brief  设置显存写入窗口并发出 RAMWR (0x2C)
+ * @note   驱动记录上一次的 CASET/RASET，未变化的部分不重复发送；
+ *         返回后即可拉低 CS 连续写入像素数据。阻塞接口。
+ * @param  x_start, y_start: 左上角坐标
+ * @param  x_end, y_end:     右下角坐标 (包含)
+ * @retval None
+ */
+void ST7789_Set_Window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
 /**
  * @brief  全屏填充颜色
  * @note   使用阻塞式填充整个屏幕
@@ -196,7 +294,7 @@ void TFT_Fill_Rect(uint16_t x_start, uint16_t y_start, uint16_t w, uint16_t h, u
 /**
  * @brief  使用 DMA 全屏/区域填充颜色 (高性能版)
  * @note   利用 DMA 源地址不自增特性 + SPI 16位模式，实现极速刷屏
- *         CPU 在传输期间处于忙等待
+ *         操作进入异步传输队列后立即返回，CPU 不再忙等待。
  * @param  x: 起始 X 坐标
  * @param  y: 起始 Y 坐标
  * @param  w: 宽度 (像素)
@@ -222,4 +320,279 @@ void TFT_full_DMA(uint16_t color);
  */
 void TFT_Clear_DMA(uint16_t color);
 
+/* ==================================================================
+ * 8. 异步 DMA 传输队列 (Asynchronous DMA Transfer Queue)
+ * ================================================================== */
+
+/**
+ * @brief 队列深度 (操作个数)
+ * @note  一次区域填充 = 3 条窗口命令 + 1 次 DMA (不论面积大小)，16 项约可缓存 4 个矩形
+ */
+#define ST7789_QUEUE_DEPTH 16
+
+/**
+ * @brief 单条命令最多携带的参数字节数 (CASET/RASET 为 4 字节，VSCRDEF 为 6 字节)
+ */
+#define ST7789_OP_MAX_ARGS 6
+
+/**
+ * @brief 传输完成回调函数类型
+ * @note  在 DMA 中断上下文中执行，回调内不要做耗时操作，也不要再入队
+ * @param arg: 入队时传入的用户参数
+ */
+typedef void (*ST7789_Done_Callback_t)(void* arg);
+
+/**
+ * @brief  命令入队
+ * @note   命令字节与参数在同一次 CS 有效期内发出。
+ *         参数会被复制进队列，调用返回后 args 即可释放。
+ * @param  cmd:  命令字节
+ * @param  args: 参数数组 (可为 NULL)
+ * @param  argc: 参数个数 (0 ~ ST7789_OP_MAX_ARGS)
+ * @retval None
+ */
+void ST7789_Queue_Cmd(uint8_t cmd, const uint8_t* args, uint8_t argc);
+
+/**
+ * @brief  窗口设置入队 (CASET + RASET + RAMWR)
+ * @note   与 ST7789_Set_Window 共用窗口缓存，未变化的 CASET/RASET 不入队。
+ *         之后用 ST7789_Queue_Pixels 分批写入窗口内的像素。
+ * @param  x_start, y_start: 左上角坐标
+ * @param  x_end, y_end:     右下角坐标 (包含)
+ * @retval None
+ */
+void ST7789_Queue_Window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
+/**
+ * @brief  单色填充入队 (窗口设置 + 16 位 DMA 填充)
+ * @note   自动做边界裁剪；颜色值复制进队列，不依赖调用者栈变量。
+ *         超过 65535 像素的区域在 DMA 中断里分段续传，整块只占一条窗口。
+ * @param  x, y:  起始坐标
+ * @param  w, h:  宽高 (像素)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void ST7789_Queue_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief  数据块搬运入队 (窗口设置 + 8 位 DMA 搬运)
+ * @note   data 为 RGB565 高字节在前的字节流，传输完成前必须保持有效
+ *         (Flash 中的 const 数组天然满足)。超长数据同样分段续传。
+ * @param  x, y: 起始坐标
+ * @param  w, h: 宽高 (像素)
+ * @param  data: 像素数据 (w * h * 2 字节)
+ * @param  cb:   全部数据发送完毕后的回调 (可为 NULL)
+ * @param  arg:  回调参数
+ * @retval None
+ */
+void ST7789_Queue_Blit(uint16_t               x,
+                       uint16_t               y,
+                       uint16_t               w,
+                       uint16_t               h,
+                       const uint8_t*         data,
+                       ST7789_Done_Callback_t cb,
+                       void*                  arg);
+
+/**
+ * @brief  原生 16 位像素块搬运入队 (窗口设置 + 16 位 DMA 搬运)
+ * @note   data 为 CPU 字节序 (小端) 的 RGB565 半字数组，必须 2 字节对齐；
+ *         SPI 以 16 位帧 MSB 先发，屏幕收到的字节顺序与 8 位大端流一致。
+ *         传输完成前 data 必须保持有效。
+ * @param  x, y: 起始坐标
+ * @param  w, h: 宽高 (像素)
+ * @param  data: 像素数据 (w * h 个半字)
+ * @param  cb:   全部数据发送完毕后的回调 (可为 NULL)
+ * @param  arg:  回调参数
+ * @retval None
+ */
+void ST7789_Queue_Blit16(uint16_t               x,
+                         uint16_t               y,
+                         uint16_t               w,
+                         uint16_t               h,
+                         const uint16_t*        data,
+                         ST7789_Done_Callback_t cb,
+                         void*                  arg);
+
+/**
+ * @brief  像素数据入队 (不设置窗口，接着上一次 RAMWR 继续写)
+ * @note   两次入队之间 CS 会短暂拉高，ST7789 的 RAMWR 写指针不受影响。
+ *         数据格式与 ST7789_Queue_Blit16 相同。
+ * @param  data:  原生 16 位像素 (2 字节对齐)，发送完成前必须有效
+ * @param  count: 像素个数
+ * @param  cb:    发送完毕后的回调 (可为 NULL)，常用于释放缓冲区
+ * @param  arg:   回调参数
+ * @retval None
+ */
+void ST7789_Queue_Pixels(const uint16_t*        data,
+                         uint32_t               count,
+                         ST7789_Done_Callback_t cb,
+                         void*                  arg);
+
+/**
+ * @brief  屏障入队
+ * @note   不产生任何总线传输，前面所有操作完成后触发回调。
+ * @param  cb:  完成回调
+ * @param  arg: 回调参数
+ * @retval None
+ */
+void ST7789_Queue_Fence(ST7789_Done_Callback_t cb, void* arg);
+
+/**
+ * @brief  等待队列中所有操作发送完毕 (阻塞屏障)
+ * @note   所有直接操作 SPI 的阻塞接口 (TFT_SEND_CMD 等) 会先自动调用它。
+ * @retval None
+ */
+void ST7789_Flush(void);
+
+/**
+ * @brief  查询传输队列是否忙
+ * @retval 1: 仍有操作未完成
+ * @retval 0: 队列空闲
+ */
+uint8_t ST7789_Is_Busy(void);
+
+/**
+ * @brief  忙等时的轮询钩子
+ * @note   队列上的所有忙等 (Flush、队列满、行缓冲回收) 都会调用：
+ *         驱动无中断的传输层后端 (主机仿真)，并检查 TE 闸门是否等待超时
+ *         (超时后放行闸门、计入 timeouts 并关闭同步)。
+ * @retval None
+ */
+void ST7789_Poll(void);
+
+/* ==================================================================
+ * 9. 硬件垂直滚动 (Hardware Vertical Scrolling)
+ * ================================================================== */
+
+/**
+ * @brief  定义垂直滚动区 (VSCRDEF 0x33)
+ * @note   屏幕被分为 顶部固定区 + 滚动区 + 底部固定区，三者之和为 TFT_LINE_NUMBER。
+ *         定义后滚动偏移归零。命令经传输队列发送，与之前的绘制保持顺序。
+ * @param  top_fixed: 顶部固定区行数
+ * @param  height:    滚动区行数 (top_fixed + height <= TFT_LINE_NUMBER)
+ * @retval None
+ */
+void ST7789_Scroll_Define(uint16_t top_fixed, uint16_t height);
+
+/**
+ * @brief  滚动区向上推进 N 行 (VSCSAD 0x37)
+ * @note   只发送 2 个参数字节，不重绘整个区域。推进后屏幕底部露出的 N 行
+ *         对应的显存行从返回值开始 (到滚动区末尾会回绕，可用 ST7789_Scroll_Map_Row
+ *         逐行换算)，调用者只需在这些行上绘制新内容。
+ * @param  lines: 推进行数 (0 ~ 滚动区高度)
+ * @retval 新露出的第一行在显存中的行号
+ */
+uint16_t ST7789_Scroll_Advance(uint16_t lines);
+
+/**
+ * @brief  屏幕行 -> 显存行
+ * @note   滚动后，在滚动区内绘制必须使用显存坐标；固定区的行号不变。
+ * @param  screen_y: 屏幕上的行号
+ * @retval 显存中的行号
+ */
+uint16_t ST7789_Scroll_Map_Row(uint16_t screen_y);
+
+/**
+ * @brief  取消滚动 (整屏恢复为固定映射)
+ * @retval None
+ */
+void ST7789_Scroll_Reset(void);
+
+/* ==================================================================
+ * 10. TE 同步帧节拍 (Tearing Effect Frame Pacing)
+ * ================================================================== */
+
+/**
+ * @brief 默认 TE 触发扫描线 (TESCAN 0x44)
+ * @note  0 = 屏幕刚开始从第 0 行刷新时触发；写入从这里开始即可一直跟在扫描线后面
+ */
+#define ST7789_TE_SCANLINE 0
+
+/**
+ * @brief 等待 TE 的超时时间 (ms)
+ * @note  约 3 帧没有收到 TE 视为 TE 引脚未连接：放行队列并自动关闭同步
+ */
+#define ST7789_TE_TIMEOUT_MS 50
+
+/**
+ * @brief 仿真 TE 周期 (us)，与 0xC6 帧率设置 (60Hz) 对应
+ */
+#define ST7789_TE_SIM_PERIOD_US 16667
+
+/**
+ * @brief TE 统计信息
+ */
+typedef struct
+{
+    uint32_t te_count; ///< 累计收到的 TE 脉冲数
+    uint32_t frames;   ///< 同步发送的帧数
+    uint32_t missed;   ///< 未能在一个刷新周期内写完的帧数 (期间又来了 TE)
+    uint32_t timeouts; ///< 等待 TE 超时次数
+    uint32_t early;    ///< 生产者等不到缓冲、闸门提前放行的次数 (见 ST7789_Frame_Release)
+} ST7789_TE_Stats_t;
+
+/**
+ * @brief  初始化 TE：配置 EXTI 引脚，发送 TEON (0x35) 与 TESCAN (0x44)，开启帧同步
+ * @note   定义 ST7789_TE_SIMULATED 时 (主机仿真) 不操作硬件，
+ *         TE 由 ST7789_TE_Sim_Advance() 模拟的定时器产生。
+ * @param  scanline: TE 触发扫描线
+ * @retval None
+ */
+void ST7789_TE_Init(uint16_t scanline);
+
+/**
+ * @brief  修改 TE 触发扫描线 (TESCAN 0x44)
+ * @param  scanline: 扫描线 (0 ~ TFT_LINE_NUMBER-1)
+ * @retval None
+ */
+void ST7789_TE_Set_Scanline(uint16_t scanline);
+
+/**
+ * @brief  开关帧同步
+ * @param  enable: 1 = 帧从下一个 TE 开始发送，0 = 立即发送
+ * @retval None
+ */
+void ST7789_TE_Sync(uint8_t enable);
+
+/**
+ * @brief  标记一帧的开始
+ * @note   同步开启时入队一个 TE 闸门：之后入队的操作要等到下一个 TE 脉冲才开始发送。
+ *         调用立即返回，CPU 不等待。
+ * @retval None
+ */
+void ST7789_Frame_Begin(void);
+
+/**
+ * @brief  闸门还在等 TE 时立即放行
+ * @note   CPU 生成像素的帧 (行缓冲管线、队列写满) 在闸门后面排满之后就只能忙等，
+ *         行缓冲管线和入队在等待之前调用本函数：帧提前开始发送，CPU 不空转一个刷新周期。
+ *         只有数据全部预先入队的帧 (瓦片合成) 能真正对齐 TE。闸门未挂起时无操作。
+ * @retval None
+ */
+void ST7789_Frame_Release(void);
+
+/**
+ * @brief  标记一帧的结束
+ * @note   入队一个屏障，发送完毕时统计本帧是否跨越了多个刷新周期。
+ * @retval None
+ */
+void ST7789_Frame_End(void);
+
+/**
+ * @brief  读取 TE 统计信息
+ * @param  stats: 输出
+ * @retval None
+ */
+void ST7789_TE_Get_Stats(ST7789_TE_Stats_t* stats);
+
+#ifdef ST7789_TE_SIMULATED
+/**
+ * @brief  仿真时间前进 (主机测试用)
+ * @note   每经过 ST7789_TE_SIM_PERIOD_US 产生一次 TE，行为与 EXTI 中断一致。
+ * @param  us: 前进的微秒数
+ * @retval None
+ */
+void ST7789_TE_Sim_Advance(uint32_t us);
+#endif
+
 #endif /* __ST7789_H */
\ No newline at end of file
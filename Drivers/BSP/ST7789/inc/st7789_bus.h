@@ -0,0 +1,203 @@
+/**
+ * @file    st7789_bus.h
+ * @brief   ST7789 传输层接口 (可替换后端)
+ * @note    驱动与渲染层只通过 ST7789_Bus_t 函数表访问总线，不再直接调用 SPL：
+ *          - g_st7789_bus_spi: SPI2 + DMA1 Stream4 (默认，实际硬件)
+ *          - g_st7789_bus_fsmc: 8080 16 位并口，FSMC 地址映射写 + DMA2 存储器到存储器，
+ *            CMake 选项 ST7789_BUS=FSMC 时编译并成为默认后端
+ *          - g_st7789_bus_emu: 主机仿真，定义 ST7789_BUS_EMU 时编译 (Tests/ 主机测试工程使用)。
+ *            把 CASET/RASET/RAMWR/MADCTL 解码进 240x320 RGB565 帧缓冲，
+ *            可导出 PPM，并统计命令数 / 字节数 / CS 翻转次数，用于离线测性能与回归比对。
+ *          后端的异步流传输完成后调用 ST7789_Bus_Stream_Done() 交回驱动调度。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_BUS_H
+#define __ST7789_BUS_H
+
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 传输层函数表 (Transport Function Table)
+ * ================================================================== */
+
+/**
+ * @brief 传输层函数表
+ * @note  所有写操作都必须在 begin/end 之间进行；write_cmd 发完命令字节后自动切回数据模式。
+ */
+typedef struct
+{
+    const char* name; ///< 后端名称 (日志用)
+
+    void (*init)(void);           ///< 引脚/外设/DMA 初始化
+    void (*reset)(uint8_t level); ///< RST 引脚电平 (1 = 释放复位)
+
+    void (*begin)(void); ///< 开始一次传输 (CS 有效)
+    void (*end)(void);   ///< 等待最后一位发完后结束传输 (CS 无效)
+
+    void (*write_cmd)(uint8_t cmd);                         ///< 发送命令字节
+    void (*write_bytes)(const uint8_t* data, uint32_t len); ///< 阻塞发送数据字节
+    void (*write_repeat)(uint16_t pixel, uint32_t count);   ///< 阻塞发送重复像素
+    void (*set_16bit)(uint8_t enable);                      ///< 切换 8/16 位数据帧
+
+    /// 启动异步流传输 (DMA)：count 个数据项，halfword 选 16 位，mem_inc 选源地址自增。
+    /// 传输完成后后端调用 ST7789_Bus_Stream_Done()
+    void (*stream)(const void* src, uint16_t count, uint8_t halfword, uint8_t mem_inc);
+
+    void (*lock)(void);   ///< 屏蔽传输完成中断 (TE 中断由驱动自己屏蔽)
+    void (*unlock)(void); ///< 恢复传输完成中断
+    void (*poll)(void);   ///< 忙等时调用 (无中断的后端在这里完成流传输，可为 NULL)
+} ST7789_Bus_t;
+
+/**
+ * @brief SPI2 + DMA 后端
+ */
+extern const ST7789_Bus_t g_st7789_bus_spi;
+
+#if defined(ST7789_BUS_FSMC) || defined(ST7789_FSMC_MOCK)
+/**
+ * @brief FSMC 8080 并口后端
+ */
+extern const ST7789_Bus_t g_st7789_bus_fsmc;
+#endif
+
+/* ==================================================================
+ * 2. 驱动侧接口 (Driver Side Interface)
+ * ================================================================== */
+
+/**
+ * @brief 单次流传输的最大数据项数 (DMA NDTR 寄存器只有 16 位)
+ */
+#define ST7789_DMA_MAX_NDTR 65535U
+
+/**
+ * @brief  计算下一段流传输的长度
+ * @note   超长传输按 65535 切段，最后一段取余数；各段之间 CS 保持有效
+ * @param  remaining: 尚未发送的数据项数
+ * @retval 本段数据项数 (1 ~ ST7789_DMA_MAX_NDTR)
+ */
+static inline uint16_t ST7789_DMA_Segment(uint32_t remaining)
+{
+    return (remaining > ST7789_DMA_MAX_NDTR) ? ST7789_DMA_MAX_NDTR : (uint16_t) remaining;
+}
+
+/**
+ * @brief  选择传输层后端
+ * @note   必须在 ST7789_Init() 之前调用；默认后端在构建时决定：
+ *         ST7789_BUS_EMU -> 仿真，ST7789_BUS_FSMC -> FSMC 并口，否则为 SPI。
+ * @param  bus: 后端函数表
+ * @retval None
+ */
+void ST7789_Bus_Select(const ST7789_Bus_t* bus);
+
+/**
+ * @brief  获取当前传输层后端
+ * @retval 后端函数表
+ */
+const ST7789_Bus_t* ST7789_Bus_Get(void);
+
+/**
+ * @brief  异步流传输完成通知
+ * @note   由后端在传输完成中断 (或 poll) 中调用，驱动据此装载下一段或调度下一个操作。
+ * @retval None
+ */
+void ST7789_Bus_Stream_Done(void);
+
+/* ==================================================================
+ * 3. 主机仿真后端 (Host Emulator Backend)
+ * ================================================================== */
+
+#ifdef ST7789_BUS_EMU
+
+/**
+ * @brief 仿真后端统计信息
+ * @note  调用 ST7789_Emu_Reset_Stats() 后执行一次绘制，再读出即为该操作的开销
+ */
+typedef struct
+{
+    uint32_t commands;   ///< 命令字节数
+    uint32_t bytes;      ///< 线上传输的总字节数 (命令 + 参数 + 像素)
+    uint32_t pixels;     ///< 写入显存的像素数
+    uint32_t cs_toggles; ///< CS 有效次数 (每次 begin 计 1)
+    uint32_t streams;    ///< 异步流传输次数 (对应实际硬件的 DMA 启动次数)
+    uint32_t windows;    ///< RAMWR 次数 (每个绘制窗口一次，CASET/RASET 未变时会省掉)
+} ST7789_Emu_Stats_t;
+
+/**
+ * @brief 仿真后端
+ */
+extern const ST7789_Bus_t g_st7789_bus_emu;
+
+/**
+ * @brief  获取仿真显存 (240x320，行优先，RGB565)
+ * @retval 显存首地址
+ */
+const uint16_t* ST7789_Emu_Framebuffer(void);
+
+/**
+ * @brief  读取统计信息
+ * @param  stats: 输出
+ * @retval None
+ */
+void ST7789_Emu_Get_Stats(ST7789_Emu_Stats_t* stats);
+
+/**
+ * @brief  统计清零
+ * @retval None
+ */
+void ST7789_Emu_Reset_Stats(void);
+
+/**
+ * @brief  把仿真显存导出为 PPM (P6) 图片
+ * @param  path: 文件路径
+ * @retval 0: 成功，-1: 文件打开/写入失败
+ */
+int ST7789_Emu_Dump_PPM(const char* path);
+
+#endif /* ST7789_BUS_EMU */
+
+/* ==================================================================
+ * 4. FSMC 地址窗口模拟 (FSMC Address Window Mock)
+ * ================================================================== */
+
+#ifdef ST7789_FSMC_MOCK
+
+/**
+ * @brief 模拟记录的写操作条数上限 (超出部分只计数)
+ */
+#ifndef ST7789_FSMC_MOCK_DEPTH
+#define ST7789_FSMC_MOCK_DEPTH 4096
+#endif
+
+/**
+ * @brief 一次 FSMC 写操作
+ */
+typedef struct
+{
+    uint8_t  dc;    ///< 0 = 写命令地址 (A6=0)，1 = 写数据地址 (A6=1)
+    uint16_t value; ///< 写入的 16 位值
+} ST7789_FSMC_Mock_Write_t;
+
+/**
+ * @brief  获取记录的写操作序列
+ * @retval 记录首地址 (有效条数见 ST7789_FSMC_Mock_Count，最多 ST7789_FSMC_MOCK_DEPTH 条)
+ */
+const ST7789_FSMC_Mock_Write_t* ST7789_FSMC_Mock_Log(void);
+
+/**
+ * @brief  获取累计写操作次数 (含超出记录上限的部分)
+ * @retval 写操作次数
+ */
+uint32_t ST7789_FSMC_Mock_Count(void);
+
+/**
+ * @brief  清空记录
+ * @retval None
+ */
+void ST7789_FSMC_Mock_Clear(void);
+
+#endif /* ST7789_FSMC_MOCK */
+
+#endif /* __ST7789_BUS_H */
@@ -0,0 +1,157 @@
+/**
+ * @file    st7789_fb8.h
+ * @brief   ST7789 8 位调色板影子帧缓冲 (可选)
+ * @note    整屏 RGB565 帧缓冲需要 153.6K，放不进 F407 的 128K SRAM；
+ *          UI 实际只用到十几种颜色，因此改存 240x320 的 8 位颜色索引 (76.8K)
+ *          + 256 项 RGB565 调色板。开启后全屏绘制都只写影子缓冲并按行标脏，
+ *          ST7789_FB8_Flush() 把脏行经行缓冲查表展开为 RGB565 后 DMA 上屏，
+ *          同一轮内的重复覆盖 (先填底色再写字) 只传输最终结果。
+ *          调色板按首次出现的颜色自动分配，256 项用完后新颜色取最接近的已有颜色。
+ *          由 CMake 选项 ST7789_FB8 控制，默认关闭 (关闭时接口为空实现，不占 RAM)。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_FB8_H
+#define __ST7789_FB8_H
+
+#include "st7789.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 影子缓冲配置 (Shadow Framebuffer Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 影子帧缓冲开关 (由 CMake 选项 ST7789_FB8 统一控制)
+ */
+#ifndef ST7789_FB8_ENABLE
+#define ST7789_FB8_ENABLE 0
+#endif
+
+/**
+ * @brief 调色板项数
+ */
+#define ST7789_FB8_PALETTE_SIZE 256
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+#if ST7789_FB8_ENABLE
+
+/**
+ * @brief  初始化影子缓冲 (全部置为索引 0 = 黑色，清空调色板)
+ * @note   由 ST7789_Init() 调用
+ * @retval None
+ */
+void ST7789_FB8_Init(void);
+
+/**
+ * @brief  查找/分配颜色对应的调色板索引
+ * @param  color: RGB565 颜色
+ * @retval 调色板索引
+ */
+uint8_t ST7789_FB8_Color_Index(uint16_t color);
+
+/**
+ * @brief  判断矩形是否由影子缓冲接管
+ * @retval 1: 接管 (在屏幕范围内且开关打开)
+ * @retval 0: 不接管
+ */
+uint8_t ST7789_FB8_Contains(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief  单色填充写入影子缓冲
+ * @retval 1: 已接管 (稍后由 ST7789_FB8_Flush 上屏)
+ * @retval 0: 调用者仍需自行处理
+ */
+uint8_t ST7789_FB8_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief  像素块写入影子缓冲 (逐像素映射到调色板)
+ * @param  native16: 1 = 原生 16 位 RGB565，0 = 高字节在前的字节流
+ * @retval 1: 已接管
+ * @retval 0: 调用者仍需自行处理
+ */
+uint8_t ST7789_FB8_Blit(uint16_t       x,
+                        uint16_t       y,
+                        uint16_t       w,
+                        uint16_t       h,
+                        const uint8_t* data,
+                        uint8_t        native16);
+
+/**
+ * @brief  连续若干扫描线写入影子缓冲 (供行缓冲管线调用)
+ * @retval 1: 已接管
+ * @retval 0: 调用者仍需自行处理
+ */
+uint8_t ST7789_FB8_Write_Lines(uint16_t        x,
+                               uint16_t        y,
+                               uint16_t        w,
+                               uint16_t        rows,
+                               const uint16_t* src);
+
+/**
+ * @brief  查询是否有待推送的脏行
+ * @retval 1: 有，0: 无
+ */
+uint8_t ST7789_FB8_Is_Dirty(void);
+
+/**
+ * @brief  把脏行推送到屏幕
+ * @note   相邻脏行合并为一个窗口 (列范围取并集)，在主循环中周期调用。
+ * @retval None
+ */
+void ST7789_FB8_Flush(void);
+
+#else
+
+// 关闭时的空实现：调用点无需条件编译，编译器会把它们全部优化掉
+static inline void ST7789_FB8_Init(void)
+{
+}
+
+static inline uint8_t ST7789_FB8_Contains(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    return 0;
+}
+
+static inline uint8_t
+ST7789_FB8_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    return 0;
+}
+
+static inline uint8_t ST7789_FB8_Blit(uint16_t       x,
+                                      uint16_t       y,
+                                      uint16_t       w,
+                                      uint16_t       h,
+                                      const uint8_t* data,
+                                      uint8_t        native16)
+{
+    return 0;
+}
+
+static inline uint8_t ST7789_FB8_Write_Lines(uint16_t        x,
+                                             uint16_t        y,
+                                             uint16_t        w,
+                                             uint16_t        rows,
+                                             const uint16_t* src)
+{
+    return 0;
+}
+
+static inline uint8_t ST7789_FB8_Is_Dirty(void)
+{
+    return 0;
+}
+
+static inline void ST7789_FB8_Flush(void)
+{
+}
+
+#endif /* ST7789_FB8_ENABLE */
+
+#endif /* __ST7789_FB8_H */
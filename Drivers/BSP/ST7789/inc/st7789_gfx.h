@@ -0,0 +1,151 @@
+/**
+ * @file    st7789_gfx.h
+ * @brief   ST7789 扫描线图元库 (直线、圆、圆弧、圆角矩形、渐变)
+ * @note    所有图元都分解为水平扫描线段 (span)，每段是一次 TFT_Fill_Rect_DMA：
+ *          - 空心图形只输出边框上的线段，开销与周长成正比，而不是面积；
+ *          - 相邻行中起止列相同的线段自动合并成一个矩形，一次 DMA 填完
+ *            (圆角矩形中段、竖直粗线、渐变里量化后相同的颜色带)。
+ *          坐标允许超出屏幕 (有符号)，超出部分在线段级裁剪。
+ *          用程序绘制界面元素可以替代 Flash 中的图标位图。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_GFX_H
+#define __ST7789_GFX_H
+
+#include "st7789.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 图元配置 (Primitive Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 同时等待合并的线段数
+ * @note  一行最多产生的线段数 (圆环 2 段，圆弧最多 4 段)
+ */
+#define ST7789_GFX_MAX_RUNS 4
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  画直线 (任意方向，可指定线宽)
+ * @note   线宽 1 时用 Bresenham，每行连续的像素合并为一段；
+ *         线宽 > 1 时按旋转矩形做扫描线填充。水平/竖直线直接是一个矩形。
+ * @param  x0, y0: 起点
+ * @param  x1, y1: 终点
+ * @param  thickness: 线宽 (像素，0 按 1 处理)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Draw_Line(int16_t  x0,
+                   int16_t  y0,
+                   int16_t  x1,
+                   int16_t  y1,
+                   uint8_t  thickness,
+                   uint16_t color);
+
+/**
+ * @brief  画实心圆
+ * @param  cx, cy: 圆心
+ * @param  r: 半径
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+
+/**
+ * @brief  画圆环 (空心圆)
+ * @param  cx, cy: 圆心
+ * @param  r: 外半径
+ * @param  thickness: 环宽 (像素，>= r 时等同实心圆)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint8_t thickness, uint16_t color);
+
+/**
+ * @brief  画圆弧
+ * @note   角度以 3 点钟方向为 0 度，顺时针增加 (屏幕 y 轴向下)；
+ *         从 start_deg 顺时针画到 end_deg，end < start 时跨过 0 度。
+ * @param  cx, cy: 圆心
+ * @param  r: 外半径
+ * @param  thickness: 弧宽 (像素)
+ * @param  start_deg: 起始角 (0 ~ 359)
+ * @param  end_deg: 结束角 (0 ~ 359)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Draw_Arc(int16_t  cx,
+                  int16_t  cy,
+                  uint16_t r,
+                  uint8_t  thickness,
+                  uint16_t start_deg,
+                  uint16_t end_deg,
+                  uint16_t color);
+
+/**
+ * @brief  画实心圆角矩形
+ * @param  x, y: 左上角
+ * @param  w, h: 宽高
+ * @param  r: 圆角半径 (超过短边一半时自动缩小)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Fill_Round_Rect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+
+/**
+ * @brief  画空心圆角矩形
+ * @param  x, y: 左上角
+ * @param  w, h: 宽高
+ * @param  r: 圆角半径 (外轮廓)
+ * @param  thickness: 边框宽度 (像素)
+ * @param  color: RGB565 颜色
+ * @retval None
+ */
+void TFT_Draw_Round_Rect(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t r,
+                         uint8_t  thickness,
+                         uint16_t color);
+
+/**
+ * @brief  竖直渐变填充 (从上到下)
+ * @note   每行颜色按线性插值得到，每行是一次单色填充；
+ *         RGB565 量化后颜色相同的相邻行合并成一个矩形。
+ * @param  x, y: 左上角
+ * @param  w, h: 宽高
+ * @param  color_top: 顶部颜色
+ * @param  color_bottom: 底部颜色
+ * @retval None
+ */
+void TFT_Fill_Gradient_V(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t color_top,
+                         uint16_t color_bottom);
+
+/**
+ * @brief  水平渐变填充 (从左到右)
+ * @note   只预先计算一行像素，之后每行从这份行缓冲拷进管线发送。
+ * @param  x, y: 左上角
+ * @param  w, h: 宽高
+ * @param  color_left: 左侧颜色
+ * @param  color_right: 右侧颜色
+ * @retval None
+ */
+void TFT_Fill_Gradient_H(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t color_left,
+                         uint16_t color_right);
+
+#endif /* __ST7789_GFX_H */
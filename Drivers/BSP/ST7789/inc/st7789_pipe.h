@@ -0,0 +1,67 @@
+/**
+ * @file    st7789_pipe.h
+ * @brief   ST7789 乒乓行缓冲渲染管线
+ * @note    两块 RAM 行缓冲交替使用：CPU 往一块里展开下一批扫描线
+ *          (字模位图转 RGB565、解压、查调色板...)，DMA 同时发送另一块。
+ *          字体、图片解码等所有需要 CPU 生成像素的绘制路径共用这一条管线。
+ *          落在合成层 (st7789_tile.h / st7789_fb8.h) 内的绘制改写副本，由合成层统一上屏。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_PIPE_H
+#define __ST7789_PIPE_H
+
+#include "st7789.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 管线配置 (Pipeline Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 单块行缓冲容量 (像素)
+ * @note  至少容纳一整行 (TFT_COLUMN_NUMBER)；窄区域 (如 16 像素宽的字) 会把
+ *        多行攒进同一块缓冲再发，避免每行一次 DMA 中断。
+ *        两块共占用 2 * 2 * ST7789_PIPE_BUF_PIXELS 字节 SRAM。
+ */
+#define ST7789_PIPE_BUF_PIXELS TFT_COLUMN_NUMBER
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  开始一次管线绘制
+ * @note   入队窗口设置，之后按从上到下的顺序逐行调用 ST7789_Pipe_Line。
+ *         区域不做裁剪，调用者需保证在屏幕范围内。
+ * @param  x, y: 起始坐标
+ * @param  w, h: 宽高 (像素)，w 不能超过 ST7789_PIPE_BUF_PIXELS
+ * @retval 1: 成功
+ * @retval 0: 参数非法 (此时不要调用 Line/End)
+ */
+uint8_t ST7789_Pipe_Begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief  开始一次直接上屏的管线绘制
+ * @note   不经过合成层，供合成层推送自己的副本时使用；参数与返回值同 ST7789_Pipe_Begin。
+ */
+uint8_t ST7789_Pipe_Begin_Direct(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief  申请下一条扫描线的写入位置
+ * @note   返回的缓冲可写 w 个原生 16 位 RGB565 像素，下次调用 Line/End 前必须写满。
+ *         当前缓冲放不下时自动提交给 DMA 并切到另一块；另一块仍在发送时才会等待。
+ * @retval 扫描线缓冲指针
+ */
+uint16_t* ST7789_Pipe_Line(void);
+
+/**
+ * @brief  结束本次管线绘制
+ * @note   提交最后一块未满的缓冲后立即返回，不等待 DMA 发完。
+ * @retval None
+ */
+void ST7789_Pipe_End(void);
+
+#endif /* __ST7789_PIPE_H */
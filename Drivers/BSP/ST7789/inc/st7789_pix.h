@@ -0,0 +1,110 @@
+/**
+ * @file    st7789_pix.h
+ * @brief   像素转换内核 (Cortex-M4 DSP 指令优化)
+ * @note    CPU 生成像素的热点循环：1-bpp 字模展开为 RGB565、取模软件导出的大端字节流
+ *          转原生 RGB565、RGB888 打包为 RGB565。按字处理，每次写两个像素 (一次 32 位存储)：
+ *          目标板上用 core_cmSimd.h 的 SIMD 指令，主机构建 (ST7789_BUS_HOST) 或编译器不支持
+ *          DSP 扩展时用等价的位运算 (可移植版本)。两者都与逐像素的参考实现逐位一致，
+ *          ST7789_Pix_Benchmark() 对比输出，板上再用 DWT 周期计数器测量耗时
+ *          (CMake 选项 ST7789_PIX_BENCH)；主机测试见 Tests/src/test_pix.c。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_PIX_H
+#define __ST7789_PIX_H
+
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 单个内核的测量结果
+ */
+typedef struct
+{
+    uint32_t ref_cycles;  ///< 参考实现的周期数 (主机构建为 0)
+    uint32_t fast_cycles; ///< 优化实现的周期数 (主机构建为 0)
+    uint32_t mismatches;  ///< 输出与参考实现不一致的像素数，应为 0
+} ST7789_Pix_Bench_Item_t;
+
+/**
+ * @brief 全部内核的测量结果
+ * @note  周期数为同一组数据 (240 像素一行，共 64 行) 的总耗时
+ */
+typedef struct
+{
+    ST7789_Pix_Bench_Item_t expand; ///< 1-bpp 展开
+    ST7789_Pix_Bench_Item_t swap16; ///< 大端字节流转原生 RGB565
+    ST7789_Pix_Bench_Item_t rgb888; ///< RGB888 打包为 RGB565
+} ST7789_Pix_Bench_t;
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  把 1-bpp 位图一行中从第 skip 位起的 w 位展开为 RGB565
+ * @note   位序为 LSB First (与字库相同)。每 8 个像素查 4 次两位掩码，从前景/背景色对中
+ *         选出两个像素，一次 32 位存储 (目标板上为 __UADD8 + __SEL)。
+ * @param  dst:    输出像素 (至少 2 字节对齐)
+ * @param  src:    位图行首
+ * @param  skip:   起始位 (比例字体的窗口)
+ * @param  w:      输出像素数
+ * @param  fg, bg: 前景色/背景色
+ * @retval None
+ */
+void ST7789_Pix_Expand_Bits(uint16_t*      dst,
+                            const uint8_t* src,
+                            uint16_t       skip,
+                            uint16_t       w,
+                            uint16_t       fg,
+                            uint16_t       bg);
+
+/**
+ * @brief  大端 RGB565 字节流 (高字节在前) 转原生 RGB565
+ * @note   每次读 4 字节，交换两个半字的字节序后整字写入 (目标板上为 __REV16)
+ * @param  dst: 输出像素 (至少 2 字节对齐)
+ * @param  src: 字节流 (任意对齐)
+ * @param  n:   像素数
+ * @retval None
+ */
+void ST7789_Pix_Swap16(uint16_t* dst, const uint8_t* src, uint32_t n);
+
+/**
+ * @brief  RGB888 (每像素 R, G, B 三字节) 打包为 RGB565
+ * @note   与 TFT_RGB() 相同，直接截掉低位。每次读 3 个字 (4 个像素)，两两拼成一个字写入
+ *         (目标板上为 __PKHBT)。供 LCD_Show_Image_Lines 的行解码器使用。
+ * @param  dst: 输出像素 (至少 2 字节对齐)
+ * @param  src: RGB888 字节流 (任意对齐)
+ * @param  n:   像素数
+ * @retval None
+ */
+void ST7789_Pix_RGB888_To_565(uint16_t* dst, const uint8_t* src, uint32_t n);
+
+/**
+ * @brief  参考实现 (逐像素，可移植)
+ * @note   参数与上面的同名函数相同，作为逐位对比的基准
+ */
+void ST7789_Pix_Expand_Bits_Ref(uint16_t*      dst,
+                                const uint8_t* src,
+                                uint16_t       skip,
+                                uint16_t       w,
+                                uint16_t       fg,
+                                uint16_t       bg);
+void ST7789_Pix_Swap16_Ref(uint16_t* dst, const uint8_t* src, uint32_t n);
+void ST7789_Pix_RGB888_To_565_Ref(uint16_t* dst, const uint8_t* src, uint32_t n);
+
+/**
+ * @brief  对比优化实现与参考实现并测量耗时
+ * @note   覆盖各种起始位、宽度与输出对齐，逐像素比较 (含输出末尾之后的哨兵，检查越界写)。
+ *         目标板上打开 DWT 周期计数器计时，计时期间关中断 (共几毫秒)。
+ * @param  result: 输出
+ * @retval None
+ */
+void ST7789_Pix_Benchmark(ST7789_Pix_Bench_t* result);
+
+#endif /* __ST7789_PIX_H */
@@ -0,0 +1,115 @@
+/**
+ * @file    st7789_tile.h
+ * @brief   ST7789 脏矩形合成层 (CCM RAM 瓦片缓存)
+ * @note    屏幕顶部一段区域在 64K CCM RAM 中保留一份 RGB565 副本，按 16x16 瓦片管理。
+ *          完全落在该区域内的填充/搬运/字模只写瓦片并标脏，不立即上屏；
+ *          ST7789_Tile_Flush() 把每行相邻的脏瓦片合并成一次窗口传输推送到屏幕。
+ *          同一帧内重叠的写入 (状态文字 + WiFi 图标) 因此只发送一次。
+ *          跨越区域边界的绘制照常直接上屏，同时把重叠部分写入瓦片，保证副本一致。
+ *          CCM 不能作为 DMA 源，推送时经由 st7789_pipe 的 SRAM 行缓冲中转。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __ST7789_TILE_H
+#define __ST7789_TILE_H
+
+#include "st7789.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 瓦片层配置 (Tile Layer Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 瓦片边长 (像素，必须为 2 的幂)
+ */
+#define ST7789_TILE_SIZE 16
+
+/**
+ * @brief 瓦片区域：整屏宽度，从 ST7789_TILE_Y 开始共 ST7789_TILE_ROWS 行瓦片
+ * @note  默认 8 行，覆盖 y = 0 ~ 127，即状态栏 + 时间区 (每秒刷新的部分)，占用 60K CCM。
+ *        CMake 选项 ST7789_TILE_ROWS 可改为 2：只覆盖状态栏 (15K)，把 CCM 让给字模缓存。
+ */
+#define ST7789_TILE_Y 0
+#ifndef ST7789_TILE_ROWS
+#define ST7789_TILE_ROWS 8
+#endif
+#define ST7789_TILE_COLS (TFT_COLUMN_NUMBER / ST7789_TILE_SIZE)
+
+/**
+ * @brief CCM 总容量 (与链接脚本中的 CCMRAM 区一致)
+ * @note  瓦片副本占 ST7789_TILE_CCM_BYTES，其余全部分给字模缓存 (lcd_glyph_cache.h)
+ */
+#define ST7789_CCM_BYTES (64 * 1024)
+#define ST7789_TILE_CCM_BYTES                                                                      \
+    (ST7789_TILE_ROWS * ST7789_TILE_COLS * ST7789_TILE_SIZE * ST7789_TILE_SIZE * 2)
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  初始化瓦片层 (清空副本与脏标记)
+ * @note   由 ST7789_Init() 调用
+ * @retval None
+ */
+void ST7789_Tile_Init(void);
+
+/**
+ * @brief  判断矩形是否完全落在瓦片区域内 (可被瓦片层接管)
+ * @retval 1: 接管，调用者不要再直接上屏
+ * @retval 0: 不接管
+ */
+uint8_t ST7789_Tile_Contains(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief  单色填充写入瓦片
+ * @note   与瓦片区域相交的部分写入副本；完全落在区域内时标脏并返回 1。
+ * @retval 1: 已接管 (稍后由 ST7789_Tile_Flush 上屏)
+ * @retval 0: 调用者仍需直接上屏
+ */
+uint8_t ST7789_Tile_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief  像素块写入瓦片
+ * @param  data:     像素数据
+ * @param  native16: 1 = 原生 16 位 RGB565，0 = 高字节在前的字节流
+ * @retval 1: 已接管
+ * @retval 0: 调用者仍需直接上屏
+ */
+uint8_t ST7789_Tile_Blit(uint16_t       x,
+                         uint16_t       y,
+                         uint16_t       w,
+                         uint16_t       h,
+                         const uint8_t* data,
+                         uint8_t        native16);
+
+/**
+ * @brief  连续若干扫描线写入瓦片 (供行缓冲管线调用)
+ * @param  src:   原生 16 位像素，rows 行 x w 个
+ * @param  dirty: 1 = 标脏 (接管模式)，0 = 只同步副本 (直接上屏模式)
+ * @retval None
+ */
+void ST7789_Tile_Write_Lines(uint16_t        x,
+                             uint16_t        y,
+                             uint16_t        w,
+                             uint16_t        rows,
+                             const uint16_t* src,
+                             uint8_t         dirty);
+
+/**
+ * @brief  查询是否有待推送的脏瓦片
+ * @retval 1: 有，0: 无
+ */
+uint8_t ST7789_Tile_Is_Dirty(void);
+
+/**
+ * @brief  把所有脏瓦片推送到屏幕
+ * @note   每行瓦片中相邻的脏瓦片合并为一个窗口；在主循环中周期调用。
+ * @retval None
+ */
+void ST7789_Tile_Flush(void);
+
+#endif /* __ST7789_TILE_H */
@@ -4,202 +4,249 @@
  */
 
 #include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_tile.h"
+#include "st7789_fb8.h"
 #include "BSP_Tick_Delay.h"
+#include <stddef.h>
+
+static void ST7789_Send_Cmd_Args(uint8_t cmd, const uint8_t* args, uint8_t argc);
+
+/**
+ * @brief ڴϣвλֶд () ֮ƶдָ
+ * @note  û CMSISֹֻ
+ */
+#ifdef ST7789_BUS_HOST
+#define ST7789_DMB() __asm volatile("" ::: "memory")
+#else
+#define ST7789_DMB() __DMB()
+#endif
+
+// ǰ
+#if defined(ST7789_BUS_EMU)
+static const ST7789_Bus_t* s_bus = &g_st7789_bus_emu;
+#elif defined(ST7789_BUS_FSMC) || defined(ST7789_FSMC_MOCK)
+static const ST7789_Bus_t* s_bus = &g_st7789_bus_fsmc;
+#else
+static const ST7789_Bus_t* s_bus = &g_st7789_bus_spi;
+#endif
+
+/**
+ * @brief ַڻ (ʼ << 16 | )
+ * @note  ¼Ļǰ CASET/RASET ֵͬ·ʱ£
+ *        · Flush ٱȽϣ߿ĶǶִ֮Ĵ״̬
+ */
+#define ST7789_WINDOW_INVALID 0xFFFFFFFFU
+
+static uint32_t s_win_col = ST7789_WINDOW_INVALID;
+static uint32_t s_win_row = ST7789_WINDOW_INVALID;
+
+/**
+ * @brief  ƹڻд CASET/RASET ʱϻ (˽)
+ */
+static inline void ST7789_Window_Cache_Check(uint8_t cmd)
+{
+    if (cmd == 0x2A)
+        s_win_col = ST7789_WINDOW_INVALID;
+    else if (cmd == 0x2B)
+        s_win_row = ST7789_WINDOW_INVALID;
+}
 
 // ====================================================================
-// Ӳʼ (˽к)
+// ѡ
 // ====================================================================
-static void ST7789_Hardware_Init(void)
+void ST7789_Bus_Select(const ST7789_Bus_t* bus)
 {
-    GPIO_InitTypeDef GPIO_InitStructure;
-    SPI_InitTypeDef  SPI_InitStructure;
-
-    // 1. ʱ
-    RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2, ENABLE);
-    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB | RCC_AHB1Periph_GPIOC | RCC_AHB1Periph_GPIOE,
-                           ENABLE);
-
-    // 2. ÿ (CS, DC, RST, BL)
-    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_OUT;
-    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
-    GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_UP;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
-
-    // CS
-    GPIO_InitStructure.GPIO_Pin = ST7789_CS_PIN;
-    GPIO_Init(ST7789_CS_PORT, &GPIO_InitStructure);
-    LCD_CS_SET();
-
-    // DC
-    GPIO_InitStructure.GPIO_Pin = ST7789_DC_PIN;
-    GPIO_Init(ST7789_DC_PORT, &GPIO_InitStructure);
-
-    // RST
-    GPIO_InitStructure.GPIO_Pin = ST7789_RST_PIN;
-    GPIO_Init(ST7789_RST_PORT, &GPIO_InitStructure);
-
-    // BL
-    GPIO_InitStructure.GPIO_Pin = ST7789_BL_PIN;
-    GPIO_Init(ST7789_BL_PORT, &GPIO_InitStructure);
-    LCD_BL_SET(); // 
-
-    // 3.  SPI  (SCK, MOSI, MISO)
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-
-    // SCK
-    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_SCK_PIN;
-    GPIO_Init(ST7789_SPI_SCK_PORT, &GPIO_InitStructure);
-    GPIO_PinAFConfig(ST7789_SPI_SCK_PORT, GPIO_PinSource10, GPIO_AF_SPI2);
-
-    // MOSI
-    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_MOSI_PIN;
-    GPIO_Init(ST7789_SPI_MOSI_PORT, &GPIO_InitStructure);
-    GPIO_PinAFConfig(ST7789_SPI_MOSI_PORT, GPIO_PinSource3, GPIO_AF_SPI2);
-
-    // MISO (ȻãΪ)
-    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_MISO_PIN;
-    GPIO_Init(ST7789_SPI_MISO_PORT, &GPIO_InitStructure);
-    GPIO_PinAFConfig(ST7789_SPI_MISO_PORT, GPIO_PinSource2, GPIO_AF_SPI2);
-
-    // 4.  SPI 
-    SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
-    SPI_InitStructure.SPI_Mode      = SPI_Mode_Master;
-    SPI_InitStructure.SPI_DataSize  = SPI_DataSize_8b;
-    SPI_InitStructure.SPI_CPOL      = SPI_CPOL_Low;
-    SPI_InitStructure.SPI_CPHA      = SPI_CPHA_1Edge;
-    SPI_InitStructure.SPI_NSS       = SPI_NSS_Soft;
-    SPI_InitStructure.SPI_BaudRatePrescaler =
-        SPI_BaudRatePrescaler_2; // ܿ죬F4 APB1=42M, /2=21M
-    SPI_InitStructure.SPI_FirstBit      = SPI_FirstBit_MSB;
-    SPI_InitStructure.SPI_CRCPolynomial = 7;
-    SPI_Init(ST7789_SPI_PERIPH, &SPI_InitStructure);
-
-    SPI_Cmd(ST7789_SPI_PERIPH, ENABLE);
+    if (bus)
+        s_bus = bus;
+}
+
+const ST7789_Bus_t* ST7789_Bus_Get(void)
+{
+    return s_bus;
 }
 
 // ====================================================================
 // ͨŽӿ
 // ====================================================================
-void ST7789_SPI_SendByte(uint8_t byte)
+void TFT_SEND_CMD(uint8_t cmd)
 {
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
-        ;
-    SPI_I2S_SendData(ST7789_SPI_PERIPH, byte);
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
-        ;
+    ST7789_Flush(); // ӿֱӲ SPIȵȶз
+    ST7789_Window_Cache_Check(cmd);
+
+    s_bus->begin();
+    s_bus->write_cmd(cmd);
+    s_bus->end();
 }
 
-void TFT_SEND_CMD(uint8_t cmd)
+void TFT_SEND_DATA(uint8_t data)
 {
-    LCD_DC_CLR(); // ģʽ
-    LCD_CS_CLR();
-    ST7789_SPI_SendByte(cmd);
-    LCD_CS_SET();
+    ST7789_Flush();
+
+    s_bus->begin(); // ģʽ
+    s_bus->write_bytes(&data, 1);
+    s_bus->end();
 }
 
-void TFT_SEND_DATA(uint8_t data)
+void ST7789_Write_Cmd(uint8_t cmd, const uint8_t* args, uint8_t argc)
+{
+    ST7789_Flush();
+    ST7789_Window_Cache_Check(cmd);
+
+    ST7789_Send_Cmd_Args(cmd, args, argc);
+}
+
+void ST7789_Set_Window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
 {
-    LCD_DC_SET(); // ģʽ
-    LCD_CS_CLR();
-    ST7789_SPI_SendByte(data);
-    LCD_CS_SET();
+    uint32_t col = ((uint32_t) x_start << 16) | x_end;
+    uint32_t row = ((uint32_t) y_start << 16) | y_end;
+    uint8_t  args[4];
+
+    ST7789_Flush();
+
+    if (col != s_win_col)
+    {
+        args[0] = x_start >> 8;
+        args[1] = x_start & 0xFF;
+        args[2] = x_end >> 8;
+        args[3] = x_end & 0xFF;
+        ST7789_Send_Cmd_Args(0x2A, args, 4); // Column Address Set
+        s_win_col = col;
+    }
+
+    if (row != s_win_row)
+    {
+        args[0] = y_start >> 8;
+        args[1] = y_start & 0xFF;
+        args[2] = y_end >> 8;
+        args[3] = y_end & 0xFF;
+        ST7789_Send_Cmd_Args(0x2B, args, 4); // Row Address Set
+        s_win_row = row;
+    }
+
+    // RAMWR ÿζҪдָ븴λϽ
+    ST7789_Send_Cmd_Args(0x2C, NULL, 0); // Memory Write
 }
 
 // ====================================================================
-// Ĺʵ
+// ϵʼ ( + )
 // ====================================================================
-void ST7789_Init(void)
+
+/**
+ * @brief 
+ * @note  ÿ: ,  [| ST7789_INIT_DELAY], ..., [ʱ ms]
+ *        ֽλ 1 ʾ֮ 1 ֽʱ ST7789_INIT_END 
+ */
+#define ST7789_INIT_DELAY 0x80
+#define ST7789_INIT_END   0xFF // Ч ST7789 
+
+#define ST7789_RESET_LOW_MS  2   // λ͵ƽ (Ҫ >= 10ustick  1msȡ 2 ֤㹻)
+#define ST7789_RESET_WAIT_MS 120 // λͷź Sleep Out ֮ǰĵȴ
+
+static const uint8_t s_st7789_init_script[] = {
+    0x11, ST7789_INIT_DELAY | 0, 120,                   // Sleep OutȴԴ/ʱȶ
+    0x36, 1, 0x00,                                      // MADCTL: 0x00, 0xC0, 0x70, 0xA0 
+    0x3A, 1, 0x05,                                      // Interface Pixel Format: 16-bit/pixel
+    0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,              // Porch Setting
+    0xB7, 1, 0x35,                                      // Gate Control
+    0xBB, 1, 0x19,                                      // VCOM Setting
+    0xC0, 1, 0x2C,                                      // LCM Control
+    0xC2, 1, 0x01,                                      // VDV and VRH Command Enable
+    0xC3, 1, 0x12,                                      // VRH Set
+    0xC4, 1, 0x20,                                      // VDV Set
+    0xC6, 1, 0x0F,                                      // Frame Rate Control
+    0xD0, 2, 0xA4, 0xA1,                                // Power Control 1
+    0xE0, 14, 0xD0, 0x05, 0x09, 0x09, 0x08, 0x14, 0x28, // Positive Gamma (׼΢)
+    0x33, 0x3F, 0x07, 0x13, 0x14, 0x28, 0x30,           //
+    0xE1, 14, 0xD0, 0x05, 0x09, 0x09, 0x08, 0x03, 0x24, // Negative Gamma
+    0x32, 0x32, 0x3B, 0x14, 0x13, 0x28, 0x2F,           //
+    0x20, 0,                                            // Display Inversion Off
+    0x29, 0,                                            // Display On
+    ST7789_INIT_END,
+};
+
+typedef enum
+{
+    ST7789_INIT_STATE_IDLE = 0, // δʼ
+    ST7789_INIT_STATE_RESET,    // λ
+    ST7789_INIT_STATE_SCRIPT,   // ִ
+    ST7789_INIT_STATE_DONE,     // 
+} ST7789_Init_State_e;
+
+static ST7789_Init_State_e s_init_state = ST7789_INIT_STATE_IDLE;
+static const uint8_t*      s_init_pc    = s_st7789_init_script; // ִλ
+static uint32_t            s_init_t0    = 0;                    // ǰʱ
+static uint32_t            s_init_wait  = 0;                    // ǰʱ (ms)
+
+/**
+ * @brief  ʼһηʱ (˽)
+ */
+static void ST7789_Init_Delay(uint32_t ms)
 {
-    ST7789_Hardware_Init();
+    s_init_t0   = (uint32_t) BSP_GetTick_ms();
+    s_init_wait = ms;
+}
+
+void ST7789_Init_Start(void)
+{
+    s_bus->init();
+    ST7789_Tile_Init();
+    ST7789_FB8_Init();
     BSP_SysTick_Init(); // ȷʱ׼ѳʼ
 
-    // λ
-    LCD_RST_SET();
-    BSP_Delay_ms(10);
-    LCD_RST_CLR();
-    BSP_Delay_ms(10); //  10us
-    LCD_RST_SET();
-    BSP_Delay_ms(120); // Wait for reset complete
-
-    // ʼ
-    TFT_SEND_CMD(0x11); // Sleep Out
-    BSP_Delay_ms(120);
-
-    TFT_SEND_CMD(0x36);  // Memory Data Access Control
-    TFT_SEND_DATA(0x00); // ʵĻ: 0x00, 0xC0, 0x70, 0xA0 
-
-    TFT_SEND_CMD(0x3A);  // Interface Pixel Format
-    TFT_SEND_DATA(0x05); // 16-bit/pixel
-
-    // Porch Setting
-    TFT_SEND_CMD(0xB2);
-    TFT_SEND_DATA(0x0C);
-    TFT_SEND_DATA(0x0C);
-    TFT_SEND_DATA(0x00);
-    TFT_SEND_DATA(0x33);
-    TFT_SEND_DATA(0x33);
-
-    TFT_SEND_CMD(0xB7); // Gate Control
-    TFT_SEND_DATA(0x35);
-
-    TFT_SEND_CMD(0xBB); // VCOM Setting
-    TFT_SEND_DATA(0x19);
-
-    TFT_SEND_CMD(0xC0); // LCM Control
-    TFT_SEND_DATA(0x2C);
-
-    TFT_SEND_CMD(0xC2); // VDV and VRH Command Enable
-    TFT_SEND_DATA(0x01);
-
-    TFT_SEND_CMD(0xC3); // VRH Set
-    TFT_SEND_DATA(0x12);
-
-    TFT_SEND_CMD(0xC4); // VDV Set
-    TFT_SEND_DATA(0x20);
-
-    TFT_SEND_CMD(0xC6); // Frame Rate Control
-    TFT_SEND_DATA(0x0F);
-
-    TFT_SEND_CMD(0xD0); // Power Control 1
-    TFT_SEND_DATA(0xA4);
-    TFT_SEND_DATA(0xA1);
-
-    // Gamma Setting (׼΢)
-    TFT_SEND_CMD(0xE0); // Set Gamma
-    TFT_SEND_DATA(0xD0);
-    TFT_SEND_DATA(0x05);
-    TFT_SEND_DATA(0x09);
-    TFT_SEND_DATA(0x09);
-    TFT_SEND_DATA(0x08);
-    TFT_SEND_DATA(0x14);
-    TFT_SEND_DATA(0x28);
-    TFT_SEND_DATA(0x33);
-    TFT_SEND_DATA(0x3F);
-    TFT_SEND_DATA(0x07);
-    TFT_SEND_DATA(0x13);
-    TFT_SEND_DATA(0x14);
-    TFT_SEND_DATA(0x28);
-    TFT_SEND_DATA(0x30);
-
-    TFT_SEND_CMD(0XE1); // Set Gamma
-    TFT_SEND_DATA(0xD0);
-    TFT_SEND_DATA(0x05);
-    TFT_SEND_DATA(0x09);
-    TFT_SEND_DATA(0x09);
-    TFT_SEND_DATA(0x08);
-    TFT_SEND_DATA(0x03);
-    TFT_SEND_DATA(0x24);
-    TFT_SEND_DATA(0x32);
-    TFT_SEND_DATA(0x32);
-    TFT_SEND_DATA(0x3B);
-    TFT_SEND_DATA(0x14);
-    TFT_SEND_DATA(0x13);
-    TFT_SEND_DATA(0x28);
-    TFT_SEND_DATA(0x2F);
-
-    TFT_SEND_CMD(0x20); // Display Inversion On
-    TFT_SEND_CMD(0x29); // Display On
+    s_bus->reset(0);
+    ST7789_Init_Delay(ST7789_RESET_LOW_MS);
+    s_init_pc    = s_st7789_init_script;
+    s_init_state = ST7789_INIT_STATE_RESET;
+}
+
+uint8_t ST7789_Init_Poll(void)
+{
+    if (s_init_state == ST7789_INIT_STATE_DONE)
+        return 1;
+    if (s_init_state == ST7789_INIT_STATE_IDLE)
+        return 0;
+    if ((uint32_t) BSP_GetTick_ms() - s_init_t0 < s_init_wait)
+        return 0;
+
+    if (s_init_state == ST7789_INIT_STATE_RESET)
+    {
+        s_bus->reset(1);
+        ST7789_Init_Delay(ST7789_RESET_WAIT_MS);
+        s_init_state = ST7789_INIT_STATE_SCRIPT;
+        return 0;
+    }
+
+    // ִеһʱβ
+    while (*s_init_pc != ST7789_INIT_END)
+    {
+        uint8_t cmd  = s_init_pc[0];
+        uint8_t argc = s_init_pc[1] & (uint8_t) ~ST7789_INIT_DELAY;
+        uint8_t wait = s_init_pc[1] & ST7789_INIT_DELAY;
+
+        ST7789_Send_Cmd_Args(cmd, &s_init_pc[2], argc);
+        s_init_pc += 2 + argc;
+
+        if (wait)
+        {
+            ST7789_Init_Delay(*s_init_pc++);
+            return 0;
+        }
+    }
+
+    s_init_state = ST7789_INIT_STATE_DONE;
+    return 1;
+}
+
+// ====================================================================
+// Ĺʵ
+// ====================================================================
+void ST7789_Init(void)
+{
+    ST7789_Init_Start();
+    while (!ST7789_Init_Poll())
+    {
+    }
 }
 
 void TFT_Fill_Rect(uint16_t x_start, uint16_t y_start, uint16_t w, uint16_t h, uint16_t color)
@@ -223,40 +270,24 @@ void TFT_Fill_Rect(uint16_t x_start, uint16_t y_start, uint16_t w, uint16_t h, u
     if (y_end >= TFT_LINE_NUMBER)
         y_end = TFT_LINE_NUMBER - 1;
 
-    // ôָ
-    TFT_SEND_CMD(0x2A); // Column Address Set
-    TFT_SEND_DATA(x_start >> 8);
-    TFT_SEND_DATA(x_start & 0xFF);
-    TFT_SEND_DATA(x_end >> 8);
-    TFT_SEND_DATA(x_end & 0xFF);
-
-    TFT_SEND_CMD(0x2B); // Row Address Set
-    TFT_SEND_DATA(y_start >> 8);
-    TFT_SEND_DATA(y_start & 0xFF);
-    TFT_SEND_DATA(y_end >> 8);
-    TFT_SEND_DATA(y_end & 0xFF);
-
-    TFT_SEND_CMD(0x2C); // Memory Write
+    // 5. ɺϳɲ (Ӱӻ / Ƭ) ӹܵԺͳһ
+    uint16_t clip_w = x_end - x_start + 1;
+    uint16_t clip_h = y_end - y_start + 1;
+    if (ST7789_FB8_Fill(x_start, y_start, clip_w, clip_h, color) ||
+        ST7789_Tile_Fill(x_start, y_start, clip_w, clip_h, color))
+        return;
 
-    // ׼ɫ
-    uint8_t color_h = color >> 8;
-    uint8_t color_l = color & 0xFF;
+    // ôָ
+    ST7789_Set_Window(x_start, y_start, x_end, y_end);
 
     // ʵҪ͵ص
     // ע⣺ô x_end/y_end 㣬д
     uint32_t total_pixels = (uint32_t) (x_end - x_start + 1) * (y_end - y_start + 1);
 
-    LCD_DC_SET();
-    LCD_CS_CLR();
-
     // 
-    while (total_pixels--)
-    {
-        ST7789_SPI_SendByte(color_h);
-        ST7789_SPI_SendByte(color_l);
-    }
-
-    LCD_CS_SET();
+    s_bus->begin();
+    s_bus->write_repeat(color, total_pixels);
+    s_bus->end();
 }
 
 void TFT_full(uint16_t color)
@@ -274,105 +305,661 @@ void TFT_clear(void)
 // ====================================================================
 
 void TFT_Fill_Rect_DMA(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    // ӺأĴ DMA жϽ
+    ST7789_Queue_Fill(x, y, w, h, color);
+}
+
+void TFT_full_DMA(uint16_t color)
+{
+    TFT_Fill_Rect_DMA(0, 0, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER, color);
+}
+
+void TFT_Clear_DMA(uint16_t color)
+{
+    TFT_full_DMA(color);
+}
+
+// ====================================================================
+// 첽 DMA 
+// ====================================================================
+
+typedef enum
+{
+    ST7789_OP_CMD = 0, //  +  (ֽں٣ֱѯ)
+    ST7789_OP_FILL,    // ɫ (16 λ DMAԴַ)
+    ST7789_OP_BLIT,    // ݿ (8 λ DMAԴַ)
+    ST7789_OP_BLIT16,  // ԭ 16 λݿ (16 λ DMAԴַ)
+    ST7789_OP_FENCE,   //  (ռߣֻص)
+    ST7789_OP_WAIT_TE, // TE բ (ȵһ TE ż)
+} ST7789_Op_Type_e;
+
+typedef struct
+{
+    ST7789_Op_Type_e       type;
+    uint8_t                cmd;                      // CMD: ֽ
+    uint8_t                argc;                     // CMD: 
+    uint8_t                args[ST7789_OP_MAX_ARGS]; // CMD: 
+    uint16_t               color;                    // FILL: DMA ֱӴȡ
+    const uint8_t*         src;                      // BLIT/BLIT16: һεԴַ
+    uint32_t               count;                    // ʣ (BLIT ΪֽڣΪ)
+    ST7789_Done_Callback_t cb;                       // ɻص (Ϊ NULL)
+    void*                  cb_arg;                   // ص
+} ST7789_Op_t;
+
+static ST7789_Op_t      s_op_queue[ST7789_QUEUE_DEPTH];
+static volatile uint8_t s_op_head   = 0; // дָ (ѭ)
+static volatile uint8_t s_op_tail   = 0; // ָ (жϳ)
+static volatile uint8_t s_dma_busy  = 0; // ͷ DMA 
+
+// TE ֡ͬ״̬
+static volatile uint8_t  s_te_armed     = 0; // ͷ TE բţڵȴ
+static volatile uint32_t s_te_armed_ms  = 0; // բſʼȴʱ
+static uint8_t           s_te_sync      = 0; // ֡ͬ
+static uint32_t          s_te_frame_te  = 0; // ֡ʱ TE 
+static ST7789_TE_Stats_t s_te_stats     = {0};
+#ifndef ST7789_TE_SIMULATED
+static uint8_t s_te_irq = 0; // TE жãʱһ
+#endif
+
+/**
+ * @brief  λȶеж (˽)
+ * @note   ֻԼ DMA жϣTE ж ST7789_TE_Init ֮Ų룬
+ *         Ѵδʼ EXTI жϴ
+ */
+static inline void ST7789_Lock(void)
+{
+    s_bus->lock();
+#ifndef ST7789_TE_SIMULATED
+    if (s_te_irq)
+        NVIC_DisableIRQ(ST7789_TE_IRQn);
+#endif
+}
+
+/**
+ * @brief  ָж (˽)
+ */
+static inline void ST7789_Unlock(void)
+{
+#ifndef ST7789_TE_SIMULATED
+    if (s_te_irq)
+        NVIC_EnableIRQ(ST7789_TE_IRQn);
+#endif
+    s_bus->unlock();
+}
+
+/**
+ * @brief  ͷ DMA һ (˽)
+ * @note   ֮ CS ֵ͵ƽĻһ
+ *         count/src ǰۼTC жֻжǷʣࡣ
+ */
+static void ST7789_DMA_Next_Segment(ST7789_Op_t* op)
+{
+    uint16_t seg = ST7789_DMA_Segment(op->count);
+
+    if (op->type == ST7789_OP_FILL)
+    {
+        s_bus->stream(&op->color, seg, 1, 0);
+    }
+    else if (op->type == ST7789_OP_BLIT16)
+    {
+        s_bus->stream(op->src, seg, 1, 1);
+        op->src += (uint32_t) seg * 2;
+    }
+    else
+    {
+        s_bus->stream(op->src, seg, 0, 1);
+        op->src += seg;
+    }
+    op->count -= seg;
+}
+
+/**
+ * @brief   + һ CS Чڷ (˽Уѯʽ)
+ */
+static void ST7789_Send_Cmd_Args(uint8_t cmd, const uint8_t* args, uint8_t argc)
+{
+    s_bus->begin();
+    s_bus->write_cmd(cmd);
+    if (argc)
+        s_bus->write_bytes(args, argc);
+    s_bus->end();
+}
+
+/**
+ * @brief  ͷӲִлص (˽)
+ * @note   ȡصƶָ룬Ӻòλ̱ѭ
+ */
+static void ST7789_Queue_Retire(void)
+{
+    ST7789_Done_Callback_t cb  = s_op_queue[s_op_tail].cb;
+    void*                  arg = s_op_queue[s_op_tail].cb_arg;
+
+    ST7789_DMB();
+    s_op_tail = (s_op_tail + 1) % ST7789_QUEUE_DEPTH;
+
+    if (cb)
+        cb(arg);
+}
+
+/**
+ * @brief  е (˽)
+ * @note   /Ͼ͵ִУ DMA 󷵻أ TC жϽ
+ *         ߱뱣֤ DMA жϲͬʱ (жûѹرոж)
+ */
+static void ST7789_Queue_Run(void)
+{
+    while (s_op_tail != s_op_head)
+    {
+        ST7789_Op_t* op = &s_op_queue[s_op_tail];
+
+        if (op->type == ST7789_OP_FILL || op->type == ST7789_OP_BLIT ||
+            op->type == ST7789_OP_BLIT16)
+        {
+            // ֻдֽҪ 8 λ֡඼ 16 λ֡
+            s_bus->set_16bit(op->type != ST7789_OP_BLIT);
+            s_bus->begin();
+
+            ST7789_DMA_Next_Segment(op);
+
+            s_dma_busy = 1;
+            return; // ʣµĽ TC ж
+        }
+
+        if (op->type == ST7789_OP_WAIT_TE)
+        {
+            // բţУ TE жϷ ( busy ־סӵ)
+            s_te_armed_ms = (uint32_t) BSP_GetTick_ms();
+            s_te_armed    = 1;
+            s_dma_busy    = 1;
+            return;
+        }
+
+        if (op->type == ST7789_OP_CMD)
+        {
+            s_bus->set_16bit(0);
+            ST7789_Send_Cmd_Args(op->cmd, op->args, op->argc);
+        }
+
+        ST7789_Queue_Retire();
+    }
+
+    // ſգָ 8 λģʽӿڿֱʹ
+    s_bus->set_16bit(0);
+}
+
+/**
+ * @brief  βλ (˽)
+ * @note   ʱæж֤Զɹ
+ */
+static ST7789_Op_t* ST7789_Queue_Alloc(ST7789_Op_Type_e type)
+{
+    uint8_t next = (s_op_head + 1) % ST7789_QUEUE_DEPTH;
+
+    while (next == s_op_tail)
+    {
+        ST7789_Frame_Release(); // п TE բʱCPU ܸɵһˢ
+        ST7789_Poll();
+    }
+
+    ST7789_Op_t* op = &s_op_queue[s_op_head];
+    op->type        = type;
+    op->cb          = NULL;
+    op->cb_arg      = NULL;
+    return op;
+}
+
+/**
+ * @brief  ύβλ (˽)
+ */
+static void ST7789_Queue_Commit(void)
+{
+    // λֶͨ洢жϿµдָ֮ǰȫ
+    ST7789_DMB();
+    s_op_head = (s_op_head + 1) % ST7789_QUEUE_DEPTH;
+
+    // ص DMA/TE жжæ״̬жͬʱ
+    ST7789_Lock();
+    if (!s_dma_busy)
+    {
+        ST7789_Queue_Run();
+    }
+    ST7789_Unlock();
+}
+
+void ST7789_Queue_Window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
+{
+    uint32_t col = ((uint32_t) x_start << 16) | x_end;
+    uint32_t row = ((uint32_t) y_start << 16) | y_end;
+    uint8_t  args[4];
+
+    if (col != s_win_col)
+    {
+        args[0] = x_start >> 8;
+        args[1] = x_start & 0xFF;
+        args[2] = x_end >> 8;
+        args[3] = x_end & 0xFF;
+        ST7789_Queue_Cmd(0x2A, args, 4);
+        s_win_col = col;
+    }
+
+    if (row != s_win_row)
+    {
+        args[0] = y_start >> 8;
+        args[1] = y_start & 0xFF;
+        args[2] = y_end >> 8;
+        args[3] = y_end & 0xFF;
+        ST7789_Queue_Cmd(0x2B, args, 4);
+        s_win_row = row;
+    }
+
+    ST7789_Queue_Cmd(0x2C, NULL, 0);
+}
+
+void ST7789_Queue_Cmd(uint8_t cmd, const uint8_t* args, uint8_t argc)
+{
+    if (argc > ST7789_OP_MAX_ARGS)
+        argc = ST7789_OP_MAX_ARGS;
+
+    ST7789_Window_Cache_Check(cmd);
+
+    ST7789_Op_t* op = ST7789_Queue_Alloc(ST7789_OP_CMD);
+    op->cmd         = cmd;
+    op->argc        = argc;
+    for (uint8_t i = 0; i < argc; i++)
+    {
+        op->args[i] = args[i];
+    }
+    ST7789_Queue_Commit();
+}
+
+void ST7789_Queue_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
     if (w == 0 || h == 0)
         return;
     if (x >= TFT_COLUMN_NUMBER || y >= TFT_LINE_NUMBER)
         return;
 
-    uint16_t x_end = x + w - 1;
-    uint16_t y_end = y + h - 1;
-
-    // 1. ûͼ (ʱ CS ںڲԶͣ CS Ϊ)
-    TFT_SEND_CMD(0x2A);
-    TFT_SEND_DATA(x >> 8);
-    TFT_SEND_DATA(x & 0xFF);
-    TFT_SEND_DATA(x_end >> 8);
-    TFT_SEND_DATA(x_end & 0xFF);
-
-    TFT_SEND_CMD(0x2B);
-    TFT_SEND_DATA(y >> 8);
-    TFT_SEND_DATA(y & 0xFF);
-    TFT_SEND_DATA(y_end >> 8);
-    TFT_SEND_DATA(y_end & 0xFF);
-
-    TFT_SEND_CMD(0x2C); // ׼д RAM
-
-    // [ؼ] л SPI ģʽ CS
-    // ʹлʱ SCK ẹ̈Ϊ CS=1ĻҲ
-
-    // A. ȴ߿
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
-        ;
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
-        ;
-
-    // B. л 16λ ģʽ (ʱ CS Ǹߵƽȫ)
-    SPI_Cmd(ST7789_SPI_PERIPH, DISABLE);
-    ST7789_SPI_PERIPH->CR1 |= SPI_CR1_DFF; // DFF=1
-    SPI_Cmd(ST7789_SPI_PERIPH, ENABLE);
-
-    // 2. ׼ʼ
-    LCD_DC_SET(); // ģʽ
-    LCD_CS_CLR(); //  CSʼʽͨ
-
-    // 3.  DMA (λֱ &color)
-    RCC_AHB1PeriphClockCmd(LCD_DMA_CLK, ENABLE);
-    DMA_DeInit(LCD_DMA_STREAM);
-
-    DMA_InitTypeDef DMA_InitStructure;
-    DMA_InitStructure.DMA_Channel            = LCD_DMA_CHANNEL;
-    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &ST7789_SPI_PERIPH->DR;
-    DMA_InitStructure.DMA_Memory0BaseAddr    = (uint32_t) &color; // ԭ˳򼴿
-    DMA_InitStructure.DMA_DIR                = DMA_DIR_MemoryToPeripheral;
-    DMA_InitStructure.DMA_BufferSize         = (uint32_t) w * h;
-    DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
-    DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Disable; // Դַ
-    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
-    DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
-    DMA_InitStructure.DMA_Mode               = DMA_Mode_Normal;
-    DMA_InitStructure.DMA_Priority           = DMA_Priority_VeryHigh;
-    DMA_InitStructure.DMA_FIFOMode           = DMA_FIFOMode_Disable;
-    DMA_InitStructure.DMA_FIFOThreshold      = DMA_FIFOThreshold_Full;
-    DMA_InitStructure.DMA_MemoryBurst        = DMA_MemoryBurst_Single;
-    DMA_InitStructure.DMA_PeripheralBurst    = DMA_PeripheralBurst_Single;
-
-    DMA_Init(LCD_DMA_STREAM, &DMA_InitStructure);
-
-    // 4.  DMA
-    SPI_I2S_DMACmd(ST7789_SPI_PERIPH, SPI_I2S_DMAReq_Tx, ENABLE);
-    DMA_Cmd(LCD_DMA_STREAM, ENABLE);
-
-    // 5. ȴ
-    while (DMA_GetFlagStatus(LCD_DMA_STREAM, LCD_DMA_FLAG_TC) == RESET)
-        ;
-
-    // 6. 
-    DMA_ClearFlag(LCD_DMA_STREAM, LCD_DMA_FLAG_TC);
-    DMA_Cmd(LCD_DMA_STREAM, DISABLE);
-    SPI_I2S_DMACmd(ST7789_SPI_PERIPH, SPI_I2S_DMAReq_Tx, DISABLE);
-
-    // ȴ SPI һλ
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
-        ;
-    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
-        ;
-
-    // 7. ͨ
-    LCD_CS_SET(); //  CSκ
-
-    // [ؼ] ָ 8λ ģʽ (ʱ CS Ϊ)
-    SPI_Cmd(ST7789_SPI_PERIPH, DISABLE);
-    ST7789_SPI_PERIPH->CR1 &= ~SPI_CR1_DFF; // DFF=0
-    SPI_Cmd(ST7789_SPI_PERIPH, ENABLE);
+    // ߽ü ( TFT_Fill_Rect һ)
+    if (x + w > TFT_COLUMN_NUMBER)
+        w = TFT_COLUMN_NUMBER - x;
+    if (y + h > TFT_LINE_NUMBER)
+        h = TFT_LINE_NUMBER - y;
+
+    if (ST7789_FB8_Fill(x, y, w, h, color) || ST7789_Tile_Fill(x, y, w, h, color))
+        return;
+
+    ST7789_Queue_Window(x, y, x + w - 1, y + h - 1);
+
+    //  NDTR ޵ ( 240x320 = 76800 )  TC жϷֶ
+    ST7789_Op_t* op = ST7789_Queue_Alloc(ST7789_OP_FILL);
+    op->color       = color;
+    op->count       = (uint32_t) w * h;
+    ST7789_Queue_Commit();
 }
 
-void TFT_full_DMA(uint16_t color)
+void ST7789_Queue_Blit(uint16_t               x,
+                       uint16_t               y,
+                       uint16_t               w,
+                       uint16_t               h,
+                       const uint8_t*         data,
+                       ST7789_Done_Callback_t cb,
+                       void*                  arg)
 {
-    TFT_Fill_Rect_DMA(0, 0, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER, color);
+    if (w == 0 || h == 0 || data == NULL)
+        return;
+
+    if (ST7789_FB8_Blit(x, y, w, h, data, 0) || ST7789_Tile_Blit(x, y, w, h, data, 0))
+    {
+        if (cb)
+            cb(arg); // ѿƬԴͷ
+        return;
+    }
+
+    ST7789_Queue_Window(x, y, x + w - 1, y + h - 1);
+
+    // ֽڼ (8 λ֡) NDTR  TC жϷֶ
+    ST7789_Op_t* op = ST7789_Queue_Alloc(ST7789_OP_BLIT);
+    op->src         = data;
+    op->count       = (uint32_t) w * h * 2;
+    op->cb          = cb;
+    op->cb_arg      = arg;
+    ST7789_Queue_Commit();
 }
 
-void TFT_Clear_DMA(uint16_t color)
+void ST7789_Queue_Blit16(uint16_t               x,
+                         uint16_t               y,
+                         uint16_t               w,
+                         uint16_t               h,
+                         const uint16_t*        data,
+                         ST7789_Done_Callback_t cb,
+                         void*                  arg)
 {
-    TFT_full_DMA(color);
-}
\ No newline at end of file
+    if (w == 0 || h == 0 || data == NULL)
+        return;
+
+    if (ST7789_FB8_Blit(x, y, w, h, (const uint8_t*) data, 1) ||
+        ST7789_Tile_Blit(x, y, w, h, (const uint8_t*) data, 1))
+    {
+        if (cb)
+            cb(arg);
+        return;
+    }
+
+    ST7789_Queue_Window(x, y, x + w - 1, y + h - 1);
+    ST7789_Queue_Pixels(data, (uint32_t) w * h, cb, arg);
+}
+
+void ST7789_Queue_Pixels(const uint16_t*        data,
+                         uint32_t               count,
+                         ST7789_Done_Callback_t cb,
+                         void*                  arg)
+{
+    if (count == 0 || data == NULL)
+        return;
+
+    // ؼ (16 λ֡)DMA ֻ 8 λֽһ
+    ST7789_Op_t* op = ST7789_Queue_Alloc(ST7789_OP_BLIT16);
+    op->src         = (const uint8_t*) data;
+    op->count       = count;
+    op->cb          = cb;
+    op->cb_arg      = arg;
+    ST7789_Queue_Commit();
+}
+
+void ST7789_Queue_Fence(ST7789_Done_Callback_t cb, void* arg)
+{
+    ST7789_Op_t* op = ST7789_Queue_Alloc(ST7789_OP_FENCE);
+    op->cb          = cb;
+    op->cb_arg      = arg;
+    ST7789_Queue_Commit();
+}
+
+void ST7789_Flush(void)
+{
+    while (s_op_tail != s_op_head)
+    {
+        ST7789_Poll(); // TE ûʱԶբ
+    }
+}
+
+uint8_t ST7789_Is_Busy(void)
+{
+    return (s_op_tail != s_op_head) ? 1 : 0;
+}
+
+// ====================================================================
+// Ӳֱ
+// ====================================================================
+
+static uint16_t s_scroll_top    = 0;               // ̶
+static uint16_t s_scroll_height = TFT_LINE_NUMBER; // 
+static uint16_t s_scroll_offset = 0;               // ǰƫ (0 ~ height-1)
+
+/**
+ * @brief  ͹ʼַ (˽)
+ */
+static void ST7789_Scroll_Send_Start(void)
+{
+    uint16_t vsp = s_scroll_top + s_scroll_offset;
+    uint8_t  args[2];
+
+    args[0] = vsp >> 8;
+    args[1] = vsp & 0xFF;
+    ST7789_Queue_Cmd(0x37, args, 2); // Vertical Scroll Start Address
+}
+
+void ST7789_Scroll_Define(uint16_t top_fixed, uint16_t height)
+{
+    if (top_fixed >= TFT_LINE_NUMBER)
+        return;
+    if (height == 0 || top_fixed + height > TFT_LINE_NUMBER)
+        height = TFT_LINE_NUMBER - top_fixed;
+
+    uint16_t bottom_fixed = TFT_LINE_NUMBER - top_fixed - height;
+    uint8_t  args[6];
+
+    args[0] = top_fixed >> 8;
+    args[1] = top_fixed & 0xFF;
+    args[2] = height >> 8;
+    args[3] = height & 0xFF;
+    args[4] = bottom_fixed >> 8;
+    args[5] = bottom_fixed & 0xFF;
+    ST7789_Queue_Cmd(0x33, args, 6); // Vertical Scrolling Definition
+
+    s_scroll_top    = top_fixed;
+    s_scroll_height = height;
+    s_scroll_offset = 0;
+    ST7789_Scroll_Send_Start();
+}
+
+uint16_t ST7789_Scroll_Advance(uint16_t lines)
+{
+    // ¶оƽǰλڹǼԴ
+    uint16_t exposed = s_scroll_top + s_scroll_offset;
+
+    if (lines == 0)
+        return exposed;
+    if (lines > s_scroll_height)
+        lines = s_scroll_height;
+
+    s_scroll_offset = (s_scroll_offset + lines) % s_scroll_height;
+    ST7789_Scroll_Send_Start();
+
+    return exposed;
+}
+
+uint16_t ST7789_Scroll_Map_Row(uint16_t screen_y)
+{
+    if (screen_y < s_scroll_top || screen_y >= s_scroll_top + s_scroll_height)
+        return screen_y; // ̶ܹӰ
+
+    return s_scroll_top + (screen_y - s_scroll_top + s_scroll_offset) % s_scroll_height;
+}
+
+void ST7789_Scroll_Reset(void)
+{
+    ST7789_Scroll_Define(0, TFT_LINE_NUMBER);
+}
+
+void ST7789_Bus_Stream_Done(void)
+{
+    // ʣݣװһΣCS Чж
+    if (s_op_queue[s_op_tail].count > 0)
+    {
+        ST7789_DMA_Next_Segment(&s_op_queue[s_op_tail]);
+        return;
+    }
+
+    // βǰֱӵһʵֲ֮޷
+    s_bus->end();
+
+    s_dma_busy = 0;
+    ST7789_Queue_Retire();
+    ST7789_Queue_Run();
+}
+
+// ====================================================================
+// TE ͬ֡
+// ====================================================================
+
+/**
+ * @brief   TE բŲ (˽)
+ * @note   ֤߱ DMA/TE жϲͬʱ
+ */
+static void ST7789_TE_Release(void)
+{
+    s_te_armed    = 0;
+    s_dma_busy    = 0;
+    s_te_frame_te = s_te_stats.te_count;
+    ST7789_Queue_Retire();
+    ST7789_Queue_Run();
+}
+
+/**
+ * @brief  TE 崦 (EXTI жϻ涨ʱ)
+ */
+static void ST7789_TE_On_Pulse(void)
+{
+    s_te_stats.te_count++;
+
+    if (s_te_armed)
+        ST7789_TE_Release();
+}
+
+void ST7789_Poll(void)
+{
+    if (s_bus->poll)
+        s_bus->poll();
+
+    if (!s_te_armed || (uint32_t) BSP_GetTick_ms() - s_te_armed_ms < ST7789_TE_TIMEOUT_MS)
+        return;
+
+    ST7789_Lock();
+    if (s_te_armed)
+    {
+        // һֱղ TEûӣвرͬ˻Ϊ
+        s_te_stats.timeouts++;
+        s_te_sync = 0;
+        ST7789_TE_Release();
+    }
+    ST7789_Unlock();
+}
+
+/**
+ * @brief  ֡ϻص (ж)
+ */
+static void ST7789_TE_Frame_Done(void* arg)
+{
+    s_te_stats.frames++;
+
+    // ֮ TE֡дԽˢڣ˺
+    if (s_te_stats.te_count != s_te_frame_te)
+        s_te_stats.missed++;
+}
+
+void ST7789_TE_Init(uint16_t scanline)
+{
+#ifndef ST7789_TE_SIMULATED
+    GPIO_InitTypeDef GPIO_InitStructure;
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(ST7789_TE_CLK, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+
+    GPIO_InitStructure.GPIO_Pin   = ST7789_TE_PIN;
+    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_IN;
+    GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_DOWN;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(ST7789_TE_PORT, &GPIO_InitStructure);
+
+    SYSCFG_EXTILineConfig(ST7789_TE_PORT_SOURCE, ST7789_TE_PIN_SOURCE);
+
+    EXTI_InitStructure.EXTI_Line    = ST7789_TE_EXTI_LINE;
+    EXTI_InitStructure.EXTI_Mode    = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel                   = ST7789_TE_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = LCD_TE_IRQ_PRIORITY;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority        = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd                = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    s_te_irq = 1;
+#endif
+
+    uint8_t mode = 0x00; // TEON 0 = ֻ V-Blank Ϣ
+    ST7789_Queue_Cmd(0x35, &mode, 1); // Tearing Effect Line On
+    ST7789_TE_Set_Scanline(scanline);
+
+    s_te_sync = 1;
+}
+
+void ST7789_TE_Set_Scanline(uint16_t scanline)
+{
+    uint8_t args[2];
+
+    if (scanline >= TFT_LINE_NUMBER)
+        scanline = TFT_LINE_NUMBER - 1;
+
+    args[0] = scanline >> 8;
+    args[1] = scanline & 0xFF;
+    ST7789_Queue_Cmd(0x44, args, 2); // Set Tear Scanline
+}
+
+void ST7789_TE_Sync(uint8_t enable)
+{
+    s_te_sync = enable ? 1 : 0;
+}
+
+void ST7789_Frame_Begin(void)
+{
+    ST7789_Poll();
+
+    if (!s_te_sync)
+        return;
+
+    ST7789_Queue_Alloc(ST7789_OP_WAIT_TE);
+    ST7789_Queue_Commit();
+}
+
+void ST7789_Frame_Release(void)
+{
+    if (!s_te_armed)
+        return;
+
+    ST7789_Lock();
+    if (s_te_armed)
+    {
+        s_te_stats.early++;
+        ST7789_TE_Release();
+    }
+    ST7789_Unlock();
+}
+
+void ST7789_Frame_End(void)
+{
+    if (!s_te_sync)
+        return;
+
+    ST7789_Queue_Fence(ST7789_TE_Frame_Done, NULL);
+}
+
+void ST7789_TE_Get_Stats(ST7789_TE_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_te_stats;
+}
+
+#ifdef ST7789_TE_SIMULATED
+
+static uint32_t s_te_sim_us = 0; // һ TE ʱ
+
+void ST7789_TE_Sim_Advance(uint32_t us)
+{
+    s_te_sim_us += us;
+    while (s_te_sim_us >= ST7789_TE_SIM_PERIOD_US)
+    {
+        s_te_sim_us -= ST7789_TE_SIM_PERIOD_US;
+        ST7789_TE_On_Pulse();
+    }
+}
+
+#else
+
+/**
+ * @brief  EXTI4 жϷ (TE )
+ */
+void ST7789_TE_IRQHandler(void)
+{
+    if (EXTI_GetITStatus(ST7789_TE_EXTI_LINE) == RESET)
+        return;
+
+    EXTI_ClearITPendingBit(ST7789_TE_EXTI_LINE);
+    ST7789_TE_On_Pulse();
+}
+
+#endif /* ST7789_TE_SIMULATED */
@@ -0,0 +1,322 @@
+/**
+ * @file    st7789_bus_emu.c
+ * @brief   ST7789 传输层：主机仿真后端
+ * @note    只在定义 ST7789_BUS_EMU 的主机构建中编译。线上的每个字节都送进一个
+ *          简化的 ST7789 命令解码器，像素写进 240x320 的显存数组，
+ *          绘制结果可以导出 PPM 与基准图比对，统计值用于衡量渲染开销。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+
+#ifdef ST7789_BUS_EMU
+
+#include <stdio.h>
+#include <string.h>
+
+#define EMU_MADCTL_MY 0x80 // 行地址反向
+#define EMU_MADCTL_MX 0x40 // 列地址反向
+#define EMU_MADCTL_MV 0x20 // 行列交换
+
+static uint16_t           s_emu_fb[TFT_LINE_NUMBER][TFT_COLUMN_NUMBER]; // 仿真显存
+static ST7789_Emu_Stats_t s_emu_stats;
+
+// 命令解码状态
+static uint8_t  s_emu_cmd     = 0;    // 当前命令
+static uint8_t  s_emu_args[4] = {0};  // 已收到的参数
+static uint8_t  s_emu_argc    = 0;    // 已收到的参数个数
+static uint8_t  s_emu_madctl  = 0x00; // MADCTL 当前值
+static uint16_t s_emu_xs = 0, s_emu_xe = TFT_COLUMN_NUMBER - 1; // CASET
+static uint16_t s_emu_ys = 0, s_emu_ye = TFT_LINE_NUMBER - 1;   // RASET
+static uint16_t s_emu_x = 0, s_emu_y = 0; // RAMWR 写指针 (地址空间坐标)
+static uint8_t  s_emu_hi       = 0;       // 像素高字节
+static uint8_t  s_emu_hi_valid = 0;       // 已收到高字节，等待低字节
+
+static volatile uint8_t s_emu_stream_pending = 0; // 流传输已完成，等待 poll 通知驱动
+
+/**
+ * @brief  写一个像素到显存 (私有)
+ * @note   按 MADCTL 把地址空间坐标映射到物理显存，越界像素丢弃
+ */
+static void Emu_Put_Pixel(uint16_t color)
+{
+    uint8_t  mv = (s_emu_madctl & EMU_MADCTL_MV) ? 1 : 0;
+    uint16_t aw = mv ? TFT_LINE_NUMBER : TFT_COLUMN_NUMBER; // 地址空间宽
+    uint16_t ah = mv ? TFT_COLUMN_NUMBER : TFT_LINE_NUMBER; // 地址空间高
+    uint16_t c  = s_emu_x;
+    uint16_t r  = s_emu_y;
+
+    if (c < aw && r < ah)
+    {
+        if (s_emu_madctl & EMU_MADCTL_MX)
+            c = aw - 1 - c;
+        if (s_emu_madctl & EMU_MADCTL_MY)
+            r = ah - 1 - r;
+
+        if (mv)
+            s_emu_fb[c][r] = color;
+        else
+            s_emu_fb[r][c] = color;
+    }
+    s_emu_stats.pixels++;
+
+    // 写指针在窗口内按行前进，到达窗口末尾回绕到左上角
+    if (s_emu_x >= s_emu_xe)
+    {
+        s_emu_x = s_emu_xs;
+        s_emu_y = (s_emu_y >= s_emu_ye) ? s_emu_ys : s_emu_y + 1;
+    }
+    else
+    {
+        s_emu_x++;
+    }
+}
+
+/**
+ * @brief  处理一个数据字节 (私有，DC = 1)
+ */
+static void Emu_Data_Byte(uint8_t byte)
+{
+    s_emu_stats.bytes++;
+
+    switch (s_emu_cmd)
+    {
+    case 0x2C: // RAMWR
+    case 0x3C: // RAMWRC
+        if (!s_emu_hi_valid)
+        {
+            s_emu_hi       = byte;
+            s_emu_hi_valid = 1;
+            return;
+        }
+        s_emu_hi_valid = 0;
+        Emu_Put_Pixel((uint16_t) ((s_emu_hi << 8) | byte));
+        return;
+
+    case 0x2A: // CASET
+    case 0x2B: // RASET
+        if (s_emu_argc < 4)
+            s_emu_args[s_emu_argc++] = byte;
+        if (s_emu_argc == 4)
+        {
+            uint16_t start = (uint16_t) ((s_emu_args[0] << 8) | s_emu_args[1]);
+            uint16_t end   = (uint16_t) ((s_emu_args[2] << 8) | s_emu_args[3]);
+            if (s_emu_cmd == 0x2A)
+            {
+                s_emu_xs = start;
+                s_emu_xe = end;
+            }
+            else
+            {
+                s_emu_ys = start;
+                s_emu_ye = end;
+            }
+        }
+        return;
+
+    case 0x36: // MADCTL
+        if (s_emu_argc++ == 0)
+            s_emu_madctl = byte;
+        return;
+
+    default: // 其余命令的参数只计数
+        return;
+    }
+}
+
+/**
+ * @brief  处理一个命令字节 (私有，DC = 0)
+ */
+static void Emu_Command(uint8_t cmd)
+{
+    s_emu_stats.commands++;
+    s_emu_stats.bytes++;
+
+    s_emu_cmd      = cmd;
+    s_emu_argc     = 0;
+    s_emu_hi_valid = 0;
+
+    if (cmd == 0x2C)
+    {
+        // RAMWR：写指针回到窗口左上角
+        s_emu_stats.windows++;
+        s_emu_x = s_emu_xs;
+        s_emu_y = s_emu_ys;
+    }
+}
+
+// ====================================================================
+// 传输层函数表实现
+// ====================================================================
+static void Emu_Bus_Init(void)
+{
+    memset(s_emu_fb, 0, sizeof(s_emu_fb));
+    memset(&s_emu_stats, 0, sizeof(s_emu_stats));
+    s_emu_madctl         = 0x00;
+    s_emu_xs             = 0;
+    s_emu_xe             = TFT_COLUMN_NUMBER - 1;
+    s_emu_ys             = 0;
+    s_emu_ye             = TFT_LINE_NUMBER - 1;
+    s_emu_cmd            = 0;
+    s_emu_stream_pending = 0;
+}
+
+static void Emu_Bus_Reset(uint8_t level)
+{
+    // 硬件复位：寄存器回到默认值 (显存内容保留，与实际屏幕一致)
+    if (!level)
+    {
+        s_emu_madctl = 0x00;
+        s_emu_cmd    = 0;
+    }
+}
+
+static void Emu_Bus_Begin(void)
+{
+    s_emu_stats.cs_toggles++;
+}
+
+static void Emu_Bus_End(void)
+{
+}
+
+static void Emu_Bus_Write_Bytes(const uint8_t* data, uint32_t len)
+{
+    while (len--)
+    {
+        Emu_Data_Byte(*data++);
+    }
+}
+
+static void Emu_Bus_Write_Repeat(uint16_t pixel, uint32_t count)
+{
+    while (count--)
+    {
+        Emu_Data_Byte(pixel >> 8);
+        Emu_Data_Byte(pixel & 0xFF);
+    }
+}
+
+static void Emu_Bus_Set_16bit(uint8_t enable)
+{
+    // 16 位帧在线上同样是高字节在前，仿真无需区分
+}
+
+static void Emu_Bus_Stream(const void* src, uint16_t count, uint8_t halfword, uint8_t mem_inc)
+{
+    s_emu_stats.streams++;
+
+    if (halfword)
+    {
+        const uint16_t* p = (const uint16_t*) src;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            Emu_Data_Byte(*p >> 8);
+            Emu_Data_Byte(*p & 0xFF);
+            if (mem_inc)
+                p++;
+        }
+    }
+    else
+    {
+        const uint8_t* p = (const uint8_t*) src;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            Emu_Data_Byte(*p);
+            if (mem_inc)
+                p++;
+        }
+    }
+
+    // 数据已经 "发完"，但不能在这里直接通知驱动 (调度器还没返回)，留给 poll
+    s_emu_stream_pending = 1;
+}
+
+static void Emu_Bus_Lock(void)
+{
+}
+
+static void Emu_Bus_Unlock(void)
+{
+}
+
+static void Emu_Bus_Poll(void)
+{
+    if (!s_emu_stream_pending)
+        return;
+
+    s_emu_stream_pending = 0;
+    ST7789_Bus_Stream_Done();
+}
+
+const ST7789_Bus_t g_st7789_bus_emu = {
+    .name         = "emu",
+    .init         = Emu_Bus_Init,
+    .reset        = Emu_Bus_Reset,
+    .begin        = Emu_Bus_Begin,
+    .end          = Emu_Bus_End,
+    .write_cmd    = Emu_Command,
+    .write_bytes  = Emu_Bus_Write_Bytes,
+    .write_repeat = Emu_Bus_Write_Repeat,
+    .set_16bit    = Emu_Bus_Set_16bit,
+    .stream       = Emu_Bus_Stream,
+    .lock         = Emu_Bus_Lock,
+    .unlock       = Emu_Bus_Unlock,
+    .poll         = Emu_Bus_Poll,
+};
+
+// ====================================================================
+// 仿真查询接口
+// ====================================================================
+const uint16_t* ST7789_Emu_Framebuffer(void)
+{
+    return &s_emu_fb[0][0];
+}
+
+void ST7789_Emu_Get_Stats(ST7789_Emu_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_emu_stats;
+}
+
+void ST7789_Emu_Reset_Stats(void)
+{
+    memset(&s_emu_stats, 0, sizeof(s_emu_stats));
+}
+
+int ST7789_Emu_Dump_PPM(const char* path)
+{
+    FILE* fp = fopen(path, "wb");
+    if (!fp)
+        return -1;
+
+    fprintf(fp, "P6\n%d %d\n255\n", TFT_COLUMN_NUMBER, TFT_LINE_NUMBER);
+
+    for (uint16_t y = 0; y < TFT_LINE_NUMBER; y++)
+    {
+        uint8_t rgb[TFT_COLUMN_NUMBER * 3];
+
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+        {
+            uint16_t c = s_emu_fb[y][x];
+            uint8_t  r = (c >> 11) & 0x1F;
+            uint8_t  g = (c >> 5) & 0x3F;
+            uint8_t  b = c & 0x1F;
+
+            // 位扩展到 8 位：高位复制到低位，保证 0x1F -> 0xFF
+            rgb[x * 3 + 0] = (uint8_t) ((r << 3) | (r >> 2));
+            rgb[x * 3 + 1] = (uint8_t) ((g << 2) | (g >> 4));
+            rgb[x * 3 + 2] = (uint8_t) ((b << 3) | (b >> 2));
+        }
+        if (fwrite(rgb, 1, sizeof(rgb), fp) != sizeof(rgb))
+        {
+            fclose(fp);
+            return -1;
+        }
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+#endif /* ST7789_BUS_EMU */
@@ -0,0 +1,478 @@
+/**
+ * @file    st7789_bus_fsmc.c
+ * @brief   ST7789 传输层：FSMC 8080 16 位并口后端
+ * @note    命令/数据都是对 FSMC 地址窗口的一次 16 位写，由 FSMC 自动产生 CS/WR 时序；
+ *          填充与原生 16 位搬运交给 DMA2 存储器到存储器传输 (目的地址固定为数据地址)；
+ *          大端字节流先按块换成原生像素放进 SRAM 中转缓冲，再同样由 DMA 搬运，
+ *          传输完成中断里 CPU 只做一块的字节交换，不逐个写 FSMC。
+ *          定义 ST7789_FSMC_MOCK 时 (主机构建) 地址窗口换成一段写记录，
+ *          DMA 改为立即拷贝 + poll 通知，用于离线核对命令流。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_pix.h"
+#include <stddef.h>
+
+#if defined(ST7789_BUS_FSMC) || defined(ST7789_FSMC_MOCK)
+
+/**
+ * @brief 字节流中转缓冲容量 (像素)
+ * @note  每块在传输完成中断里交换一次字节序 (约 1us)，FSMC 写入 (每像素约 71ns) 交给 DMA
+ */
+#define FSMC_BOUNCE_PIXELS 256
+
+static uint8_t          s_fsmc_hi       = 0; // 字节流中等待配对的像素高字节
+static uint8_t          s_fsmc_hi_valid = 0;
+static volatile uint8_t s_fsmc_sw_done  = 0; // 没有启动 DMA 就完成的流传输，等待通知驱动
+
+// 字节流 (大端 RGB565) 当前段的进度
+static const uint8_t* s_fsmc_bs_src  = NULL; // 下一个未处理的字节
+static uint32_t       s_fsmc_bs_left = 0;    // 本段剩余字节数
+static uint8_t        s_fsmc_bs_inc  = 0;    // 源地址是否自增
+
+static uint16_t s_fsmc_bounce[FSMC_BOUNCE_PIXELS] __attribute__((aligned(4))); // 中转缓冲
+
+#ifdef ST7789_FSMC_MOCK
+
+static ST7789_FSMC_Mock_Write_t s_fsmc_mock_log[ST7789_FSMC_MOCK_DEPTH];
+static uint32_t                 s_fsmc_mock_count = 0;
+
+/**
+ * @brief  模拟一次 FSMC 写 (私有)
+ */
+static inline void FSMC_Write(uint8_t dc, uint16_t value)
+{
+    if (s_fsmc_mock_count < ST7789_FSMC_MOCK_DEPTH)
+    {
+        s_fsmc_mock_log[s_fsmc_mock_count].dc    = dc;
+        s_fsmc_mock_log[s_fsmc_mock_count].value = value;
+    }
+    s_fsmc_mock_count++;
+}
+
+#else
+
+#define FSMC_CMD_REG (*(volatile uint16_t*) ST7789_FSMC_CMD_ADDR)
+#define FSMC_DATA_REG (*(volatile uint16_t*) ST7789_FSMC_DATA_ADDR)
+
+/**
+ * @brief Stream0 的全部中断标志 (启动前统一清除)
+ */
+#define LCD_FSMC_DMA_FLAG_ALL                                                                      \
+    (DMA_FLAG_TCIF0 | DMA_FLAG_HTIF0 | DMA_FLAG_TEIF0 | DMA_FLAG_DMEIF0 | DMA_FLAG_FEIF0)
+
+/**
+ * @brief  FSMC 写 (私有)
+ */
+static inline void FSMC_Write(uint8_t dc, uint16_t value)
+{
+    if (dc)
+        FSMC_DATA_REG = value;
+    else
+        FSMC_CMD_REG = value;
+}
+
+// ====================================================================
+// 硬件层初始化 (私有函数)
+// ====================================================================
+static void ST7789_FSMC_GPIO_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    // FSMC 引脚：D0~D15, NOE, NWE, A6(RS), NE4(CS)
+    const uint16_t port_d = GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_4 | GPIO_Pin_5 | GPIO_Pin_8 |
+                            GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_14 | GPIO_Pin_15;
+    const uint16_t port_e = GPIO_Pin_7 | GPIO_Pin_8 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 |
+                            GPIO_Pin_12 | GPIO_Pin_13 | GPIO_Pin_14 | GPIO_Pin_15;
+
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB | RCC_AHB1Periph_GPIOD | RCC_AHB1Periph_GPIOE |
+                               RCC_AHB1Periph_GPIOF | RCC_AHB1Periph_GPIOG,
+                           ENABLE);
+
+    // 1. 控制引脚 (RST, BL) 仍为普通输出
+    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+
+    GPIO_InitStructure.GPIO_Pin = ST7789_RST_PIN;
+    GPIO_Init(ST7789_RST_PORT, &GPIO_InitStructure);
+
+    GPIO_InitStructure.GPIO_Pin = ST7789_BL_PIN;
+    GPIO_Init(ST7789_BL_PORT, &GPIO_InitStructure);
+    LCD_BL_SET(); // 点亮背光
+
+    // 2. FSMC 复用引脚
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+
+    GPIO_InitStructure.GPIO_Pin = port_d;
+    GPIO_Init(GPIOD, &GPIO_InitStructure);
+    GPIO_InitStructure.GPIO_Pin = port_e;
+    GPIO_Init(GPIOE, &GPIO_InitStructure);
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_12;
+    GPIO_Init(GPIOF, &GPIO_InitStructure); // A6
+    GPIO_Init(GPIOG, &GPIO_InitStructure); // NE4
+
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if (port_d & (1U << pin))
+            GPIO_PinAFConfig(GPIOD, pin, GPIO_AF_FSMC);
+        if (port_e & (1U << pin))
+            GPIO_PinAFConfig(GPIOE, pin, GPIO_AF_FSMC);
+    }
+    GPIO_PinAFConfig(GPIOF, GPIO_PinSource12, GPIO_AF_FSMC);
+    GPIO_PinAFConfig(GPIOG, GPIO_PinSource12, GPIO_AF_FSMC);
+}
+
+static void ST7789_FSMC_Init(void)
+{
+    FSMC_NORSRAMInitTypeDef       FSMC_InitStructure;
+    FSMC_NORSRAMTimingInitTypeDef FSMC_Timing;
+
+    RCC_AHB3PeriphClockCmd(RCC_AHB3Periph_FSMC, ENABLE);
+
+    // 模式 A，HCLK = 168MHz (5.95ns)：写周期 = ADDSET + DATAST + 1 = 12 HCLK ≈ 71ns
+    // ST7789 要求 twc >= 66ns，twrl/twrh >= 15ns
+    FSMC_Timing.FSMC_AddressSetupTime      = 4;
+    FSMC_Timing.FSMC_AddressHoldTime       = 0;
+    FSMC_Timing.FSMC_DataSetupTime         = 7;
+    FSMC_Timing.FSMC_BusTurnAroundDuration = 0;
+    FSMC_Timing.FSMC_CLKDivision           = 0;
+    FSMC_Timing.FSMC_DataLatency           = 0;
+    FSMC_Timing.FSMC_AccessMode            = FSMC_AccessMode_A;
+
+    FSMC_InitStructure.FSMC_Bank                  = ST7789_FSMC_BANK;
+    FSMC_InitStructure.FSMC_DataAddressMux        = FSMC_DataAddressMux_Disable;
+    FSMC_InitStructure.FSMC_MemoryType            = FSMC_MemoryType_SRAM;
+    FSMC_InitStructure.FSMC_MemoryDataWidth       = FSMC_MemoryDataWidth_16b;
+    FSMC_InitStructure.FSMC_BurstAccessMode       = FSMC_BurstAccessMode_Disable;
+    FSMC_InitStructure.FSMC_AsynchronousWait      = FSMC_AsynchronousWait_Disable;
+    FSMC_InitStructure.FSMC_WaitSignalPolarity    = FSMC_WaitSignalPolarity_Low;
+    FSMC_InitStructure.FSMC_WrapMode              = FSMC_WrapMode_Disable;
+    FSMC_InitStructure.FSMC_WaitSignalActive      = FSMC_WaitSignalActive_BeforeWaitState;
+    FSMC_InitStructure.FSMC_WriteOperation        = FSMC_WriteOperation_Enable;
+    FSMC_InitStructure.FSMC_WaitSignal            = FSMC_WaitSignal_Disable;
+    FSMC_InitStructure.FSMC_ExtendedMode          = FSMC_ExtendedMode_Disable;
+    FSMC_InitStructure.FSMC_WriteBurst            = FSMC_WriteBurst_Disable;
+    FSMC_InitStructure.FSMC_ReadWriteTimingStruct = &FSMC_Timing;
+    FSMC_InitStructure.FSMC_WriteTimingStruct     = &FSMC_Timing;
+    FSMC_NORSRAMInit(&FSMC_InitStructure);
+
+    FSMC_NORSRAMCmd(ST7789_FSMC_BANK, ENABLE);
+}
+
+/**
+ * @brief  DMA2 存储器到存储器的一次性配置 (私有)
+ * @note   M2M 模式下 "外设" 端是源 (PINC 决定源地址是否自增)，"存储器" 端是目的；
+ *         M2M 不允许直接模式，必须开 FIFO
+ */
+static void ST7789_FSMC_DMA_Init(void)
+{
+    DMA_InitTypeDef  DMA_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(LCD_FSMC_DMA_CLK, ENABLE);
+    DMA_DeInit(LCD_FSMC_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel            = LCD_FSMC_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = 0;
+    DMA_InitStructure.DMA_Memory0BaseAddr    = ST7789_FSMC_DATA_ADDR;
+    DMA_InitStructure.DMA_DIR                = DMA_DIR_MemoryToMemory;
+    DMA_InitStructure.DMA_BufferSize         = 1;
+    DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Enable;
+    DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Disable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode               = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority           = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode           = DMA_FIFOMode_Enable;
+    DMA_InitStructure.DMA_FIFOThreshold      = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst        = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst    = DMA_PeripheralBurst_Single;
+    DMA_Init(LCD_FSMC_DMA_STREAM, &DMA_InitStructure);
+
+    DMA_ITConfig(LCD_FSMC_DMA_STREAM, DMA_IT_TC, ENABLE);
+
+    NVIC_InitStructure.NVIC_IRQChannel                   = LCD_FSMC_DMA_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = LCD_DMA_IRQ_PRIORITY;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority        = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd                = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+#endif /* ST7789_FSMC_MOCK */
+
+/**
+ * @brief  没有启动 DMA 的流传输：挂起 DMA 中断，由中断统一通知驱动 (私有)
+ * @note   与 DMA 完成走同一条路径，调用者 (可能已在中断里) 返回后才进入调度
+ */
+static void FSMC_Stream_Done_Soft(void)
+{
+    s_fsmc_sw_done = 1;
+#ifndef ST7789_FSMC_MOCK
+    NVIC_SetPendingIRQ(LCD_FSMC_DMA_IRQn);
+#endif
+}
+
+/**
+ * @brief  启动一次 16 位 DMA 搬运到数据地址 (私有)
+ * @param  src: 源地址
+ * @param  count: 半字数
+ * @param  inc: 源地址是否自增
+ */
+static void FSMC_DMA_Start(const void* src, uint16_t count, uint8_t inc)
+{
+#ifdef ST7789_FSMC_MOCK
+    // 模拟：立即写完，完成通知留给 poll
+    const uint16_t* p = (const uint16_t*) src;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        FSMC_Write(1, inc ? p[i] : p[0]);
+    }
+    s_fsmc_sw_done = 1;
+#else
+    uint32_t cr = LCD_FSMC_DMA_STREAM->CR;
+
+    cr &= ~DMA_SxCR_PINC;
+    if (inc)
+        cr |= DMA_PeripheralInc_Enable;
+
+    LCD_FSMC_DMA_STREAM->CR   = cr;
+    LCD_FSMC_DMA_STREAM->PAR  = (uint32_t) src;
+    LCD_FSMC_DMA_STREAM->NDTR = count;
+
+    DMA_ClearFlag(LCD_FSMC_DMA_STREAM, LCD_FSMC_DMA_FLAG_ALL);
+    DMA_Cmd(LCD_FSMC_DMA_STREAM, ENABLE);
+#endif
+}
+
+/**
+ * @brief  把字节流的下一块换成原生像素并启动 DMA (私有)
+ * @note   上一段落单的高字节与本段第一个字节配对；本段最后落单的字节留给下一段
+ *         (BLIT 按 65535 字节切段，奇数段长会把一个像素拆在两段之间)
+ * @retval 1: 已启动 DMA，0: 本段已处理完
+ */
+static uint8_t FSMC_Byte_Chunk(void)
+{
+    uint16_t n = 0;
+
+    if (s_fsmc_hi_valid && s_fsmc_bs_left > 0)
+    {
+        s_fsmc_bounce[n++] = (uint16_t) ((s_fsmc_hi << 8) | *s_fsmc_bs_src);
+        s_fsmc_hi_valid    = 0;
+        s_fsmc_bs_src += s_fsmc_bs_inc;
+        s_fsmc_bs_left--;
+    }
+
+    uint32_t pairs = s_fsmc_bs_left / 2;
+    if (pairs > FSMC_BOUNCE_PIXELS - n)
+        pairs = FSMC_BOUNCE_PIXELS - n;
+
+    if (s_fsmc_bs_inc)
+    {
+        ST7789_Pix_Swap16(&s_fsmc_bounce[n], s_fsmc_bs_src, pairs);
+        s_fsmc_bs_src += pairs * 2;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < pairs; i++)
+            s_fsmc_bounce[n + i] = (uint16_t) ((s_fsmc_bs_src[0] << 8) | s_fsmc_bs_src[0]);
+    }
+    n += pairs;
+    s_fsmc_bs_left -= pairs * 2;
+
+    if (s_fsmc_bs_left == 1 && n < FSMC_BOUNCE_PIXELS)
+    {
+        s_fsmc_hi       = *s_fsmc_bs_src;
+        s_fsmc_hi_valid = 1;
+        s_fsmc_bs_src += s_fsmc_bs_inc;
+        s_fsmc_bs_left = 0;
+    }
+
+    if (n == 0)
+        return 0;
+
+    FSMC_DMA_Start(s_fsmc_bounce, n, 1);
+    return 1;
+}
+
+/**
+ * @brief  一次 DMA 搬运完成 (私有，中断或模拟 poll 调用)
+ * @note   字节流还有剩余时转换下一块继续搬运，整段发完才通知驱动
+ */
+static void FSMC_Transfer_Done(void)
+{
+    if (s_fsmc_bs_left > 0 && FSMC_Byte_Chunk())
+        return;
+
+    ST7789_Bus_Stream_Done();
+}
+
+// ====================================================================
+// 传输层函数表实现
+// ====================================================================
+static void FSMC_Bus_Init(void)
+{
+#ifndef ST7789_FSMC_MOCK
+    ST7789_FSMC_GPIO_Init();
+    ST7789_FSMC_Init();
+    ST7789_FSMC_DMA_Init();
+#endif
+    s_fsmc_hi_valid = 0;
+    s_fsmc_sw_done  = 0;
+}
+
+static void FSMC_Bus_Reset(uint8_t level)
+{
+#ifndef ST7789_FSMC_MOCK
+    if (level)
+        LCD_RST_SET();
+    else
+        LCD_RST_CLR();
+#endif
+}
+
+static void FSMC_Bus_Begin(void)
+{
+    // CS 由 FSMC 在每次访问时自动产生
+    s_fsmc_hi_valid = 0;
+}
+
+static void FSMC_Bus_End(void)
+{
+}
+
+static void FSMC_Bus_Write_Cmd(uint8_t cmd)
+{
+    FSMC_Write(0, cmd);
+}
+
+static void FSMC_Bus_Write_Bytes(const uint8_t* data, uint32_t len)
+{
+    // 命令参数在 D[7:0] 上，每个字节一次写
+    while (len--)
+    {
+        FSMC_Write(1, *data++);
+    }
+}
+
+static void FSMC_Bus_Write_Repeat(uint16_t pixel, uint32_t count)
+{
+    // 16 位总线：一次写就是一个像素
+    while (count--)
+    {
+        FSMC_Write(1, pixel);
+    }
+}
+
+static void FSMC_Bus_Set_16bit(uint8_t enable)
+{
+    // 并口宽度固定为 16 位，无需切换
+}
+
+static void FSMC_Bus_Stream(const void* src, uint16_t count, uint8_t halfword, uint8_t mem_inc)
+{
+    if (!halfword)
+    {
+        // 高字节在前的字节流：DMA 无法交换字节，分块换成原生像素后再搬运
+        s_fsmc_bs_src  = (const uint8_t*) src;
+        s_fsmc_bs_left = count;
+        s_fsmc_bs_inc  = mem_inc ? 1 : 0;
+
+        if (!FSMC_Byte_Chunk())
+            FSMC_Stream_Done_Soft(); // 只收到一个落单的高字节
+        return;
+    }
+
+    s_fsmc_bs_left = 0;
+    FSMC_DMA_Start(src, count, mem_inc);
+}
+
+static void FSMC_Bus_Lock(void)
+{
+#ifndef ST7789_FSMC_MOCK
+    NVIC_DisableIRQ(LCD_FSMC_DMA_IRQn);
+#endif
+}
+
+static void FSMC_Bus_Unlock(void)
+{
+#ifndef ST7789_FSMC_MOCK
+    NVIC_EnableIRQ(LCD_FSMC_DMA_IRQn);
+#endif
+}
+
+#ifdef ST7789_FSMC_MOCK
+static void FSMC_Bus_Poll(void)
+{
+    if (!s_fsmc_sw_done)
+        return;
+
+    s_fsmc_sw_done = 0;
+    FSMC_Transfer_Done();
+}
+#endif
+
+const ST7789_Bus_t g_st7789_bus_fsmc = {
+    .name         = "fsmc",
+    .init         = FSMC_Bus_Init,
+    .reset        = FSMC_Bus_Reset,
+    .begin        = FSMC_Bus_Begin,
+    .end          = FSMC_Bus_End,
+    .write_cmd    = FSMC_Bus_Write_Cmd,
+    .write_bytes  = FSMC_Bus_Write_Bytes,
+    .write_repeat = FSMC_Bus_Write_Repeat,
+    .set_16bit    = FSMC_Bus_Set_16bit,
+    .stream       = FSMC_Bus_Stream,
+    .lock         = FSMC_Bus_Lock,
+    .unlock       = FSMC_Bus_Unlock,
+#ifdef ST7789_FSMC_MOCK
+    .poll = FSMC_Bus_Poll,
+#else
+    .poll = NULL,
+#endif
+};
+
+#ifdef ST7789_FSMC_MOCK
+
+const ST7789_FSMC_Mock_Write_t* ST7789_FSMC_Mock_Log(void)
+{
+    return s_fsmc_mock_log;
+}
+
+uint32_t ST7789_FSMC_Mock_Count(void)
+{
+    return s_fsmc_mock_count;
+}
+
+void ST7789_FSMC_Mock_Clear(void)
+{
+    s_fsmc_mock_count = 0;
+}
+
+#else
+
+/**
+ * @brief  DMA2 Stream0 中断服务函数 (FSMC 搬运完成，或没有启动 DMA 的流传输)
+ */
+void LCD_FSMC_DMA_IRQHandler(void)
+{
+    if (s_fsmc_sw_done)
+    {
+        s_fsmc_sw_done = 0;
+        FSMC_Transfer_Done();
+        return;
+    }
+
+    if (DMA_GetITStatus(LCD_FSMC_DMA_STREAM, LCD_FSMC_DMA_IT_TC) == RESET)
+        return;
+
+    DMA_ClearITPendingBit(LCD_FSMC_DMA_STREAM, LCD_FSMC_DMA_IT_TC);
+    FSMC_Transfer_Done();
+}
+
+#endif /* ST7789_FSMC_MOCK */
+
+#endif /* ST7789_BUS_FSMC || ST7789_FSMC_MOCK */
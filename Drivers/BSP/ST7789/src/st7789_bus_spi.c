@@ -0,0 +1,311 @@
+/**
+ * @file    st7789_bus_spi.c
+ * @brief   ST7789 传输层：SPI2 + DMA1 Stream4 后端
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include <stddef.h>
+
+#ifndef ST7789_BUS_HOST
+
+/**
+ * @brief Stream4 的全部中断标志 (启动前统一清除)
+ */
+#define LCD_DMA_FLAG_ALL                                                                           \
+    (DMA_FLAG_TCIF4 | DMA_FLAG_HTIF4 | DMA_FLAG_TEIF4 | DMA_FLAG_DMEIF4 | DMA_FLAG_FEIF4)
+
+static uint8_t s_spi_16bit = 0; // SPI 当前帧宽 (0: 8位, 1: 16位)
+
+// ====================================================================
+// 硬件层初始化 (私有函数)
+// ====================================================================
+static void ST7789_Hardware_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    SPI_InitTypeDef  SPI_InitStructure;
+
+    // 1. 开启时钟
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2, ENABLE);
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB | RCC_AHB1Periph_GPIOC | RCC_AHB1Periph_GPIOE,
+                           ENABLE);
+
+    // 2. 配置控制引脚 (CS, DC, RST, BL)
+    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+
+    // CS
+    GPIO_InitStructure.GPIO_Pin = ST7789_CS_PIN;
+    GPIO_Init(ST7789_CS_PORT, &GPIO_InitStructure);
+    LCD_CS_SET();
+
+    // DC
+    GPIO_InitStructure.GPIO_Pin = ST7789_DC_PIN;
+    GPIO_Init(ST7789_DC_PORT, &GPIO_InitStructure);
+
+    // RST
+    GPIO_InitStructure.GPIO_Pin = ST7789_RST_PIN;
+    GPIO_Init(ST7789_RST_PORT, &GPIO_InitStructure);
+
+    // BL
+    GPIO_InitStructure.GPIO_Pin = ST7789_BL_PIN;
+    GPIO_Init(ST7789_BL_PORT, &GPIO_InitStructure);
+    LCD_BL_SET(); // 点亮背光
+
+    // 3. 配置 SPI 引脚 (SCK, MOSI, MISO)
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+
+    // SCK
+    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_SCK_PIN;
+    GPIO_Init(ST7789_SPI_SCK_PORT, &GPIO_InitStructure);
+    GPIO_PinAFConfig(ST7789_SPI_SCK_PORT, GPIO_PinSource10, GPIO_AF_SPI2);
+
+    // MOSI
+    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_MOSI_PIN;
+    GPIO_Init(ST7789_SPI_MOSI_PORT, &GPIO_InitStructure);
+    GPIO_PinAFConfig(ST7789_SPI_MOSI_PORT, GPIO_PinSource3, GPIO_AF_SPI2);
+
+    // MISO (虽然不用，但为了配置完整性)
+    GPIO_InitStructure.GPIO_Pin = ST7789_SPI_MISO_PIN;
+    GPIO_Init(ST7789_SPI_MISO_PORT, &GPIO_InitStructure);
+    GPIO_PinAFConfig(ST7789_SPI_MISO_PORT, GPIO_PinSource2, GPIO_AF_SPI2);
+
+    // 4. 配置 SPI 参数
+    SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
+    SPI_InitStructure.SPI_Mode      = SPI_Mode_Master;
+    SPI_InitStructure.SPI_DataSize  = SPI_DataSize_8b;
+    SPI_InitStructure.SPI_CPOL      = SPI_CPOL_Low;
+    SPI_InitStructure.SPI_CPHA      = SPI_CPHA_1Edge;
+    SPI_InitStructure.SPI_NSS       = SPI_NSS_Soft;
+    SPI_InitStructure.SPI_BaudRatePrescaler =
+        SPI_BaudRatePrescaler_2; // 尽可能快，F4 APB1=42M, /2=21M
+    SPI_InitStructure.SPI_FirstBit      = SPI_FirstBit_MSB;
+    SPI_InitStructure.SPI_CRCPolynomial = 7;
+    SPI_Init(ST7789_SPI_PERIPH, &SPI_InitStructure);
+
+    SPI_Cmd(ST7789_SPI_PERIPH, ENABLE);
+    s_spi_16bit = 0;
+}
+
+/**
+ * @brief  DMA 与中断的一次性配置 (私有)
+ * @note   每次传输只改地址/长度/位宽，不再 DeInit 整个 Stream
+ */
+static void ST7789_DMA_Init(void)
+{
+    DMA_InitTypeDef  DMA_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(LCD_DMA_CLK, ENABLE);
+    DMA_DeInit(LCD_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel            = LCD_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &ST7789_SPI_PERIPH->DR;
+    DMA_InitStructure.DMA_Memory0BaseAddr    = 0;
+    DMA_InitStructure.DMA_DIR                = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_BufferSize         = 1;
+    DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Disable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode               = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority           = DMA_Priority_VeryHigh;
+    DMA_InitStructure.DMA_FIFOMode           = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold      = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst        = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst    = DMA_PeripheralBurst_Single;
+    DMA_Init(LCD_DMA_STREAM, &DMA_InitStructure);
+
+    DMA_ITConfig(LCD_DMA_STREAM, DMA_IT_TC, ENABLE);
+
+    // SPI 的 TX DMA 请求常开：Stream 未使能时请求会被忽略，不影响轮询发送
+    SPI_I2S_DMACmd(ST7789_SPI_PERIPH, SPI_I2S_DMAReq_Tx, ENABLE);
+
+    NVIC_InitStructure.NVIC_IRQChannel                   = LCD_DMA_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = LCD_DMA_IRQ_PRIORITY;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority        = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd                = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/**
+ * @brief  等待 SPI 移位寄存器发完 (私有)
+ */
+static inline void ST7789_SPI_Wait_Idle(void)
+{
+    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
+        ;
+    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
+        ;
+}
+
+// ====================================================================
+// 基础通信接口
+// ====================================================================
+void ST7789_SPI_SendByte(uint8_t byte)
+{
+    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
+        ;
+    SPI_I2S_SendData(ST7789_SPI_PERIPH, byte);
+    while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
+        ;
+}
+
+// ====================================================================
+// 传输层函数表实现
+// ====================================================================
+static void SPI_Bus_Init(void)
+{
+    ST7789_Hardware_Init();
+    ST7789_DMA_Init();
+}
+
+static void SPI_Bus_Reset(uint8_t level)
+{
+    if (level)
+        LCD_RST_SET();
+    else
+        LCD_RST_CLR();
+}
+
+static void SPI_Bus_Begin(void)
+{
+    LCD_DC_SET(); // 默认数据模式
+    LCD_CS_CLR();
+}
+
+static void SPI_Bus_End(void)
+{
+    // DMA TC / TXE 只代表数据写进了 DR，还要等移位寄存器真正发完
+    ST7789_SPI_Wait_Idle();
+    LCD_CS_SET();
+}
+
+static void SPI_Bus_Write_Cmd(uint8_t cmd)
+{
+    LCD_DC_CLR(); // 命令模式
+    ST7789_SPI_SendByte(cmd);
+    LCD_DC_SET();
+}
+
+static void SPI_Bus_Write_Bytes(const uint8_t* data, uint32_t len)
+{
+    while (len--)
+    {
+        ST7789_SPI_SendByte(*data++);
+    }
+}
+
+static void SPI_Bus_Write_Repeat(uint16_t pixel, uint32_t count)
+{
+    uint8_t hi = pixel >> 8;
+    uint8_t lo = pixel & 0xFF;
+
+    if (s_spi_16bit)
+    {
+        while (count--)
+        {
+            while (SPI_I2S_GetFlagStatus(ST7789_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
+                ;
+            SPI_I2S_SendData(ST7789_SPI_PERIPH, pixel);
+        }
+        return;
+    }
+
+    // 纯阻塞发送
+    while (count--)
+    {
+        ST7789_SPI_SendByte(hi);
+        ST7789_SPI_SendByte(lo);
+    }
+}
+
+/**
+ * @brief  切换 SPI 数据帧宽度
+ * @note   DFF 只能在 SPE=0 时修改；调用时 CS 必须为高，防止 SCK 毛刺被屏幕误收
+ */
+static void SPI_Bus_Set_16bit(uint8_t enable)
+{
+    if (s_spi_16bit == enable)
+        return;
+
+    ST7789_SPI_Wait_Idle();
+
+    SPI_Cmd(ST7789_SPI_PERIPH, DISABLE);
+    if (enable)
+        ST7789_SPI_PERIPH->CR1 |= SPI_CR1_DFF;
+    else
+        ST7789_SPI_PERIPH->CR1 &= ~SPI_CR1_DFF;
+    SPI_Cmd(ST7789_SPI_PERIPH, ENABLE);
+
+    s_spi_16bit = enable;
+}
+
+/**
+ * @brief  启动一次 DMA 传输
+ * @param  src:      源地址
+ * @param  count:    数据项数 (<= 65535，NDTR 只有 16 位)
+ * @param  halfword: 1=16位数据项, 0=8位数据项
+ * @param  mem_inc:  1=源地址自增, 0=源地址固定
+ */
+static void SPI_Bus_Stream(const void* src, uint16_t count, uint8_t halfword, uint8_t mem_inc)
+{
+    uint32_t cr = LCD_DMA_STREAM->CR;
+
+    cr &= ~(DMA_SxCR_PSIZE | DMA_SxCR_MSIZE | DMA_SxCR_MINC);
+    if (halfword)
+        cr |= DMA_PeripheralDataSize_HalfWord | DMA_MemoryDataSize_HalfWord;
+    if (mem_inc)
+        cr |= DMA_MemoryInc_Enable;
+
+    LCD_DMA_STREAM->CR   = cr;
+    LCD_DMA_STREAM->M0AR = (uint32_t) src;
+    LCD_DMA_STREAM->NDTR = count;
+
+    DMA_ClearFlag(LCD_DMA_STREAM, LCD_DMA_FLAG_ALL);
+    DMA_Cmd(LCD_DMA_STREAM, ENABLE);
+}
+
+static void SPI_Bus_Lock(void)
+{
+    NVIC_DisableIRQ(LCD_DMA_IRQn);
+}
+
+static void SPI_Bus_Unlock(void)
+{
+    NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+const ST7789_Bus_t g_st7789_bus_spi = {
+    .name         = "spi2",
+    .init         = SPI_Bus_Init,
+    .reset        = SPI_Bus_Reset,
+    .begin        = SPI_Bus_Begin,
+    .end          = SPI_Bus_End,
+    .write_cmd    = SPI_Bus_Write_Cmd,
+    .write_bytes  = SPI_Bus_Write_Bytes,
+    .write_repeat = SPI_Bus_Write_Repeat,
+    .set_16bit    = SPI_Bus_Set_16bit,
+    .stream       = SPI_Bus_Stream,
+    .lock         = SPI_Bus_Lock,
+    .unlock       = SPI_Bus_Unlock,
+    .poll         = NULL,
+};
+
+/**
+ * @brief  DMA1 Stream4 中断服务函数 (SPI2_TX 传输完成)
+ * @note   交回驱动：装载下一段或收尾当前操作并调度下一个
+ */
+void DMA1_Stream4_IRQHandler(void)
+{
+    if (DMA_GetITStatus(LCD_DMA_STREAM, LCD_DMA_IT_TC) == RESET)
+        return;
+
+    DMA_ClearITPendingBit(LCD_DMA_STREAM, LCD_DMA_IT_TC);
+    ST7789_Bus_Stream_Done();
+}
+
+#endif /* ST7789_BUS_HOST */
@@ -0,0 +1,241 @@
+/**
+ * @file    st7789_fb8.c
+ * @brief   ST7789 8 位调色板影子帧缓冲实现
+ */
+
+#include "st7789_fb8.h"
+
+#if ST7789_FB8_ENABLE
+
+#include "st7789_pipe.h"
+#include <string.h>
+
+#define FB8_HASH_SIZE 512 // 颜色 -> 索引的开放寻址哈希表 (2 倍调色板，冲突少)
+#define FB8_HASH_EMPTY 0xFFFF
+
+static uint8_t  s_fb8[TFT_LINE_NUMBER][TFT_COLUMN_NUMBER]; // 颜色索引 (76.8K)
+static uint16_t s_fb8_palette[ST7789_FB8_PALETTE_SIZE];    // 索引 -> RGB565
+static uint16_t s_fb8_pal_count = 0;                       // 已分配的调色板项数
+static uint16_t s_fb8_hash[FB8_HASH_SIZE];                 // 调色板索引，FB8_HASH_EMPTY 为空槽
+
+// 脏行记录：每行的脏列范围 [x0, x1]，x0 > x1 表示该行干净
+static uint8_t s_fb8_dirty_x0[TFT_LINE_NUMBER];
+static uint8_t s_fb8_dirty_x1[TFT_LINE_NUMBER];
+
+// 最近一次查表结果 (填充/写字时颜色高度重复，命中后免去哈希计算)
+static uint16_t s_fb8_last_color = 0;
+static uint8_t  s_fb8_last_index = 0;
+
+/**
+ * @brief  求两个 RGB565 颜色的近似距离 (私有，调色板用完时找最接近的颜色)
+ */
+static uint32_t FB8_Color_Distance(uint16_t a, uint16_t b)
+{
+    int32_t dr = (int32_t) (a >> 11) - (int32_t) (b >> 11);
+    int32_t dg = (int32_t) ((a >> 5) & 0x3F) - (int32_t) ((b >> 5) & 0x3F);
+    int32_t db = (int32_t) (a & 0x1F) - (int32_t) (b & 0x1F);
+
+    // 绿色 6 位，红蓝 5 位：红蓝放大 2 倍后再比较
+    return (uint32_t) (dr * dr * 4 + dg * dg + db * db * 4);
+}
+
+/**
+ * @brief  标记一行中的脏列范围 (私有)
+ */
+static inline void FB8_Mark_Dirty(uint16_t y, uint16_t x0, uint16_t x1)
+{
+    if (s_fb8_dirty_x0[y] > s_fb8_dirty_x1[y])
+    {
+        s_fb8_dirty_x0[y] = x0;
+        s_fb8_dirty_x1[y] = x1;
+        return;
+    }
+    if (x0 < s_fb8_dirty_x0[y])
+        s_fb8_dirty_x0[y] = x0;
+    if (x1 > s_fb8_dirty_x1[y])
+        s_fb8_dirty_x1[y] = x1;
+}
+
+void ST7789_FB8_Init(void)
+{
+    memset(s_fb8, 0, sizeof(s_fb8));
+    memset(s_fb8_hash, 0xFF, sizeof(s_fb8_hash));
+    memset(s_fb8_dirty_x0, 0xFF, sizeof(s_fb8_dirty_x0));
+    memset(s_fb8_dirty_x1, 0x00, sizeof(s_fb8_dirty_x1));
+
+    // 索引 0 固定为黑色，与清零后的缓冲内容一致
+    s_fb8_pal_count  = 0;
+    s_fb8_last_color = BLACK;
+    s_fb8_last_index = ST7789_FB8_Color_Index(BLACK);
+}
+
+uint8_t ST7789_FB8_Color_Index(uint16_t color)
+{
+    if (color == s_fb8_last_color && s_fb8_pal_count > 0)
+        return s_fb8_last_index;
+
+    // 乘法散列，线性探测
+    uint16_t slot = (uint16_t) ((color * 40503U) >> 7) & (FB8_HASH_SIZE - 1);
+    uint8_t  index;
+
+    while (1)
+    {
+        uint16_t entry = s_fb8_hash[slot];
+
+        if (entry == FB8_HASH_EMPTY)
+        {
+            if (s_fb8_pal_count < ST7789_FB8_PALETTE_SIZE)
+            {
+                // 新颜色：分配下一个调色板项
+                index                = (uint8_t) s_fb8_pal_count++;
+                s_fb8_palette[index] = color;
+                s_fb8_hash[slot]     = index;
+            }
+            else
+            {
+                // 调色板已满：退化为最接近的已有颜色 (不写入哈希表)
+                uint32_t best = 0xFFFFFFFFU;
+                index         = 0;
+                for (uint16_t i = 0; i < ST7789_FB8_PALETTE_SIZE; i++)
+                {
+                    uint32_t d = FB8_Color_Distance(color, s_fb8_palette[i]);
+                    if (d < best)
+                    {
+                        best  = d;
+                        index = (uint8_t) i;
+                    }
+                }
+            }
+            break;
+        }
+
+        if (s_fb8_palette[entry] == color)
+        {
+            index = (uint8_t) entry;
+            break;
+        }
+
+        slot = (slot + 1) & (FB8_HASH_SIZE - 1);
+    }
+
+    s_fb8_last_color = color;
+    s_fb8_last_index = index;
+    return index;
+}
+
+uint8_t ST7789_FB8_Contains(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    return (w > 0 && h > 0 && x + w <= TFT_COLUMN_NUMBER && y + h <= TFT_LINE_NUMBER) ? 1 : 0;
+}
+
+uint8_t ST7789_FB8_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    if (!ST7789_FB8_Contains(x, y, w, h))
+        return 0;
+
+    uint8_t index = ST7789_FB8_Color_Index(color);
+
+    for (uint16_t row = y; row < y + h; row++)
+    {
+        memset(&s_fb8[row][x], index, w);
+        FB8_Mark_Dirty(row, x, x + w - 1);
+    }
+    return 1;
+}
+
+uint8_t ST7789_FB8_Blit(uint16_t       x,
+                        uint16_t       y,
+                        uint16_t       w,
+                        uint16_t       h,
+                        const uint8_t* data,
+                        uint8_t        native16)
+{
+    if (!ST7789_FB8_Contains(x, y, w, h))
+        return 0;
+
+    for (uint16_t row = 0; row < h; row++)
+    {
+        uint8_t* dst = &s_fb8[y + row][x];
+
+        for (uint16_t col = 0; col < w; col++)
+        {
+            uint16_t color;
+            if (native16)
+                color = ((const uint16_t*) data)[col];
+            else
+                color = (uint16_t) ((data[col * 2] << 8) | data[col * 2 + 1]);
+            dst[col] = ST7789_FB8_Color_Index(color);
+        }
+        FB8_Mark_Dirty(y + row, x, x + w - 1);
+        data += (uint32_t) w * 2;
+    }
+    return 1;
+}
+
+uint8_t ST7789_FB8_Write_Lines(uint16_t        x,
+                               uint16_t        y,
+                               uint16_t        w,
+                               uint16_t        rows,
+                               const uint16_t* src)
+{
+    return ST7789_FB8_Blit(x, y, w, rows, (const uint8_t*) src, 1);
+}
+
+uint8_t ST7789_FB8_Is_Dirty(void)
+{
+    for (uint16_t y = 0; y < TFT_LINE_NUMBER; y++)
+    {
+        if (s_fb8_dirty_x0[y] <= s_fb8_dirty_x1[y])
+            return 1;
+    }
+    return 0;
+}
+
+void ST7789_FB8_Flush(void)
+{
+    uint16_t y = 0;
+
+    while (y < TFT_LINE_NUMBER)
+    {
+        if (s_fb8_dirty_x0[y] > s_fb8_dirty_x1[y])
+        {
+            y++;
+            continue;
+        }
+
+        // 相邻脏行合并为一个窗口，列范围取并集
+        uint16_t y0 = y;
+        uint8_t  x0 = s_fb8_dirty_x0[y];
+        uint8_t  x1 = s_fb8_dirty_x1[y];
+
+        while (y < TFT_LINE_NUMBER && s_fb8_dirty_x0[y] <= s_fb8_dirty_x1[y])
+        {
+            if (s_fb8_dirty_x0[y] < x0)
+                x0 = s_fb8_dirty_x0[y];
+            if (s_fb8_dirty_x1[y] > x1)
+                x1 = s_fb8_dirty_x1[y];
+            s_fb8_dirty_x0[y] = 0xFF;
+            s_fb8_dirty_x1[y] = 0x00;
+            y++;
+        }
+
+        uint16_t w = x1 - x0 + 1;
+        if (!ST7789_Pipe_Begin_Direct(x0, y0, w, y - y0))
+            continue;
+
+        // 查表展开：索引 -> RGB565，写进 SRAM 行缓冲后由 DMA 发送
+        for (uint16_t row = y0; row < y; row++)
+        {
+            uint16_t*      line = ST7789_Pipe_Line();
+            const uint8_t* idx  = &s_fb8[row][x0];
+
+            for (uint16_t col = 0; col < w; col++)
+            {
+                line[col] = s_fb8_palette[idx[col]];
+            }
+        }
+        ST7789_Pipe_End();
+    }
+}
+
+#endif /* ST7789_FB8_ENABLE */
@@ -0,0 +1,621 @@
+/**
+ * @file    st7789_gfx.c
+ * @brief   ST7789 扫描线图元库实现
+ */
+
+#include "st7789_gfx.h"
+#include "st7789_pipe.h"
+#include <string.h>
+
+/**
+ * @brief 等待合并的矩形 (闭区间)
+ */
+typedef struct
+{
+    int16_t x0, x1;
+    int16_t y0, y1;
+} Gfx_Run_t;
+
+static Gfx_Run_t s_gfx_runs[ST7789_GFX_MAX_RUNS];
+static uint8_t   s_gfx_run_count = 0;
+static uint16_t  s_gfx_color     = 0;
+
+// 水平渐变的预计算行
+static uint16_t s_gfx_line[TFT_COLUMN_NUMBER];
+
+// sin(0 ~ 90 度)，Q14 定点
+static const int16_t s_gfx_sin_q14[91] = {
+    0,     286,   572,   857,   1143,  1428,  1713,  1997,  2280,  2563,  2845,  3126,  3406,
+    3686,  3964,  4240,  4516,  4790,  5063,  5334,  5604,  5872,  6138,  6402,  6664,  6924,
+    7182,  7438,  7692,  7943,  8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860,  10087,
+    10311, 10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365, 12551, 12733,
+    12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044, 14189, 14330, 14466, 14598, 14726,
+    14849, 14968, 15082, 15191, 15296, 15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964,
+    16026, 16083, 16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382, 16384,
+};
+
+// ====================================================================
+// 线段合并 (私有函数)
+// ====================================================================
+
+/**
+ * @brief  裁剪并填充一个矩形 (私有，闭区间坐标)
+ */
+static void Gfx_Rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    if (x0 < 0)
+        x0 = 0;
+    if (y0 < 0)
+        y0 = 0;
+    if (x1 >= TFT_COLUMN_NUMBER)
+        x1 = TFT_COLUMN_NUMBER - 1;
+    if (y1 >= TFT_LINE_NUMBER)
+        y1 = TFT_LINE_NUMBER - 1;
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    TFT_Fill_Rect_DMA(x0, y0, x1 - x0 + 1, y1 - y0 + 1, color);
+}
+
+/**
+ * @brief  发出第 i 个等待中的矩形 (私有)
+ */
+static void Gfx_Flush_Run(uint8_t i)
+{
+    Gfx_Run_t* run = &s_gfx_runs[i];
+
+    Gfx_Rect(run->x0, run->y0, run->x1, run->y1, s_gfx_color);
+    s_gfx_runs[i] = s_gfx_runs[--s_gfx_run_count];
+}
+
+/**
+ * @brief  开始一个图元 (私有)
+ */
+static void Gfx_Begin(uint16_t color)
+{
+    s_gfx_run_count = 0;
+    s_gfx_color     = color;
+}
+
+/**
+ * @brief  输出一段水平线段 (私有)
+ * @note   图元必须从上到下输出线段。与上一行起止列相同的线段并入同一矩形，
+ *         上一行没有接上的矩形已经不可能再延伸，立即发出。
+ */
+static void Gfx_Span(int16_t x0, int16_t x1, int16_t y)
+{
+    if (x0 > x1 || y < 0 || y >= TFT_LINE_NUMBER || x1 < 0 || x0 >= TFT_COLUMN_NUMBER)
+        return;
+
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 >= TFT_COLUMN_NUMBER)
+        x1 = TFT_COLUMN_NUMBER - 1;
+
+    // 1. 接到上一行相同的线段下面
+    for (uint8_t i = 0; i < s_gfx_run_count; i++)
+    {
+        Gfx_Run_t* run = &s_gfx_runs[i];
+        if (run->x0 == x0 && run->x1 == x1 && run->y1 + 1 == y)
+        {
+            run->y1 = y;
+            return;
+        }
+    }
+
+    // 2. 断开的矩形先发出去，腾出位置
+    for (uint8_t i = 0; i < s_gfx_run_count;)
+    {
+        if (s_gfx_runs[i].y1 + 1 < y)
+            Gfx_Flush_Run(i);
+        else
+            i++;
+    }
+    if (s_gfx_run_count == ST7789_GFX_MAX_RUNS)
+        Gfx_Flush_Run(0);
+
+    Gfx_Run_t* run = &s_gfx_runs[s_gfx_run_count++];
+    run->x0        = x0;
+    run->x1        = x1;
+    run->y0        = y;
+    run->y1        = y;
+}
+
+/**
+ * @brief  结束一个图元，发出所有等待中的矩形 (私有)
+ */
+static void Gfx_End(void)
+{
+    while (s_gfx_run_count)
+    {
+        Gfx_Flush_Run(0);
+    }
+}
+
+// ====================================================================
+// 数学辅助 (私有函数)
+// ====================================================================
+
+/**
+ * @brief  32 位整数平方根 (向下取整)
+ */
+static uint16_t Gfx_Isqrt(uint32_t n)
+{
+    uint32_t root = 0;
+    uint32_t bit  = 1UL << 30;
+
+    while (bit > n)
+        bit >>= 2;
+
+    while (bit)
+    {
+        if (n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t) root;
+}
+
+/**
+ * @brief  半径 r 的圆在纵向偏移 dy 处的半宽
+ * @note   判据 x^2 + dy^2 <= r^2 + r 与中点画圆法的取整一致，轮廓不会出现尖角
+ * @retval 半宽 (像素)，-1 表示这一行不在圆内
+ */
+static int16_t Gfx_Half_Width(int16_t r, int16_t dy)
+{
+    int32_t rem = (int32_t) r * r + r - (int32_t) dy * dy;
+
+    if (r < 0 || rem < 0)
+        return -1;
+    return (int16_t) Gfx_Isqrt((uint32_t) rem);
+}
+
+/**
+ * @brief  sin(deg)，Q14 定点 (私有)
+ */
+static int32_t Gfx_Sin(int32_t deg)
+{
+    deg %= 360;
+    if (deg < 0)
+        deg += 360;
+
+    if (deg <= 90)
+        return s_gfx_sin_q14[deg];
+    if (deg <= 180)
+        return s_gfx_sin_q14[180 - deg];
+    if (deg <= 270)
+        return -s_gfx_sin_q14[deg - 180];
+    return -s_gfx_sin_q14[360 - deg];
+}
+
+/**
+ * @brief  圆角矩形第 ry 行的左右缩进 (私有)
+ */
+static int16_t Gfx_Round_Inset(int16_t h, int16_t r, int16_t ry)
+{
+    if (ry < r)
+        return r - Gfx_Half_Width(r, r - ry);
+    if (ry >= h - r)
+        return r - Gfx_Half_Width(r, ry - (h - 1 - r));
+    return 0;
+}
+
+/**
+ * @brief  两个 RGB565 颜色之间的线性插值 (私有)
+ * @param  i: 当前步 (0 ~ n)
+ * @param  n: 总步数 (0 时返回 a)
+ */
+static uint16_t Gfx_Lerp565(uint16_t a, uint16_t b, int32_t i, int32_t n)
+{
+    if (n <= 0)
+        return a;
+
+    int32_t ra = a >> 11, ga = (a >> 5) & 0x3F, ba = a & 0x1F;
+    int32_t rb = b >> 11, gb = (b >> 5) & 0x3F, bb = b & 0x1F;
+
+    // +-n/2 四舍五入 (除法向零截断，递减分量要减 n/2，否则 i == n 时到不了终点色)
+    int32_t dr = (rb - ra) * i * 2, dg = (gb - ga) * i * 2, db = (bb - ba) * i * 2;
+    int32_t r  = ra + (dr + (dr < 0 ? -n : n)) / (2 * n);
+    int32_t g  = ga + (dg + (dg < 0 ? -n : n)) / (2 * n);
+    int32_t bl = ba + (db + (db < 0 ? -n : n)) / (2 * n);
+
+    return (uint16_t) ((r << 11) | (g << 5) | bl);
+}
+
+// ====================================================================
+// 直线
+// ====================================================================
+
+/**
+ * @brief  单像素宽直线 (私有，Bresenham，同一行的像素合并为一段)
+ */
+static void Gfx_Thin_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    int16_t dx  = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    int16_t dy  = y1 - y0; // 调用者保证 y0 <= y1
+    int16_t sx  = (x0 < x1) ? 1 : -1;
+    int32_t err = dx - dy;
+
+    int16_t run_x0 = x0, run_x1 = x0, run_y = y0;
+
+    while (x0 != x1 || y0 != y1)
+    {
+        int32_t e2 = err * 2;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y0++;
+        }
+
+        if (y0 != run_y)
+        {
+            Gfx_Span(run_x0, run_x1, run_y);
+            run_x0 = run_x1 = x0;
+            run_y           = y0;
+        }
+        else if (x0 < run_x0)
+        {
+            run_x0 = x0;
+        }
+        else if (x0 > run_x1)
+        {
+            run_x1 = x0;
+        }
+    }
+    Gfx_Span(run_x0, run_x1, run_y);
+}
+
+/**
+ * @brief  粗直线 (私有，旋转矩形的扫描线填充，8 位小数定点)
+ */
+static void Gfx_Thick_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness)
+{
+    int32_t dx  = x1 - x0;
+    int32_t dy  = y1 - y0;
+    int32_t len = Gfx_Isqrt((uint32_t) (dx * dx + dy * dy));
+
+    // 法向量 * 线宽/2
+    int32_t ox = -dy * thickness * 128 / len;
+    int32_t oy = dx * thickness * 128 / len;
+
+    int32_t px[4] = {x0 * 256 + ox, x1 * 256 + ox, x1 * 256 - ox, x0 * 256 - ox};
+    int32_t py[4] = {y0 * 256 + oy, y1 * 256 + oy, y1 * 256 - oy, y0 * 256 - oy};
+
+    int32_t ymin = py[0], ymax = py[0];
+    for (uint8_t i = 1; i < 4; i++)
+    {
+        if (py[i] < ymin)
+            ymin = py[i];
+        if (py[i] > ymax)
+            ymax = py[i];
+    }
+
+    // 逐行求与四条边的交点，取最左/最右 (像素中心落在内部才算)
+    for (int32_t y = (ymin + 255) >> 8; y <= (ymax >> 8); y++)
+    {
+        int32_t yc   = y * 256;
+        int32_t xmin = INT32_MAX, xmax = INT32_MIN;
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            uint8_t j  = (i + 1) & 3;
+            int32_t ya = py[i], yb = py[j];
+            int32_t xa = px[i], xb = px[j];
+
+            if (ya == yb || yc < (ya < yb ? ya : yb) || yc > (ya < yb ? yb : ya))
+                continue;
+
+            int32_t x = xa + (int32_t) ((int64_t) (xb - xa) * (yc - ya) / (yb - ya));
+            if (x < xmin)
+                xmin = x;
+            if (x > xmax)
+                xmax = x;
+        }
+
+        if (xmin <= xmax)
+            Gfx_Span((int16_t) ((xmin + 255) >> 8), (int16_t) (xmax >> 8), (int16_t) y);
+    }
+}
+
+void TFT_Draw_Line(int16_t  x0,
+                   int16_t  y0,
+                   int16_t  x1,
+                   int16_t  y1,
+                   uint8_t  thickness,
+                   uint16_t color)
+{
+    if (thickness == 0)
+        thickness = 1;
+
+    // 从上往下画
+    if (y0 > y1)
+    {
+        int16_t t = y0;
+        y0        = y1;
+        y1        = t;
+        t         = x0;
+        x0        = x1;
+        x1        = t;
+    }
+
+    // 水平/竖直线：一个矩形
+    if (x0 == x1 || y0 == y1)
+    {
+        int16_t half = (thickness - 1) / 2;
+        int16_t xl = (x0 < x1) ? x0 : x1, xr = (x0 < x1) ? x1 : x0;
+
+        if (x0 == x1)
+            Gfx_Rect(xl - half, y0, xl - half + thickness - 1, y1, color);
+        else
+            Gfx_Rect(xl, y0 - half, xr, y0 - half + thickness - 1, color);
+        return;
+    }
+
+    Gfx_Begin(color);
+    if (thickness == 1)
+        Gfx_Thin_Line(x0, y0, x1, y1);
+    else
+        Gfx_Thick_Line(x0, y0, x1, y1, thickness);
+    Gfx_End();
+}
+
+// ====================================================================
+// 圆 / 圆环 / 圆弧
+// ====================================================================
+
+void TFT_Fill_Circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color)
+{
+    Gfx_Begin(color);
+    for (int16_t dy = -(int16_t) r; dy <= (int16_t) r; dy++)
+    {
+        int16_t a = Gfx_Half_Width(r, dy);
+        Gfx_Span(cx - a, cx + a, cy + dy);
+    }
+    Gfx_End();
+}
+
+void TFT_Draw_Circle(int16_t cx, int16_t cy, uint16_t r, uint8_t thickness, uint16_t color)
+{
+    TFT_Draw_Arc(cx, cy, r, thickness, 0, 0, color);
+}
+
+/**
+ * @brief  像素 (dx, dy) 是否在扇区内 (私有)
+ * @note   叉积判断：屏幕坐标系 y 向下，cross(a, b) > 0 表示 b 在 a 的顺时针方向
+ */
+static inline uint8_t Gfx_In_Sector(int32_t dx, int32_t dy, const int32_t* s, const int32_t* e,
+                                    uint8_t wide)
+{
+    int32_t cs = s[0] * dy - s[1] * dx; // cross(s, p)
+    int32_t ce = dx * e[1] - dy * e[0]; // cross(p, e)
+
+    if (!wide)
+        return (cs >= 0 && ce >= 0) ? 1 : 0;
+
+    // 扫过角 > 180 度：取反向小扇区的补集
+    return (cs < 0 && ce < 0) ? 0 : 1;
+}
+
+/**
+ * @brief  圆环的一段线段按扇区拆开输出 (私有)
+ */
+static void Gfx_Arc_Span(int16_t        cx,
+                         int16_t        x0,
+                         int16_t        x1,
+                         int16_t        y,
+                         int16_t        dy,
+                         const int32_t* s,
+                         const int32_t* e,
+                         uint8_t        wide)
+{
+    int16_t start = -1;
+
+    for (int16_t x = x0; x <= x1; x++)
+    {
+        if (Gfx_In_Sector(x - cx, dy, s, e, wide))
+        {
+            if (start < 0)
+                start = x;
+        }
+        else if (start >= 0)
+        {
+            Gfx_Span(start, x - 1, y);
+            start = -1;
+        }
+    }
+    if (start >= 0)
+        Gfx_Span(start, x1, y);
+}
+
+void TFT_Draw_Arc(int16_t  cx,
+                  int16_t  cy,
+                  uint16_t r,
+                  uint8_t  thickness,
+                  uint16_t start_deg,
+                  uint16_t end_deg,
+                  uint16_t color)
+{
+    int16_t  rin   = (int16_t) r - thickness; // 内圆半径，< 0 表示实心
+    uint16_t sweep = (uint16_t) ((end_deg % 360 + 360 - start_deg % 360) % 360);
+    uint8_t  full  = (sweep == 0) ? 1 : 0; // 起止相同按整圆处理
+    uint8_t  wide  = (sweep > 180) ? 1 : 0;
+    int32_t  s[2]  = {Gfx_Sin(start_deg + 90), Gfx_Sin(start_deg)}; // (cos, sin)
+    int32_t  e[2]  = {Gfx_Sin(end_deg + 90), Gfx_Sin(end_deg)};
+
+    Gfx_Begin(color);
+    for (int16_t dy = -(int16_t) r; dy <= (int16_t) r; dy++)
+    {
+        int16_t a = Gfx_Half_Width(r, dy);
+        int16_t b = Gfx_Half_Width(rin, dy);
+        int16_t y = cy + dy;
+
+        // 这一行的圆环：内圆之外的左右两段，或者 (内圆不覆盖这一行时) 整段
+        int16_t seg[2][2] = {{cx - a, cx + a}, {0, -1}};
+        if (b >= 0)
+        {
+            seg[0][1] = cx - b - 1;
+            seg[1][0] = cx + b + 1;
+            seg[1][1] = cx + a;
+        }
+
+        for (uint8_t k = 0; k < 2; k++)
+        {
+            if (seg[k][0] > seg[k][1])
+                continue;
+            if (full)
+                Gfx_Span(seg[k][0], seg[k][1], y);
+            else
+                Gfx_Arc_Span(cx, seg[k][0], seg[k][1], y, dy, s, e, wide);
+        }
+    }
+    Gfx_End();
+}
+
+// ====================================================================
+// 圆角矩形
+// ====================================================================
+
+void TFT_Fill_Round_Rect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color)
+{
+    if (w == 0 || h == 0)
+        return;
+
+    if (r > w / 2)
+        r = w / 2;
+    if (r > h / 2)
+        r = h / 2;
+
+    Gfx_Begin(color);
+    for (int16_t ry = 0; ry < (int16_t) h; ry++)
+    {
+        int16_t inset = Gfx_Round_Inset(h, r, ry);
+        Gfx_Span(x + inset, x + w - 1 - inset, y + ry);
+    }
+    Gfx_End();
+}
+
+void TFT_Draw_Round_Rect(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t r,
+                         uint8_t  thickness,
+                         uint16_t color)
+{
+    if (w == 0 || h == 0)
+        return;
+
+    // 边框比图形还厚：等同实心
+    if (thickness == 0 || w <= 2 * thickness || h <= 2 * thickness)
+    {
+        TFT_Fill_Round_Rect(x, y, w, h, r, color);
+        return;
+    }
+
+    if (r > w / 2)
+        r = w / 2;
+    if (r > h / 2)
+        r = h / 2;
+
+    // 内轮廓：向内收缩 thickness 的圆角矩形
+    int16_t in_h = h - 2 * thickness;
+    int16_t in_r = (r > thickness) ? r - thickness : 0;
+
+    Gfx_Begin(color);
+    for (int16_t ry = 0; ry < (int16_t) h; ry++)
+    {
+        int16_t outer = Gfx_Round_Inset(h, r, ry);
+        int16_t iry   = ry - thickness;
+
+        if (iry < 0 || iry >= in_h)
+        {
+            Gfx_Span(x + outer, x + w - 1 - outer, y + ry);
+            continue;
+        }
+
+        int16_t inner = thickness + Gfx_Round_Inset(in_h, in_r, iry);
+        Gfx_Span(x + outer, x + inner - 1, y + ry);
+        Gfx_Span(x + w - inner, x + w - 1 - outer, y + ry);
+    }
+    Gfx_End();
+}
+
+// ====================================================================
+// 渐变
+// ====================================================================
+
+void TFT_Fill_Gradient_V(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t color_top,
+                         uint16_t color_bottom)
+{
+    if (w == 0 || h == 0)
+        return;
+
+    // 量化后颜色相同的相邻行合并成一次填充
+    uint16_t run_start = 0;
+    uint16_t run_color = color_top;
+
+    for (uint16_t i = 1; i <= h; i++)
+    {
+        uint16_t c = (i < h) ? Gfx_Lerp565(color_top, color_bottom, i, h - 1) : ~run_color;
+        if (c == run_color)
+            continue;
+
+        Gfx_Rect(x, y + run_start, x + w - 1, y + i - 1, run_color);
+        run_start = i;
+        run_color = c;
+    }
+}
+
+void TFT_Fill_Gradient_H(int16_t  x,
+                         int16_t  y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint16_t color_left,
+                         uint16_t color_right)
+{
+    // 裁剪到屏幕 (插值仍按未裁剪的宽度计算)
+    int16_t x0 = (x < 0) ? 0 : x;
+    int16_t y0 = (y < 0) ? 0 : y;
+    int16_t x1 = x + (int16_t) w - 1;
+    int16_t y1 = y + (int16_t) h - 1;
+
+    if (x1 >= TFT_COLUMN_NUMBER)
+        x1 = TFT_COLUMN_NUMBER - 1;
+    if (y1 >= TFT_LINE_NUMBER)
+        y1 = TFT_LINE_NUMBER - 1;
+    if (w == 0 || h == 0 || x0 > x1 || y0 > y1)
+        return;
+
+    uint16_t cw = x1 - x0 + 1;
+    uint16_t ch = y1 - y0 + 1;
+
+    // 每一行都一样：只算一次
+    for (uint16_t i = 0; i < cw; i++)
+    {
+        s_gfx_line[i] = Gfx_Lerp565(color_left, color_right, x0 - x + i, w - 1);
+    }
+
+    if (!ST7789_Pipe_Begin(x0, y0, cw, ch))
+        return;
+    for (uint16_t row = 0; row < ch; row++)
+    {
+        memcpy(ST7789_Pipe_Line(), s_gfx_line, cw * 2);
+    }
+    ST7789_Pipe_End();
+}
@@ -0,0 +1,138 @@
+/**
+ * @file    st7789_pipe.c
+ * @brief   ST7789 乒乓行缓冲渲染管线实现
+ */
+
+#include "st7789_pipe.h"
+#include "st7789_tile.h"
+#include "st7789_fb8.h"
+#include <stddef.h>
+
+typedef enum
+{
+    PIPE_MODE_DIRECT = 0,    // 只上屏 (合成层自己推送时使用)
+    PIPE_MODE_WRITE_THROUGH, // 上屏，同时同步合成层副本
+    PIPE_MODE_CAPTURE,       // 整块区域由合成层接管，不直接上屏
+} Pipe_Mode_e;
+
+// 两块行缓冲 (4 字节对齐，满足半字 DMA)
+static uint16_t s_pipe_buf[2][ST7789_PIPE_BUF_PIXELS] __attribute__((aligned(4)));
+
+static volatile uint8_t s_pipe_busy[2] = {0, 0}; // 缓冲正在被 DMA 发送
+static uint8_t          s_pipe_cur     = 0;      // CPU 当前填充的缓冲
+static uint16_t         s_pipe_fill    = 0;      // 当前缓冲已填像素数
+static uint16_t         s_pipe_w       = 0;      // 本次绘制的行宽
+static uint16_t         s_pipe_x       = 0;      // 本次绘制的起点
+static uint16_t         s_pipe_y       = 0;      // 下一块缓冲对应的屏幕行
+static Pipe_Mode_e      s_pipe_mode    = PIPE_MODE_DIRECT;
+
+/**
+ * @brief  DMA 发完一块缓冲后的回调 (中断上下文)
+ */
+static void ST7789_Pipe_Release(void* arg)
+{
+    *(volatile uint8_t*) arg = 0;
+}
+
+/**
+ * @brief  把当前缓冲提交给 DMA 并切到另一块 (私有)
+ */
+static void ST7789_Pipe_Submit(void)
+{
+    if (s_pipe_fill == 0)
+        return;
+
+    uint16_t rows = s_pipe_fill / s_pipe_w;
+
+    // 合成层副本同步：8 位影子帧缓冲开启时由它接管全屏，否则交给瓦片层
+    if (s_pipe_mode != PIPE_MODE_DIRECT)
+    {
+        if (!ST7789_FB8_Write_Lines(s_pipe_x, s_pipe_y, s_pipe_w, rows, s_pipe_buf[s_pipe_cur]))
+        {
+            ST7789_Tile_Write_Lines(s_pipe_x,
+                                    s_pipe_y,
+                                    s_pipe_w,
+                                    rows,
+                                    s_pipe_buf[s_pipe_cur],
+                                    s_pipe_mode == PIPE_MODE_CAPTURE);
+        }
+    }
+    s_pipe_y += rows;
+
+    // 接管模式下缓冲内容已拷走，立即可复用
+    if (s_pipe_mode == PIPE_MODE_CAPTURE)
+    {
+        s_pipe_fill = 0;
+        return;
+    }
+
+    s_pipe_busy[s_pipe_cur] = 1;
+    ST7789_Queue_Pixels(s_pipe_buf[s_pipe_cur],
+                        s_pipe_fill,
+                        ST7789_Pipe_Release,
+                        (void*) &s_pipe_busy[s_pipe_cur]);
+
+    s_pipe_cur ^= 1;
+    s_pipe_fill = 0;
+}
+
+/**
+ * @brief  开始一次管线绘制 (私有)
+ */
+static uint8_t ST7789_Pipe_Start(uint16_t x, uint16_t y, uint16_t w, uint16_t h, Pipe_Mode_e mode)
+{
+    if (w == 0 || h == 0 || w > ST7789_PIPE_BUF_PIXELS)
+        return 0;
+
+    s_pipe_w    = w;
+    s_pipe_x    = x;
+    s_pipe_y    = y;
+    s_pipe_mode = mode;
+
+    if (mode != PIPE_MODE_CAPTURE)
+        ST7789_Queue_Window(x, y, x + w - 1, y + h - 1);
+    return 1;
+}
+
+uint8_t ST7789_Pipe_Begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    Pipe_Mode_e mode = PIPE_MODE_WRITE_THROUGH;
+
+    if (ST7789_FB8_Contains(x, y, w, h) || ST7789_Tile_Contains(x, y, w, h))
+        mode = PIPE_MODE_CAPTURE;
+
+    return ST7789_Pipe_Start(x, y, w, h, mode);
+}
+
+uint8_t ST7789_Pipe_Begin_Direct(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    return ST7789_Pipe_Start(x, y, w, h, PIPE_MODE_DIRECT);
+}
+
+uint16_t* ST7789_Pipe_Line(void)
+{
+    if (s_pipe_fill + s_pipe_w > ST7789_PIPE_BUF_PIXELS)
+        ST7789_Pipe_Submit();
+
+    // 刚切换到的缓冲可能还在发送上一批数据，等它释放
+    if (s_pipe_fill == 0)
+    {
+        // 缓冲可能排在 TE 闸门后面，忙等之前先放行，否则要空转到下一个 TE
+        if (s_pipe_busy[s_pipe_cur])
+            ST7789_Frame_Release();
+
+        while (s_pipe_busy[s_pipe_cur])
+        {
+            ST7789_Poll();
+        }
+    }
+
+    uint16_t* line = &s_pipe_buf[s_pipe_cur][s_pipe_fill];
+    s_pipe_fill += s_pipe_w;
+    return line;
+}
+
+void ST7789_Pipe_End(void)
+{
+    ST7789_Pipe_Submit();
+}
@@ -0,0 +1,379 @@
+/**
+ * @file    st7789_pix.c
+ * @brief   像素转换内核实现 (按字处理的 SIMD / 可移植版本 + 参考实现 + 对比测量)
+ */
+
+#include "st7789_pix.h"
+#include "st7789.h" // 目标板上带入 stm32f4xx.h -> core_cm4.h (core_cmSimd.h、DWT)
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief 是否使用 SIMD 版本
+ * @note  主机构建没有 CMSIS，编译器未打开 DSP 扩展 (-mcpu=cortex-m4) 时使用可移植版本
+ */
+#ifndef ST7789_PIX_SIMD
+#if !defined(ST7789_BUS_HOST) && defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define ST7789_PIX_SIMD 1
+#else
+#define ST7789_PIX_SIMD 0
+#endif
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "st7789_pix.c 按小端拼接像素字 (地址较低的像素在低半字)"
+#endif
+
+#define PIX_BENCH_WIDTH    TFT_COLUMN_NUMBER // 测量用的行宽 (像素)
+#define PIX_BENCH_LINES    64                // 测量用的行数
+#define PIX_BENCH_MAX_W    64                // 逐位对比覆盖的最大宽度
+#define PIX_BENCH_SENTINEL 0xA5A5            // 输出末尾之后的哨兵，检查越界写
+
+/**
+ * @brief RGB888 截断为 RGB565 (只取各参数的低 8 位，与 TFT_RGB 相同)
+ */
+#define PIX_RGB565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3))
+
+/**
+ * @brief 字组运算：SIMD 指令或等价的位运算
+ * @note  PIX_SELECT2: 按掩码逐字节从 a / b 中选取 (掩码字节加 0x01 产生进位即置位 GE 标志，
+ *                     __SEL 据此选 a)；PIX_REV16: 交换两个半字各自的字节序；
+ *                     PIX_PACK2: lo 的低半字与 hi 的低半字拼成一个字
+ */
+#if ST7789_PIX_SIMD
+#define PIX_SELECT2(mask, a, b) (__UADD8((mask), 0x01010101), __SEL((a), (b)))
+#define PIX_REV16(v)            __REV16(v)
+#define PIX_PACK2(lo, hi)       __PKHBT((lo), (hi), 16)
+#else
+#define PIX_SELECT2(mask, a, b) (((a) & (mask)) | ((b) & ~(mask)))
+#define PIX_REV16(v)            ((((v) & 0x00FF00FF) << 8) | (((v) >> 8) & 0x00FF00FF))
+#define PIX_PACK2(lo, hi)       (((lo) & 0xFFFF) | ((uint32_t) (hi) << 16))
+#endif
+
+/**
+ * @brief 2 位 -> 两个半字的选择掩码 (bit0 对应低半字，即地址较低的像素)
+ */
+static const uint32_t s_pix_sel_mask[4] = {0x00000000, 0x0000FFFF, 0xFFFF0000, 0xFFFFFFFF};
+
+// 对比测量用的缓冲 (输出缓冲 4 字节对齐，偏移 1 个像素即为非对齐)
+static uint8_t  s_bench_src[PIX_BENCH_WIDTH * 3 + 4];
+static uint16_t s_bench_ref[PIX_BENCH_WIDTH + 4] __attribute__((aligned(4)));
+static uint16_t s_bench_fast[PIX_BENCH_WIDTH + 4] __attribute__((aligned(4)));
+
+// ====================================================================
+// 参考实现 (逐像素)
+// ====================================================================
+void ST7789_Pix_Expand_Bits_Ref(uint16_t*      dst,
+                                const uint8_t* src,
+                                uint16_t       skip,
+                                uint16_t       w,
+                                uint16_t       fg,
+                                uint16_t       bg)
+{
+    const uint8_t* p    = src + skip / 8;
+    uint8_t        bits = *p++ >> (skip % 8);
+    uint8_t        left = 8 - skip % 8; // 当前字节还剩几位
+
+    for (uint16_t col = 0; col < w; col++)
+    {
+        if (left == 0)
+        {
+            bits = *p++;
+            left = 8;
+        }
+        dst[col] = (bits & 1) ? fg : bg;
+        bits >>= 1;
+        left--;
+    }
+}
+
+void ST7789_Pix_Swap16_Ref(uint16_t* dst, const uint8_t* src, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        dst[i] = (uint16_t) ((src[i * 2] << 8) | src[i * 2 + 1]);
+    }
+}
+
+void ST7789_Pix_RGB888_To_565_Ref(uint16_t* dst, const uint8_t* src, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        dst[i] = (uint16_t) PIX_RGB565(src[i * 3], src[i * 3 + 1], src[i * 3 + 2]);
+    }
+}
+
+// ====================================================================
+// 对外接口 (按字处理，每次写两个像素)
+// ====================================================================
+
+/**
+ * @brief  写两个像素 (私有)
+ * @note   经 memcpy 存储，不把 uint16_t 缓冲当作 uint32_t 访问 (严格别名)；
+ *         dst 已对齐到 4 字节，编译结果为一条 STR
+ */
+static inline void Pix_Store2(uint16_t* dst, uint32_t word)
+{
+    memcpy(dst, &word, 4);
+}
+
+void ST7789_Pix_Expand_Bits(uint16_t*      dst,
+                            const uint8_t* src,
+                            uint16_t       skip,
+                            uint16_t       w,
+                            uint16_t       fg,
+                            uint16_t       bg)
+{
+    const uint8_t* p     = src + skip / 8;
+    uint32_t       bits  = *p++ >> (skip % 8); // 位缓冲，低位为下一个像素
+    uint8_t        avail = 8 - skip % 8;       // 位缓冲中的有效位数
+    uint32_t       fg2   = ((uint32_t) fg << 16) | fg;
+    uint32_t       bg2   = ((uint32_t) bg << 16) | bg;
+
+    // 1. 输出地址对齐到 4 字节
+    if (((uintptr_t) dst & 2) && w)
+    {
+        *dst++ = (bits & 1) ? fg : bg;
+        bits >>= 1;
+        avail--;
+        w--;
+    }
+
+    // 2. 每次 8 个像素 = 1 字节位图 = 4 次 32 位存储
+    for (; w >= 8; w -= 8)
+    {
+        // 还需要的位一定在本行内，补进的字节不会越过行尾
+        if (avail < 8)
+        {
+            bits |= (uint32_t) *p++ << avail;
+            avail += 8;
+        }
+
+        Pix_Store2(dst, PIX_SELECT2(s_pix_sel_mask[bits & 3], fg2, bg2));
+        Pix_Store2(dst + 2, PIX_SELECT2(s_pix_sel_mask[(bits >> 2) & 3], fg2, bg2));
+        Pix_Store2(dst + 4, PIX_SELECT2(s_pix_sel_mask[(bits >> 4) & 3], fg2, bg2));
+        Pix_Store2(dst + 6, PIX_SELECT2(s_pix_sel_mask[(bits >> 6) & 3], fg2, bg2));
+
+        bits >>= 8;
+        avail -= 8;
+        dst += 8;
+    }
+
+    // 3. 不足 8 个的尾部逐像素
+    for (; w; w--)
+    {
+        if (avail == 0)
+        {
+            bits  = *p++;
+            avail = 8;
+        }
+        *dst++ = (bits & 1) ? fg : bg;
+        bits >>= 1;
+        avail--;
+    }
+}
+
+void ST7789_Pix_Swap16(uint16_t* dst, const uint8_t* src, uint32_t n)
+{
+    if (((uintptr_t) dst & 2) && n)
+    {
+        *dst++ = (uint16_t) ((src[0] << 8) | src[1]);
+        src += 2;
+        n--;
+    }
+
+    // 每次两个像素：非对齐读一个字 (Cortex-M4 单条 LDR 支持)，交换字节序后整字写入
+    for (; n >= 2; n -= 2)
+    {
+        uint32_t word;
+
+        memcpy(&word, src, 4);
+        Pix_Store2(dst, PIX_REV16(word));
+        src += 4;
+        dst += 2;
+    }
+
+    if (n)
+        *dst = (uint16_t) ((src[0] << 8) | src[1]);
+}
+
+void ST7789_Pix_RGB888_To_565(uint16_t* dst, const uint8_t* src, uint32_t n)
+{
+    if (((uintptr_t) dst & 2) && n)
+    {
+        *dst++ = (uint16_t) PIX_RGB565(src[0], src[1], src[2]);
+        src += 3;
+        n--;
+    }
+
+    // 每次 4 个像素：3 个字读入 12 字节，两两拼成一个字写出
+    for (; n >= 4; n -= 4)
+    {
+        uint32_t w0, w1, w2;
+
+        memcpy(&w0, src, 4);     // R0 G0 B0 R1 (低字节在前)
+        memcpy(&w1, src + 4, 4); // G1 B1 R2 G2
+        memcpy(&w2, src + 8, 4); // B2 R3 G3 B3
+
+        uint32_t p0 = PIX_RGB565(w0, w0 >> 8, w0 >> 16);
+        uint32_t p1 = PIX_RGB565(w0 >> 24, w1, w1 >> 8);
+        uint32_t p2 = PIX_RGB565(w1 >> 16, w1 >> 24, w2);
+        uint32_t p3 = PIX_RGB565(w2 >> 8, w2 >> 16, w2 >> 24);
+
+        Pix_Store2(dst, PIX_PACK2(p0, p1));
+        Pix_Store2(dst + 2, PIX_PACK2(p2, p3));
+        src += 12;
+        dst += 4;
+    }
+
+    ST7789_Pix_RGB888_To_565_Ref(dst, src, n);
+}
+
+// ====================================================================
+// 对比测量 (私有函数)
+// ====================================================================
+
+/**
+ * @brief  读周期计数器 (主机构建没有 DWT，返回 0)
+ */
+static uint32_t Pix_Cycles(void)
+{
+#ifdef ST7789_BUS_HOST
+    return 0;
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief  两块输出都填上哨兵
+ */
+static void Pix_Fill_Sentinel(void)
+{
+    for (uint16_t i = 0; i < PIX_BENCH_WIDTH + 4; i++)
+    {
+        s_bench_ref[i]  = PIX_BENCH_SENTINEL;
+        s_bench_fast[i] = PIX_BENCH_SENTINEL;
+    }
+}
+
+/**
+ * @brief  比较两块输出的前 n 个像素
+ * @retval 不一致的像素数
+ */
+static uint32_t Pix_Compare(uint32_t n)
+{
+    uint32_t diff = 0;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (s_bench_ref[i] != s_bench_fast[i])
+            diff++;
+    }
+    return diff;
+}
+
+// ====================================================================
+// 对比测量 (对外接口)
+// ====================================================================
+void ST7789_Pix_Benchmark(ST7789_Pix_Bench_t* result)
+{
+    uint32_t seed = 0x12345678;
+    uint32_t t;
+
+    if (!result)
+        return;
+    memset(result, 0, sizeof(*result));
+
+    // 伪随机源数据 (线性同余)
+    for (uint16_t i = 0; i < sizeof(s_bench_src); i++)
+    {
+        seed           = seed * 1664525 + 1013904223;
+        s_bench_src[i] = (uint8_t) (seed >> 24);
+    }
+
+#ifndef ST7789_BUS_HOST
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    // 1. 逐位对比：输出对齐 / 非对齐 × 各种起始位、源地址偏移与宽度，含末尾哨兵
+    for (uint8_t off = 0; off < 2; off++)
+    {
+        for (uint16_t w = 0; w <= PIX_BENCH_MAX_W; w++)
+        {
+            for (uint8_t k = 0; k < 8; k++)
+            {
+                uint16_t fg = (uint16_t) (0xF800 | w);
+                uint16_t bg = (uint16_t) (0x07E0 | k);
+
+                Pix_Fill_Sentinel();
+                ST7789_Pix_Expand_Bits_Ref(s_bench_ref + off, s_bench_src, k, w, fg, bg);
+                ST7789_Pix_Expand_Bits(s_bench_fast + off, s_bench_src, k, w, fg, bg);
+                result->expand.mismatches += Pix_Compare(off + w + 2);
+
+                if (k >= 4)
+                    continue;
+                Pix_Fill_Sentinel();
+                ST7789_Pix_Swap16_Ref(s_bench_ref + off, s_bench_src + k, w);
+                ST7789_Pix_Swap16(s_bench_fast + off, s_bench_src + k, w);
+                result->swap16.mismatches += Pix_Compare(off + w + 2);
+
+                Pix_Fill_Sentinel();
+                ST7789_Pix_RGB888_To_565_Ref(s_bench_ref + off, s_bench_src + k, w);
+                ST7789_Pix_RGB888_To_565(s_bench_fast + off, s_bench_src + k, w);
+                result->rgb888.mismatches += Pix_Compare(off + w + 2);
+            }
+        }
+    }
+
+    // 2. 计时：同一行数据重复 PIX_BENCH_LINES 次，关中断避免被打断
+#ifndef ST7789_BUS_HOST
+    __disable_irq();
+#endif
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_Expand_Bits_Ref(s_bench_ref, s_bench_src, 0, PIX_BENCH_WIDTH, 0xFFFF, 0);
+    }
+    result->expand.ref_cycles = Pix_Cycles() - t;
+
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_Expand_Bits(s_bench_fast, s_bench_src, 0, PIX_BENCH_WIDTH, 0xFFFF, 0);
+    }
+    result->expand.fast_cycles = Pix_Cycles() - t;
+
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_Swap16_Ref(s_bench_ref, s_bench_src, PIX_BENCH_WIDTH);
+    }
+    result->swap16.ref_cycles = Pix_Cycles() - t;
+
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_Swap16(s_bench_fast, s_bench_src, PIX_BENCH_WIDTH);
+    }
+    result->swap16.fast_cycles = Pix_Cycles() - t;
+
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_RGB888_To_565_Ref(s_bench_ref, s_bench_src, PIX_BENCH_WIDTH);
+    }
+    result->rgb888.ref_cycles = Pix_Cycles() - t;
+
+    t = Pix_Cycles();
+    for (uint16_t i = 0; i < PIX_BENCH_LINES; i++)
+    {
+        ST7789_Pix_RGB888_To_565(s_bench_fast, s_bench_src, PIX_BENCH_WIDTH);
+    }
+    result->rgb888.fast_cycles = Pix_Cycles() - t;
+#ifndef ST7789_BUS_HOST
+    __enable_irq();
+#endif
+}
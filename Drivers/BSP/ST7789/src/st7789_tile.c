@@ -0,0 +1,260 @@
+/**
+ * @file    st7789_tile.c
+ * @brief   ST7789 脏矩形合成层实现
+ */
+
+#include "st7789_tile.h"
+#include "st7789_pipe.h"
+#include "st7789_pix.h"
+#include <string.h>
+
+#define TILE_PIXELS (ST7789_TILE_SIZE * ST7789_TILE_SIZE)
+#define TILE_SHIFT 4 // log2(ST7789_TILE_SIZE)
+#define TILE_MASK (ST7789_TILE_SIZE - 1)
+#define TILE_Y_END (ST7789_TILE_Y + ST7789_TILE_ROWS * ST7789_TILE_SIZE)
+
+// 瓦片副本放在 CCM (NOLOAD 段，启动代码不清零，由 ST7789_Tile_Init 初始化)
+static uint16_t s_tiles[ST7789_TILE_ROWS][ST7789_TILE_COLS][TILE_PIXELS]
+    __attribute__((section(".ccm_noinit")));
+
+static uint16_t s_tile_dirty[ST7789_TILE_ROWS]; // 每行一个位图，bit n = 第 n 列瓦片脏
+static uint8_t  s_tile_flushing = 0;            // 推送期间不再回写瓦片
+
+/**
+ * @brief  屏幕坐标 -> 瓦片副本中的像素地址 (私有，调用者保证在区域内)
+ */
+static inline uint16_t* Tile_Pixel(uint16_t x, uint16_t y)
+{
+    uint16_t ty = y - ST7789_TILE_Y;
+
+    return &s_tiles[ty >> TILE_SHIFT][x >> TILE_SHIFT][((ty & TILE_MASK) << TILE_SHIFT) +
+                                                       (x & TILE_MASK)];
+}
+
+/**
+ * @brief  矩形与瓦片区域求交 (私有)
+ * @retval 1: 有交集，结果写回 x/y/w/h
+ * @retval 0: 无交集
+ */
+static uint8_t Tile_Clip(uint16_t* x, uint16_t* y, uint16_t* w, uint16_t* h)
+{
+    if (*w == 0 || *h == 0 || *x >= TFT_COLUMN_NUMBER)
+        return 0;
+    if (*y >= TILE_Y_END || *y + *h <= ST7789_TILE_Y)
+        return 0;
+
+    if (*y < ST7789_TILE_Y)
+    {
+        *h -= ST7789_TILE_Y - *y;
+        *y = ST7789_TILE_Y;
+    }
+    if (*y + *h > TILE_Y_END)
+        *h = TILE_Y_END - *y;
+    if (*x + *w > TFT_COLUMN_NUMBER)
+        *w = TFT_COLUMN_NUMBER - *x;
+
+    return 1;
+}
+
+/**
+ * @brief  标记矩形覆盖的瓦片为脏 (私有，调用者保证在区域内)
+ */
+static void Tile_Mark_Dirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    uint16_t tx0  = x >> TILE_SHIFT;
+    uint16_t tx1  = (x + w - 1) >> TILE_SHIFT;
+    uint16_t ty0  = (y - ST7789_TILE_Y) >> TILE_SHIFT;
+    uint16_t ty1  = (y + h - 1 - ST7789_TILE_Y) >> TILE_SHIFT;
+    uint16_t mask = (uint16_t) (((1U << (tx1 + 1)) - 1) & ~((1U << tx0) - 1));
+
+    for (uint16_t ty = ty0; ty <= ty1; ty++)
+    {
+        s_tile_dirty[ty] |= mask;
+    }
+}
+
+void ST7789_Tile_Init(void)
+{
+    memset(s_tiles, 0, sizeof(s_tiles));
+    memset(s_tile_dirty, 0, sizeof(s_tile_dirty));
+    s_tile_flushing = 0;
+}
+
+uint8_t ST7789_Tile_Contains(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (s_tile_flushing || w == 0 || h == 0)
+        return 0;
+
+    return (x + w <= TFT_COLUMN_NUMBER && y >= ST7789_TILE_Y && y + h <= TILE_Y_END) ? 1 : 0;
+}
+
+uint8_t ST7789_Tile_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    uint8_t captured = ST7789_Tile_Contains(x, y, w, h);
+
+    if (s_tile_flushing || !Tile_Clip(&x, &y, &w, &h))
+        return 0;
+
+    for (uint16_t row = 0; row < h; row++)
+    {
+        uint16_t col = 0;
+        while (col < w)
+        {
+            // 一次处理一个瓦片内的一段连续像素
+            uint16_t  cx   = x + col;
+            uint16_t  span = ST7789_TILE_SIZE - (cx & TILE_MASK);
+            uint16_t* dst  = Tile_Pixel(cx, y + row);
+
+            if (span > w - col)
+                span = w - col;
+            for (uint16_t i = 0; i < span; i++)
+            {
+                dst[i] = color;
+            }
+            col += span;
+        }
+    }
+
+    if (captured)
+        Tile_Mark_Dirty(x, y, w, h);
+    return captured;
+}
+
+uint8_t ST7789_Tile_Blit(uint16_t       x,
+                         uint16_t       y,
+                         uint16_t       w,
+                         uint16_t       h,
+                         const uint8_t* data,
+                         uint8_t        native16)
+{
+    uint8_t  captured = ST7789_Tile_Contains(x, y, w, h);
+    uint16_t src_w    = w; // 源数据行宽 (裁剪前)
+    uint16_t src_x    = x;
+    uint16_t src_y    = y;
+
+    if (s_tile_flushing || !Tile_Clip(&x, &y, &w, &h))
+        return 0;
+
+    for (uint16_t row = 0; row < h; row++)
+    {
+        uint32_t       idx = (uint32_t) (y + row - src_y) * src_w + (x - src_x);
+        const uint8_t* src = data + idx * 2;
+        uint16_t       col = 0;
+
+        while (col < w)
+        {
+            uint16_t  cx   = x + col;
+            uint16_t  span = ST7789_TILE_SIZE - (cx & TILE_MASK);
+            uint16_t* dst  = Tile_Pixel(cx, y + row);
+
+            if (span > w - col)
+                span = w - col;
+            if (native16)
+            {
+                memcpy(dst, src, span * 2);
+            }
+            else
+            {
+                ST7789_Pix_Swap16(dst, src, span);
+            }
+            src += span * 2;
+            col += span;
+        }
+    }
+
+    if (captured)
+        Tile_Mark_Dirty(x, y, w, h);
+    return captured;
+}
+
+void ST7789_Tile_Write_Lines(uint16_t        x,
+                             uint16_t        y,
+                             uint16_t        w,
+                             uint16_t        rows,
+                             const uint16_t* src,
+                             uint8_t         dirty)
+{
+    if (s_tile_flushing)
+        return;
+
+    uint16_t cx = x, cy = y, cw = w, ch = rows;
+    if (!Tile_Clip(&cx, &cy, &cw, &ch))
+        return;
+
+    for (uint16_t row = 0; row < ch; row++)
+    {
+        const uint16_t* line = src + (uint32_t) (cy + row - y) * w + (cx - x);
+        uint16_t        col  = 0;
+
+        while (col < cw)
+        {
+            uint16_t span = ST7789_TILE_SIZE - ((cx + col) & TILE_MASK);
+
+            if (span > cw - col)
+                span = cw - col;
+            memcpy(Tile_Pixel(cx + col, cy + row), line + col, span * 2);
+            col += span;
+        }
+    }
+
+    if (dirty)
+        Tile_Mark_Dirty(cx, cy, cw, ch);
+}
+
+uint8_t ST7789_Tile_Is_Dirty(void)
+{
+    for (uint16_t ty = 0; ty < ST7789_TILE_ROWS; ty++)
+    {
+        if (s_tile_dirty[ty])
+            return 1;
+    }
+    return 0;
+}
+
+void ST7789_Tile_Flush(void)
+{
+    s_tile_flushing = 1;
+
+    for (uint16_t ty = 0; ty < ST7789_TILE_ROWS; ty++)
+    {
+        uint16_t bits = s_tile_dirty[ty];
+        uint16_t tx   = 0;
+
+        s_tile_dirty[ty] = 0;
+
+        while (bits >> tx)
+        {
+            // 找出一段相邻的脏瓦片 [tx0, tx)，合并成一个窗口
+            if (!(bits & (1U << tx)))
+            {
+                tx++;
+                continue;
+            }
+            uint16_t tx0 = tx;
+            while (tx < ST7789_TILE_COLS && (bits & (1U << tx)))
+                tx++;
+
+            uint16_t run_w = (tx - tx0) * ST7789_TILE_SIZE;
+            if (!ST7789_Pipe_Begin_Direct(tx0 * ST7789_TILE_SIZE,
+                                          ST7789_TILE_Y + ty * ST7789_TILE_SIZE,
+                                          run_w,
+                                          ST7789_TILE_SIZE))
+                continue;
+
+            // CCM 不能作为 DMA 源：逐行拷进 SRAM 行缓冲再发送
+            for (uint16_t row = 0; row < ST7789_TILE_SIZE; row++)
+            {
+                uint16_t* line = ST7789_Pipe_Line();
+                for (uint16_t t = tx0; t < tx; t++)
+                {
+                    memcpy(line + (t - tx0) * ST7789_TILE_SIZE,
+                           &s_tiles[ty][t][row << TILE_SHIFT],
+                           ST7789_TILE_SIZE * 2);
+                }
+            }
+            ST7789_Pipe_End();
+        }
+    }
+
+    s_tile_flushing = 0;
+}
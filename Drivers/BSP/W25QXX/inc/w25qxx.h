@@ -0,0 +1,136 @@
+/**
+ * @file    w25qxx.h
+ * @brief   W25Qxx SPI NOR Flash 只读驱动接口
+ * @note    SPI1 + DMA2 读数据 (0x03 Read Data)，用于外部字库等只读资源。
+ *          数据由编程器或其他工具预先写入，本驱动不提供擦写。
+ *          定义 W25QXX_FILE_EMU 时编译主机后端 (w25qxx_file.c)：用一个文件代替 Flash，
+ *          便于在 PC 上统计查找命中率与读取开销。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __W25QXX_H
+#define __W25QXX_H
+
+#ifndef W25QXX_FILE_EMU
+#include "stm32f4xx.h"
+#endif
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 硬件引脚定义 (Hardware Pin Definitions)
+ * ================================================================== */
+
+/**
+ * @brief SPI 外设定义 (APB2 84MHz / 2 = 42MHz，低于 0x03 指令的 50MHz 上限)
+ */
+#define W25Q_SPI_PERIPH SPI1
+#define W25Q_SPI_CLK    RCC_APB2Periph_SPI1
+
+/**
+ * @brief SPI 引脚定义 (SCK PB3, MISO PB4, MOSI PB5)
+ */
+#define W25Q_SPI_PORT     GPIOB
+#define W25Q_SPI_SCK_PIN  GPIO_Pin_3
+#define W25Q_SPI_MISO_PIN GPIO_Pin_4
+#define W25Q_SPI_MOSI_PIN GPIO_Pin_5
+
+/**
+ * @brief 片选引脚定义
+ */
+#define W25Q_CS_PORT GPIOB
+#define W25Q_CS_PIN  GPIO_Pin_14
+
+#define W25Q_CS_SET() GPIO_SetBits(W25Q_CS_PORT, W25Q_CS_PIN)
+#define W25Q_CS_CLR() GPIO_ResetBits(W25Q_CS_PORT, W25Q_CS_PIN)
+
+/**
+ * @brief DMA 定义 (SPI1_RX: DMA2 Stream2 Ch3，SPI1_TX: DMA2 Stream3 Ch3)
+ * @note  FSMC 屏幕后端占用 DMA2 Stream0，两者不冲突
+ */
+#define W25Q_DMA_CLK        RCC_AHB1Periph_DMA2
+#define W25Q_DMA_CHANNEL    DMA_Channel_3
+#define W25Q_DMA_RX_STREAM  DMA2_Stream2
+#define W25Q_DMA_TX_STREAM  DMA2_Stream3
+#define W25Q_DMA_RX_FLAG_TC DMA_FLAG_TCIF2
+
+/**
+ * @brief 少于该字节数的读取直接轮询 (DMA 配置开销比传输本身还大)
+ */
+#define W25Q_DMA_MIN_BYTES 16
+
+/* ==================================================================
+ * 2. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 操作状态
+ */
+typedef enum
+{
+    W25Q_OK      = 0, ///< 操作成功
+    W25Q_ERROR   = 1, ///< 未识别到芯片 / 文件打不开
+    W25Q_TIMEOUT = 2  ///< DMA 传输超时
+} W25Q_Status_e;
+
+/**
+ * @brief 读取统计
+ * @note  估算总线时间：每次读取额外 4 字节 (指令 + 24 位地址)，每字节 8 个 SPI 时钟
+ */
+typedef struct
+{
+    uint32_t reads; ///< 读取次数 (CS 有效次数)
+    uint32_t bytes; ///< 读出的数据字节数
+} W25Q_Stats_t;
+
+/* ==================================================================
+ * 3. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  初始化 SPI1、DMA 与片选，唤醒芯片并校验 JEDEC ID
+ * @retval W25Q_OK: 识别到 W25Qxx (厂商 ID 0xEF)
+ * @retval W25Q_ERROR: 未识别到芯片
+ */
+W25Q_Status_e W25Q_Init(void);
+
+/**
+ * @brief  读取 JEDEC ID
+ * @retval (厂商 << 16) | (类型 << 8) | 容量，如 W25Q128 为 0xEF4018
+ */
+uint32_t W25Q_Read_JEDEC_ID(void);
+
+/**
+ * @brief  读取数据 (阻塞)
+ * @note   len >= W25Q_DMA_MIN_BYTES 时由 DMA 收发，否则轮询
+ * @param  addr: Flash 地址 (24 位)
+ * @param  buf:  输出缓冲
+ * @param  len:  字节数
+ * @retval W25Q_OK / W25Q_TIMEOUT
+ */
+W25Q_Status_e W25Q_Read(uint32_t addr, uint8_t* buf, uint16_t len);
+
+/**
+ * @brief  读取统计信息
+ * @param  stats: 输出
+ * @retval None
+ */
+void W25Q_Get_Stats(W25Q_Stats_t* stats);
+
+/**
+ * @brief  统计清零
+ * @retval None
+ */
+void W25Q_Reset_Stats(void);
+
+#ifdef W25QXX_FILE_EMU
+/**
+ * @brief  主机后端：指定代替 Flash 的镜像文件 (W25Q_Init 之前调用)
+ * @param  path: 文件路径，文件外的地址读出 0xFF (与擦除后的 Flash 相同)
+ * @retval None
+ */
+void W25Q_File_Set_Path(const char* path);
+#endif
+
+#endif /* __W25QXX_H */
@@ -0,0 +1,227 @@
+/**
+ * @file    w25qxx.c
+ * @brief   W25Qxx SPI NOR Flash 只读驱动实现 (SPI1 + DMA2)
+ */
+
+#include "w25qxx.h"
+
+#ifndef W25QXX_FILE_EMU
+
+#define W25Q_CMD_READ_DATA    0x03 // 读数据 (24 位地址)
+#define W25Q_CMD_JEDEC_ID     0x9F // 读 JEDEC ID
+#define W25Q_CMD_RELEASE_PD   0xAB // 退出掉电模式
+#define W25Q_MANUFACTURER_ID  0xEF // Winbond
+#define W25Q_DMA_TIMEOUT      100000
+
+/**
+ * @brief RX/TX 两个 Stream 的全部中断标志 (启动前统一清除)
+ */
+#define W25Q_DMA_RX_FLAG_ALL                                                                       \
+    (DMA_FLAG_TCIF2 | DMA_FLAG_HTIF2 | DMA_FLAG_TEIF2 | DMA_FLAG_DMEIF2 | DMA_FLAG_FEIF2)
+#define W25Q_DMA_TX_FLAG_ALL                                                                       \
+    (DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | DMA_FLAG_TEIF3 | DMA_FLAG_DMEIF3 | DMA_FLAG_FEIF3)
+
+static W25Q_Stats_t s_w25q_stats = {0};
+static uint8_t      s_dummy_tx   = 0xFF; // DMA 读取时 MOSI 上发送的填充字节
+
+// ====================================================================
+// 硬件层初始化 (私有函数)
+// ====================================================================
+static void W25Q_Hardware_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    SPI_InitTypeDef  SPI_InitStructure;
+
+    // 1. 开启时钟
+    RCC_APB2PeriphClockCmd(W25Q_SPI_CLK, ENABLE);
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOB, ENABLE);
+
+    // 2. 片选
+    GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
+    GPIO_InitStructure.GPIO_Pin   = W25Q_CS_PIN;
+    GPIO_Init(W25Q_CS_PORT, &GPIO_InitStructure);
+    W25Q_CS_SET();
+
+    // 3. SPI 引脚 (SCK, MISO, MOSI)
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+    GPIO_InitStructure.GPIO_Pin  = W25Q_SPI_SCK_PIN | W25Q_SPI_MISO_PIN | W25Q_SPI_MOSI_PIN;
+    GPIO_Init(W25Q_SPI_PORT, &GPIO_InitStructure);
+    GPIO_PinAFConfig(W25Q_SPI_PORT, GPIO_PinSource3, GPIO_AF_SPI1);
+    GPIO_PinAFConfig(W25Q_SPI_PORT, GPIO_PinSource4, GPIO_AF_SPI1);
+    GPIO_PinAFConfig(W25Q_SPI_PORT, GPIO_PinSource5, GPIO_AF_SPI1);
+
+    // 4. SPI 参数 (模式 0，MSB First)
+    SPI_InitStructure.SPI_Direction         = SPI_Direction_2Lines_FullDuplex;
+    SPI_InitStructure.SPI_Mode              = SPI_Mode_Master;
+    SPI_InitStructure.SPI_DataSize          = SPI_DataSize_8b;
+    SPI_InitStructure.SPI_CPOL              = SPI_CPOL_Low;
+    SPI_InitStructure.SPI_CPHA              = SPI_CPHA_1Edge;
+    SPI_InitStructure.SPI_NSS               = SPI_NSS_Soft;
+    SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_2; // APB2=84M, /2=42M
+    SPI_InitStructure.SPI_FirstBit          = SPI_FirstBit_MSB;
+    SPI_InitStructure.SPI_CRCPolynomial     = 7;
+    SPI_Init(W25Q_SPI_PERIPH, &SPI_InitStructure);
+
+    SPI_Cmd(W25Q_SPI_PERIPH, ENABLE);
+}
+
+/**
+ * @brief  DMA 的一次性配置 (私有)
+ * @note   RX 写入调用者缓冲 (地址递增)，TX 反复发送同一个填充字节 (地址不变)；
+ *         每次读取只改地址与长度。传输完成靠轮询 RX 的 TC 标志，不开中断。
+ */
+static void W25Q_DMA_Init(void)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+
+    RCC_AHB1PeriphClockCmd(W25Q_DMA_CLK, ENABLE);
+    DMA_DeInit(W25Q_DMA_RX_STREAM);
+    DMA_DeInit(W25Q_DMA_TX_STREAM);
+
+    DMA_InitStructure.DMA_Channel            = W25Q_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &W25Q_SPI_PERIPH->DR;
+    DMA_InitStructure.DMA_Memory0BaseAddr    = 0;
+    DMA_InitStructure.DMA_DIR                = DMA_DIR_PeripheralToMemory;
+    DMA_InitStructure.DMA_BufferSize         = 1;
+    DMA_InitStructure.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc          = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode               = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority           = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode           = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold      = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst        = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst    = DMA_PeripheralBurst_Single;
+    DMA_Init(W25Q_DMA_RX_STREAM, &DMA_InitStructure);
+
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t) &s_dummy_tx;
+    DMA_InitStructure.DMA_DIR             = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_MemoryInc       = DMA_MemoryInc_Disable;
+    DMA_Init(W25Q_DMA_TX_STREAM, &DMA_InitStructure);
+
+    SPI_I2S_DMACmd(W25Q_SPI_PERIPH, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+}
+
+/**
+ * @brief  收发一个字节 (私有，轮询)
+ */
+static uint8_t W25Q_SPI_Transfer(uint8_t byte)
+{
+    while (SPI_I2S_GetFlagStatus(W25Q_SPI_PERIPH, SPI_I2S_FLAG_TXE) == RESET)
+        ;
+    SPI_I2S_SendData(W25Q_SPI_PERIPH, byte);
+    while (SPI_I2S_GetFlagStatus(W25Q_SPI_PERIPH, SPI_I2S_FLAG_RXNE) == RESET)
+        ;
+    return (uint8_t) SPI_I2S_ReceiveData(W25Q_SPI_PERIPH);
+}
+
+/**
+ * @brief  DMA 收 len 字节 (私有)
+ * @note   调用前 RXNE 必须已清 (前面的轮询收发每字节都读了 DR)
+ */
+static W25Q_Status_e W25Q_DMA_Receive(uint8_t* buf, uint16_t len)
+{
+    uint32_t timeout = W25Q_DMA_TIMEOUT;
+
+    DMA_ClearFlag(W25Q_DMA_RX_STREAM, W25Q_DMA_RX_FLAG_ALL);
+    DMA_ClearFlag(W25Q_DMA_TX_STREAM, W25Q_DMA_TX_FLAG_ALL);
+
+    W25Q_DMA_RX_STREAM->M0AR = (uint32_t) buf;
+    W25Q_DMA_RX_STREAM->NDTR = len;
+    W25Q_DMA_TX_STREAM->NDTR = len;
+
+    // 先开 RX 再开 TX，保证第一个字节收得到
+    DMA_Cmd(W25Q_DMA_RX_STREAM, ENABLE);
+    DMA_Cmd(W25Q_DMA_TX_STREAM, ENABLE);
+
+    while (DMA_GetFlagStatus(W25Q_DMA_RX_STREAM, W25Q_DMA_RX_FLAG_TC) == RESET)
+    {
+        if (--timeout == 0)
+            break;
+    }
+
+    DMA_Cmd(W25Q_DMA_TX_STREAM, DISABLE);
+    DMA_Cmd(W25Q_DMA_RX_STREAM, DISABLE);
+    return timeout ? W25Q_OK : W25Q_TIMEOUT;
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+W25Q_Status_e W25Q_Init(void)
+{
+    W25Q_Hardware_Init();
+    W25Q_DMA_Init();
+
+    // 上次可能停在掉电模式，先唤醒 (tRES1 = 3us，后面读 ID 的时间已足够)
+    W25Q_CS_CLR();
+    W25Q_SPI_Transfer(W25Q_CMD_RELEASE_PD);
+    W25Q_CS_SET();
+
+    return ((W25Q_Read_JEDEC_ID() >> 16) == W25Q_MANUFACTURER_ID) ? W25Q_OK : W25Q_ERROR;
+}
+
+uint32_t W25Q_Read_JEDEC_ID(void)
+{
+    uint32_t id;
+
+    W25Q_CS_CLR();
+    W25Q_SPI_Transfer(W25Q_CMD_JEDEC_ID);
+    id = (uint32_t) W25Q_SPI_Transfer(0xFF) << 16;
+    id |= (uint32_t) W25Q_SPI_Transfer(0xFF) << 8;
+    id |= W25Q_SPI_Transfer(0xFF);
+    W25Q_CS_SET();
+
+    return id;
+}
+
+W25Q_Status_e W25Q_Read(uint32_t addr, uint8_t* buf, uint16_t len)
+{
+    W25Q_Status_e status = W25Q_OK;
+
+    W25Q_CS_CLR();
+    W25Q_SPI_Transfer(W25Q_CMD_READ_DATA);
+    W25Q_SPI_Transfer((uint8_t) (addr >> 16));
+    W25Q_SPI_Transfer((uint8_t) (addr >> 8));
+    W25Q_SPI_Transfer((uint8_t) addr);
+
+    if (len >= W25Q_DMA_MIN_BYTES)
+    {
+        status = W25Q_DMA_Receive(buf, len);
+    }
+    else
+    {
+        for (uint16_t i = 0; i < len; i++)
+        {
+            buf[i] = W25Q_SPI_Transfer(0xFF);
+        }
+    }
+
+    // RX 完成时最后一个字节已经收完，SPI 不再忙
+    while (SPI_I2S_GetFlagStatus(W25Q_SPI_PERIPH, SPI_I2S_FLAG_BSY) == SET)
+        ;
+    W25Q_CS_SET();
+
+    s_w25q_stats.reads++;
+    s_w25q_stats.bytes += len;
+    return status;
+}
+
+void W25Q_Get_Stats(W25Q_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_w25q_stats;
+}
+
+void W25Q_Reset_Stats(void)
+{
+    s_w25q_stats.reads = 0;
+    s_w25q_stats.bytes = 0;
+}
+
+#endif /* W25QXX_FILE_EMU */
@@ -0,0 +1,70 @@
+/**
+ * @file    w25qxx_file.c
+ * @brief   W25Qxx 主机后端：用镜像文件代替 SPI Flash
+ * @note    只在定义 W25QXX_FILE_EMU 的主机构建中编译。接口与统计和真实驱动一致，
+ *          外部字库等上层模块不用修改即可在 PC 上运行，用录下来的接口数据
+ *          统计缓存命中率与 Flash 读取次数/字节数。
+ */
+
+#include "w25qxx.h"
+
+#ifdef W25QXX_FILE_EMU
+
+#include <stdio.h>
+#include <string.h>
+
+#define W25Q_FILE_JEDEC_ID 0xEF4018 // 按 W25Q128 (16MB) 回报
+
+static const char*  s_file_path  = NULL;
+static FILE*        s_file       = NULL;
+static W25Q_Stats_t s_w25q_stats = {0};
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+void W25Q_File_Set_Path(const char* path)
+{
+    s_file_path = path;
+}
+
+W25Q_Status_e W25Q_Init(void)
+{
+    if (s_file)
+        fclose(s_file);
+
+    s_file = s_file_path ? fopen(s_file_path, "rb") : NULL;
+    return s_file ? W25Q_OK : W25Q_ERROR;
+}
+
+uint32_t W25Q_Read_JEDEC_ID(void)
+{
+    return s_file ? W25Q_FILE_JEDEC_ID : 0xFFFFFF;
+}
+
+W25Q_Status_e W25Q_Read(uint32_t addr, uint8_t* buf, uint16_t len)
+{
+    size_t got = 0;
+
+    // 文件外的部分与擦除后的 Flash 一样读出 0xFF
+    if (s_file && fseek(s_file, (long) addr, SEEK_SET) == 0)
+        got = fread(buf, 1, len, s_file);
+    memset(buf + got, 0xFF, len - got);
+
+    s_w25q_stats.reads++;
+    s_w25q_stats.bytes += len;
+    return W25Q_OK;
+}
+
+void W25Q_Get_Stats(W25Q_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_w25q_stats;
+}
+
+void W25Q_Reset_Stats(void)
+{
+    s_w25q_stats.reads = 0;
+    s_w25q_stats.bytes = 0;
+}
+
+#endif /* W25QXX_FILE_EMU */
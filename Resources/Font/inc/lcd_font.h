@@ -1,7 +1,7 @@
 /**
  * @file    lcd_font.h
  * @brief   通用 LCD 字体显示引擎
- * @note    支持 ASCII 与 GBK 汉字混合排版，支持自定义字库挂载。
+ * @note    支持 ASCII 与 UTF-8 汉字混合排版，支持自定义字库挂载。
  *          本模块不依赖具体的 LCD 驱动，通过底层绘图接口解耦。
  * @author  meng-ming
  * @version 1.0
@@ -20,11 +20,16 @@
 
 /**
  * @brief  在指定位置显示字符串 (支持中英混合、自动换行)
- * @note   处理 GBK 编码字符串，自动检测 ASCII/汉字并调用对应渲染。
+ * @note   处理 UTF-8 编码字符串，自动检测 ASCII/汉字并调用对应渲染。
+ *         汉字先解码为 Unicode 码点，再在字体的升序码点表中二分查找，
+ *         查找开销只与字库大小的对数相关；未收录的字符画红色方块占位。
+ *         同一行上连续的字收集成一段，整段只开一次地址窗口，逐行展开进行缓冲
+ *         由 DMA 连续发送；ASCII 与汉字可以混排，各字底部对齐。
+ *         带 ascii_metrics 的比例字体按每个字的步进宽度紧排。
  *         支持屏幕边界自动换行，超出区域裁剪。
  * @param  x:        起始 X 坐标 (像素)
  * @param  y:        起始 Y 坐标 (像素)
- * @param  str:      要显示的字符串 (支持 GBK 编码，NULL 终止)
+ * @param  str:      要显示的字符串 (UTF-8 编码，NULL 终止)
  * @param  font:     字体配置描述符指针 (font_info_t)
  * @param  color_fg: 前景色 (RGB565)
  * @param  color_bg: 背景色 (RGB565)
@@ -37,4 +42,42 @@ void LCD_Show_String(uint16_t           x,
                      uint16_t           color_fg,
                      uint16_t           color_bg);
 
+/**
+ * @brief  测量字符串显示后占用的像素尺寸
+ * @note   与 LCD_Show_String 使用同样的字模查找与步进宽度 (比例字体按 font_metric_t)，
+ *         缺字按占位块计入；不考虑屏幕边界的自动换行。
+ *         外部字库 (LCD_FONT_EXT) 中的字按字体的汉字点阵计宽，不读 Flash、不占缓存。
+ *         可用于擦除旧文字时只填充新文字没有覆盖到的部分。
+ * @param  str:  要测量的字符串 (UTF-8 编码，NULL 终止)
+ * @param  font: 字体配置描述符指针
+ * @param  w:    输出宽度 (最宽的一行，px)，可为 NULL
+ * @param  h:    输出高度 (px)，可为 NULL
+ * @retval None
+ */
+void LCD_Measure_String(const char* str, const font_info_t* font, uint16_t* w, uint16_t* h);
+
+/* ==================================================================
+ * 2. 字符查找 (Character Lookup)
+ * ================================================================== */
+
+/**
+ * @brief  解码一个 UTF-8 字符
+ * @note   LCD_Show_String / LCD_Measure_String 对非 ASCII 字节调用。只检查首字节类型与
+ *         后续字节的 10xxxxxx 形式，不拒绝过长编码与代理区码点 (按解出的码点查表，查不到画占位块)。
+ * @param  str: 字符串当前位置
+ * @param  cp:  输出 Unicode 码点，非法序列输出 0
+ * @retval 消耗的字节数 (非法或被截断的序列返回 1，按单字节跳过重新对齐)
+ */
+uint8_t LCD_UTF8_Decode(const char* str, uint32_t* cp);
+
+/**
+ * @brief  在字体的码点表中查找字模序号 (二分查找)
+ * @note   码点表 (hzk_code) 必须严格升序。码点 < 0x80 的条目也能查到，
+ *         但 LCD_Show_String 遇到可见 ASCII 字符时优先使用 ASCII 字模。
+ * @param  font: 字体配置描述符指针
+ * @param  cp:   Unicode 码点
+ * @retval 字模序号，未收录 (或超出 BMP) 返回 -1
+ */
+int32_t LCD_Find_Code(const font_info_t* font, uint32_t cp);
+
 #endif /* __LCD_FONT_H */
\ No newline at end of file
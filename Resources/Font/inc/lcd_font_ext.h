@@ -0,0 +1,124 @@
+/**
+ * @file    lcd_font_ext.h
+ * @brief   外部 SPI Flash 汉字字库 (GBK 全字符集) 与 RAM 字模缓存
+ * @note    片内码点表里没有的字 (接口返回的天气、风向、任意城市名) 到 W25Qxx 中查找：
+ *          Unicode 码点经 Flash 中的对照表换成 GBK 码，字模地址由 GBK 码直接算出，
+ *          读出的位图放进 RAM 中的 LRU 缓存，同一个字下次不再读 Flash。
+ *          镜像由 Utils/font_ext_image.py 生成，格式见 2. 类型定义。
+ *          只有描述符中 hzk_ext = 1 的字体查找外部字库 (CMake 选项 LCD_FONT_EXT)。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __LCD_FONT_EXT_H
+#define __LCD_FONT_EXT_H
+
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 配置 (Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 字库镜像在 Flash 中的起始地址
+ */
+#ifndef LCD_FONT_EXT_BASE
+#define LCD_FONT_EXT_BASE 0x000000
+#endif
+
+/**
+ * @brief 缓存的字模数
+ * @note  一段文字里取到的字在这段画完之前不会被淘汰，
+ *        因此不能少于 lcd_font.c 中一段的最大字数 (32)
+ */
+#define LCD_FONT_EXT_SLOTS 64
+
+/**
+ * @brief 单个字模的最大字节数 (24x24 点阵)，默认 64 x 72 = 4.5K SRAM
+ */
+#define LCD_FONT_EXT_GLYPH_MAX 72
+
+#define LCD_FONT_EXT_MAX_SECTIONS 4 ///< 镜像中最多的字号数
+
+/* ==================================================================
+ * 2. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 字库镜像头 (位于 LCD_FONT_EXT_BASE，小端)
+ * @note  镜像布局：
+ *        - 对照表：map_offset 处 65536 个 uint16_t，下标为 Unicode 码点，值为 GBK 码，0 表示没有
+ *        - 字模区：每个字号一段，按 GBK 码排列 (首字节 0x81~0xFE，尾字节 0x40~0xFE 去掉 0x7F，
+ *          每个首字节 190 个)，字模为逐行 LSB First、行按字节对齐，与片内字库相同
+ */
+typedef struct
+{
+    char     magic[4];      ///< "WCFX"
+    uint16_t version;       ///< 1
+    uint16_t section_count; ///< 字号数
+    uint32_t map_offset;    ///< Unicode -> GBK 对照表偏移 (相对镜像起始)
+
+    struct
+    {
+        uint8_t  w, h;        ///< 点阵宽高 (px)
+        uint16_t glyph_bytes; ///< 单个字模字节数
+        uint32_t offset;      ///< 字模区偏移 (相对镜像起始)
+    } sections[LCD_FONT_EXT_MAX_SECTIONS];
+} LCD_Font_Ext_Header_t;
+
+/**
+ * @brief 缓存统计
+ * @note  Flash 读取次数与字节数见 W25Q_Get_Stats()
+ */
+typedef struct
+{
+    uint32_t lookups;   ///< 查找次数
+    uint32_t hits;      ///< 命中次数 (含已知缺字)
+    uint32_t misses;    ///< 未命中 (读 Flash) 次数
+    uint32_t absent;    ///< 字库中也没有的字 (结果同样缓存)
+    uint32_t evictions; ///< 淘汰次数
+    uint32_t bypass;    ///< 全部被钉住、无法缓存的次数
+} LCD_Font_Ext_Stats_t;
+
+/* ==================================================================
+ * 3. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  读取并校验镜像头
+ * @note   W25Q_Init() 成功后调用；失败时外部字库停用，缺字照常显示占位块
+ * @retval 1: 成功  0: 没有有效镜像
+ */
+uint8_t LCD_Font_Ext_Init(void);
+
+/**
+ * @brief  取一个字模
+ * @note   返回的位图在 LCD_Font_Ext_Release() 之前不会被淘汰，一段文字里的多个字可以同时持有
+ * @param  cp:   Unicode 码点
+ * @param  w, h: 点阵宽高 (px)，选择镜像中对应的字号
+ * @retval 位图指针，字库中没有该字 (或该字号) 时返回 NULL
+ */
+const uint8_t* LCD_Font_Ext_Get(uint32_t cp, uint8_t w, uint8_t h);
+
+/**
+ * @brief  解除本次取到的字模的钉住状态
+ * @note   一段文字发送完 (位图已展开进行缓冲) 后调用
+ * @retval None
+ */
+void LCD_Font_Ext_Release(void);
+
+/**
+ * @brief  读取统计
+ * @param  stats: 输出
+ * @retval None
+ */
+void LCD_Font_Ext_Get_Stats(LCD_Font_Ext_Stats_t* stats);
+
+/**
+ * @brief  计数清零
+ * @retval None
+ */
+void LCD_Font_Ext_Reset_Stats(void);
+
+#endif /* __LCD_FONT_EXT_H */
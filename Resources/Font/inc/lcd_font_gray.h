@@ -0,0 +1,86 @@
+/**
+ * @file    lcd_font_gray.h
+ * @brief   4-bpp 灰度 (抗锯齿) 字模的混色查表与逐行展开
+ * @note    灰度字模每像素 4 位 (0 = 背景色，15 = 前景色，格式见 font_variable.h)，
+ *          按 (前景色, 背景色) 预先算好 16 级 RGB565 混色表，展开时每像素只是一次查表，
+ *          不做乘法。混色表按颜色对缓存，同一种配色只计算一次。
+ *          展开结果与位图字模一样写进管线行缓冲、由 DMA 连续发送，也可以进入字模缓存。
+ *          灰度字模由 Utils/font_gray.py 在构建时生成 (CMake 选项 LCD_FONT_AA)。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __LCD_FONT_GRAY_H
+#define __LCD_FONT_GRAY_H
+
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 配置 (Configuration)
+ * ================================================================== */
+
+#define LCD_GRAY_LEVELS 16 ///< 灰度级数 (4-bpp)
+
+/**
+ * @brief 缓存的混色表数 (每个 32 字节)
+ * @note  界面上同时使用灰度字体的配色不多 (时钟白字、温度橙字、城市黑字)
+ */
+#define LCD_GRAY_LUT_SLOTS 4
+
+/* ==================================================================
+ * 2. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 混色表缓存统计
+ */
+typedef struct
+{
+    uint32_t hits;   ///< 命中次数
+    uint32_t builds; ///< 计算混色表的次数 (未命中)
+} LCD_Gray_Stats_t;
+
+/* ==================================================================
+ * 3. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  取 (前景色, 背景色) 的 16 级混色表
+ * @note   第 i 项为 bg + (fg - bg) * i / 15 (R/G/B 分量各自四舍五入)，
+ *         第 0 项与第 15 项正好是背景色与前景色。
+ *         返回的表在下一次调用前有效，一段文字取一次即可。
+ * @param  fg, bg: 前景色/背景色 (RGB565)
+ * @retval 混色表 (LCD_GRAY_LEVELS 项)
+ */
+const uint16_t* LCD_Gray_LUT(uint16_t fg, uint16_t bg);
+
+/**
+ * @brief  把灰度字模一行中从第 skip 列起的 w 列展开为 RGB565
+ * @param  dst:  输出像素
+ * @param  row:  字模当前行 (低半字节在前)
+ * @param  skip: 起始列 (比例字体的窗口)
+ * @param  w:    输出列数
+ * @param  lut:  LCD_Gray_LUT() 返回的混色表
+ * @retval None
+ */
+void LCD_Gray_Expand_Row(uint16_t*       dst,
+                         const uint8_t*  row,
+                         uint8_t         skip,
+                         uint16_t        w,
+                         const uint16_t* lut);
+
+/**
+ * @brief  读取统计
+ * @param  stats: 输出
+ * @retval None
+ */
+void LCD_Gray_Get_Stats(LCD_Gray_Stats_t* stats);
+
+/**
+ * @brief  计数清零
+ * @retval None
+ */
+void LCD_Gray_Reset_Stats(void);
+
+#endif /* __LCD_FONT_GRAY_H */
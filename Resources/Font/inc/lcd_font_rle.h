@@ -0,0 +1,67 @@
+/**
+ * @file    lcd_font_rle.h
+ * @brief   压缩字模 (包围盒 + 行程编码) 的流式解码
+ * @note    大号 ASCII 字库 (30x60 时钟数字、16x32) 在构建时压缩 (格式见 font_variable.h)，
+ *          显示时不展开整字，而是每次解出一行扫描线直接写进管线行缓冲，
+ *          与位图字模一样逐行拼装、由 DMA 连续发送。包围盒外的空白补背景色。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __LCD_FONT_RLE_H
+#define __LCD_FONT_RLE_H
+
+#include "font_variable.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 逐行解码位置
+ * @note  一段文字里每个压缩字各持有一个，逐行交替解码互不影响
+ */
+typedef struct
+{
+    const font_rle_glyph_t* glyph;  ///< 当前字模
+    const uint8_t*          group;  ///< 当前行组
+    uint8_t                 repeat; ///< 当前行组还剩几行
+    uint8_t                 row;    ///< 下一行在字符格内的行号
+    uint8_t                 left;   ///< 输出窗口在字符格内的起始列
+    uint8_t                 width;  ///< 输出窗口宽度 (px)
+} LCD_RLE_Cursor_t;
+
+/* ==================================================================
+ * 2. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  从字符格第 0 行开始解码一个字
+ * @note   每行输出字符格内 [left, left + width) 这几列：等宽字体为整个字符格，
+ *         比例字体为 font_metric_t 给出的窗口，窗口外的像素被裁掉。
+ * @param  cur:   解码位置
+ * @param  rle:   字模所在的压缩字库
+ * @param  glyph: 字模描述 (rle->glyphs 中的一项)
+ * @param  left:  输出窗口起始列
+ * @param  width: 输出窗口宽度 (px)
+ * @retval None
+ */
+void LCD_RLE_Begin(LCD_RLE_Cursor_t*       cur,
+                   const font_rle_t*       rle,
+                   const font_rle_glyph_t* glyph,
+                   uint8_t                 left,
+                   uint8_t                 width);
+
+/**
+ * @brief  解出下一行扫描线
+ * @note   写满 width 个 RGB565 像素，调用次数不应超过字符格高度
+ * @param  cur:    解码位置
+ * @param  dst:    输出像素
+ * @param  fg, bg: 前景色/背景色
+ * @retval None
+ */
+void LCD_RLE_Next_Row(LCD_RLE_Cursor_t* cur, uint16_t* dst, uint16_t fg, uint16_t bg);
+
+#endif /* __LCD_FONT_RLE_H */
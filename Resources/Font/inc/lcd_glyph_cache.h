@@ -0,0 +1,122 @@
+/**
+ * @file    lcd_glyph_cache.h
+ * @brief   展开后的 RGB565 字模 LRU 缓存
+ * @note    时钟数字每秒都用同样的前景/背景色重画，缓存展开结果后
+ *          命中时只需把像素行拷进管线行缓冲，省去逐位展开。
+ *          键为 (字模地址, 前景色, 背景色)，字模地址同时确定了字体与字符
+ *          (位图字模用数据地址，压缩字模用 font_rle_glyph_t 描述地址)。
+ *          像素池放在 CCM (CPU 拷贝到 SRAM 行缓冲后再由 DMA 发送)，
+ *          只有 font_info_t.glyph_cache 置 1 的字体使用缓存。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __LCD_GLYPH_CACHE_H
+#define __LCD_GLYPH_CACHE_H
+
+#include "st7789_tile.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 缓存配置 (Cache Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 像素池容量 (字节)
+ * @note  放在 CCM，默认取瓦片层副本 (st7789_tile.h) 用剩的全部空间，两者之和超过 64K 时链接报错：
+ *        - 瓦片 8 行 (默认，60K)：剩 4K，放得下 20 点阵的秒与日期，30x60 时钟数字不缓存
+ *          (font_time_30x60.glyph_cache 由 LCD_GLYPH_CACHE_FITS 置 0；
+ *          时间区由瓦片层合成，文本框只重画变化的数字)
+ *        - 瓦片 2 行 (15K)：剩 49K，30x60 时钟数字 0~9 与冒号 (11 x 3600 字节) 加上
+ *          20 点阵的秒与日期 (共约 46K) 全部进入缓存后不再淘汰
+ *        定义为 0 关闭缓存。
+ */
+#ifndef LCD_GLYPH_CACHE_BYTES
+#define LCD_GLYPH_CACHE_BYTES (ST7789_CCM_BYTES - ST7789_TILE_CCM_BYTES)
+#endif
+
+/**
+ * @brief 单个字模最多占像素池的比例 (1 / N)
+ * @note  像素池很小时，一个大字模会把其余字模全部挤出去，这样的字模直接展开、不缓存
+ */
+#define LCD_GLYPH_CACHE_MAX_SHARE 4
+
+/**
+ * @brief 宽 w、高 h 的字模能否进入缓存 (不超过单字上限)
+ * @note  字体描述符用它设置 glyph_cache：放不下的字体每个字都会走一次 bypass，不如不查
+ */
+#define LCD_GLYPH_CACHE_FITS(w, h)                                                                 \
+    ((uint32_t) (w) * (h) <= LCD_GLYPH_CACHE_BYTES / 2 / LCD_GLYPH_CACHE_MAX_SHARE)
+
+/**
+ * @brief 最多缓存的字模数
+ */
+#define LCD_GLYPH_CACHE_ENTRIES 48
+
+/* ==================================================================
+ * 2. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 缓存统计
+ */
+typedef struct
+{
+    uint32_t hits;       ///< 命中次数
+    uint32_t misses;     ///< 未命中 (展开后存入) 次数
+    uint32_t evictions;  ///< 为腾出空间淘汰的字模数
+    uint32_t bypass;     ///< 无法缓存 (超过单字上限或全部被钉住) 的次数
+    uint32_t bytes_used; ///< 当前占用的像素池字节数
+    uint16_t entries;    ///< 当前缓存的字模数
+} LCD_Glyph_Cache_Stats_t;
+
+/* ==================================================================
+ * 3. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  查找/分配一个展开后的字模
+ * @note   命中时返回已展开的 w*h 个 RGB565 像素；未命中时分配空间并返回，
+ *         由调用者立即展开填满 (*hit = 0)。取到的字模在 LCD_Glyph_Cache_Release()
+ *         之前不会被淘汰，一段文字里的多个字可以同时持有。
+ * @param  key:  字模地址 (作为键)
+ * @param  w, h: 字模宽高 (px)
+ * @param  fg, bg: 前景色/背景色
+ * @param  hit: 输出 1 = 命中，0 = 需要调用者填充
+ * @retval 像素指针，NULL 表示无法缓存 (调用者直接展开)
+ */
+uint16_t* LCD_Glyph_Cache_Get(const void* key,
+                              uint16_t    w,
+                              uint16_t    h,
+                              uint16_t    fg,
+                              uint16_t    bg,
+                              uint8_t*    hit);
+
+/**
+ * @brief  解除本次取到的字模的钉住状态
+ * @note   一段文字发送完 (像素已拷进行缓冲) 后调用
+ * @retval None
+ */
+void LCD_Glyph_Cache_Release(void);
+
+/**
+ * @brief  清空缓存 (统计保留)
+ * @retval None
+ */
+void LCD_Glyph_Cache_Clear(void);
+
+/**
+ * @brief  读取统计
+ * @param  stats: 输出
+ * @retval None
+ */
+void LCD_Glyph_Cache_Get_Stats(LCD_Glyph_Cache_Stats_t* stats);
+
+/**
+ * @brief  计数清零 (hits / misses / evictions / bypass)
+ * @retval None
+ */
+void LCD_Glyph_Cache_Reset_Stats(void);
+
+#endif /* __LCD_GLYPH_CACHE_H */
@@ -0,0 +1,85 @@
+/**
+ * @file    lcd_text_field.h
+ * @brief   按字差分重绘的单行文本框
+ * @note    记住上次显示的字符串和每个字的位置，更新时只重画内容或位置变化的字，
+ *          连续的变化字合并为一次 LCD_Show_String (一个窗口)；新文字比旧文字窄时
+ *          用一次填充擦掉多出来的部分。时钟每秒通常只有秒的个位变化，SPI 传输量从
+ *          整串降到一个字。
+ * @author  meng-ming
+ * @version 1.0
+ * @date    2025-12-07
+ */
+
+#ifndef __LCD_TEXT_FIELD_H
+#define __LCD_TEXT_FIELD_H
+
+#include "font_variable.h"
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 配置 (Configuration)
+ * ================================================================== */
+
+#define LCD_TEXT_FIELD_MAX_BYTES  32 ///< 字符串最大字节数 (含结尾 '\0')
+#define LCD_TEXT_FIELD_MAX_GLYPHS 24 ///< 最多记录的字数，超出时整串重画
+
+/* ==================================================================
+ * 2. 类型定义 (Type Definitions)
+ * ================================================================== */
+
+/**
+ * @brief 文本框状态
+ * @note  由 LCD_Text_Field_Init() 初始化，调用者只需提供存储空间
+ */
+typedef struct
+{
+    uint16_t           x, y;   ///< 左上角 (px)
+    const font_info_t* font;   ///< 字体
+    uint16_t           fg, bg; ///< 前景色/背景色
+
+    char     text[LCD_TEXT_FIELD_MAX_BYTES];         ///< 上次显示的字符串
+    uint8_t  offset[LCD_TEXT_FIELD_MAX_GLYPHS + 1];  ///< 每个字在 text 中的起始字节，末项为总字节数
+    uint16_t pos[LCD_TEXT_FIELD_MAX_GLYPHS + 1];     ///< 每个字的 x 偏移，末项为总宽
+    uint8_t  count;                                  ///< 字数
+    uint16_t h;                                      ///< 行高 (px)
+    uint8_t  valid;                                  ///< 0: 屏幕上的内容未知，下次整串重画
+} LCD_Text_Field_t;
+
+/* ==================================================================
+ * 3. 接口函数声明 (Interface Function Declarations)
+ * ================================================================== */
+
+/**
+ * @brief  初始化文本框 (不绘制)
+ * @note   背景由调用者先画好，第一次 LCD_Text_Field_Set() 整串绘制
+ * @param  field:  文本框
+ * @param  x, y:   左上角 (px)
+ * @param  font:   字体
+ * @param  fg, bg: 前景色/背景色
+ * @retval None
+ */
+void LCD_Text_Field_Init(LCD_Text_Field_t*  field,
+                         uint16_t           x,
+                         uint16_t           y,
+                         const font_info_t* font,
+                         uint16_t           fg,
+                         uint16_t           bg);
+
+/**
+ * @brief  更新文本框内容
+ * @note   只重画变化的字；含换行符、超出容量或行高变化时整串重画。
+ * @param  field: 文本框
+ * @param  text:  新字符串 (UTF-8 编码，单行，NULL 终止)
+ * @retval None
+ */
+void LCD_Text_Field_Set(LCD_Text_Field_t* field, const char* text);
+
+/**
+ * @brief  标记屏幕内容失效
+ * @note   背景被其他绘制覆盖后调用，下次 LCD_Text_Field_Set() 整串重画
+ * @param  field: 文本框
+ * @retval None
+ */
+void LCD_Text_Field_Invalidate(LCD_Text_Field_t* field);
+
+#endif /* __LCD_TEXT_FIELD_H */
@@ -1,3 +1,4 @@
+#include "font_variable.h"
 #include <stdint.h>
 const uint8_t ASCII_16x32[] = {
     0x00,
@@ -6270,3 +6271,21 @@ const uint8_t ASCII_16x32[] = {
     0x00, /*"~",94*/
     /* (16 X 32 , 宋体 )*/
 };
+
+/**
+ * @brief 全局 16x32 ASCII 字体配置对象实例 (不含汉字)
+ */
+font_info_t font_ascii_16x32 = {
+    // --- ASCII 部分 ---
+    .ascii_w = 16,
+    .ascii_h = 32,
+#if LCD_FONT_RLE
+    .ascii_rle = &ASCII_16x32_RLE, // 构建时由上面的位图压缩生成 (包围盒 + 行程编码)
+#else
+    .ascii_map = ASCII_16x32,
+#endif
+
+    // --- 汉字 部分 (无汉字，只用于换行与越界判断) ---
+    .cn_w = 16,
+    .cn_h = 32,
+};
@@ -1,3 +1,4 @@
+#include "font_variable.h"
 #include <stdint.h>
 // !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
 
@@ -1712,4 +1713,106 @@ const uint8_t ASCII_8x16[] = {
     0x00, /*"~",94*/
     /* (8 X 16 , MingLiU_MSCS-ExtB )*/
 
-};
\ No newline at end of file
+};
+
+/**
+ * @brief 比例字宽：窗口从字模最左侧的前景列开始，右侧留 1 列间隙 (最宽 8)，空格 4 像素
+ * @note  按包围盒从上面的字模计算，改动字模后需同步更新
+ */
+const font_metric_t ASCII_8x16_Metrics[95] = {
+    {0, 4}, // ' '
+    {3, 3}, // '!'
+    {2, 5}, // '"'
+    {0, 8}, // '#'
+    {1, 7}, // '$'
+    {0, 8}, // '%'
+    {0, 8}, // '&'
+    {3, 3}, // '''
+    {2, 4}, // '('
+    {2, 5}, // ')'
+    {1, 7}, // '*'
+    {0, 8}, // '+'
+    {3, 3}, // ','
+    {2, 5}, // '-'
+    {3, 3}, // '.'
+    {2, 5}, // '/'
+    {1, 7}, // '0'
+    {2, 5}, // '1'
+    {1, 7}, // '2'
+    {1, 7}, // '3'
+    {1, 7}, // '4'
+    {1, 7}, // '5'
+    {1, 7}, // '6'
+    {1, 7}, // '7'
+    {1, 7}, // '8'
+    {1, 7}, // '9'
+    {3, 3}, // ':'
+    {3, 3}, // ';'
+    {0, 8}, // '<'
+    {0, 8}, // '='
+    {0, 8}, // '>'
+    {1, 7}, // '?'
+    {0, 8}, // '@'
+    {0, 8}, // 'A'
+    {0, 8}, // 'B'
+    {0, 8}, // 'C'
+    {0, 8}, // 'D'
+    {0, 8}, // 'E'
+    {0, 8}, // 'F'
+    {0, 8}, // 'G'
+    {0, 8}, // 'H'
+    {2, 5}, // 'I'
+    {1, 6}, // 'J'
+    {0, 8}, // 'K'
+    {0, 8}, // 'L'
+    {0, 8}, // 'M'
+    {0, 8}, // 'N'
+    {0, 8}, // 'O'
+    {0, 8}, // 'P'
+    {0, 8}, // 'Q'
+    {0, 8}, // 'R'
+    {1, 7}, // 'S'
+    {0, 8}, // 'T'
+    {0, 8}, // 'U'
+    {0, 8}, // 'V'
+    {0, 8}, // 'W'
+    {0, 8}, // 'X'
+    {0, 8}, // 'Y'
+    {0, 8}, // 'Z'
+    {2, 5}, // '['
+    {2, 5}, // '\\' (反斜杠)
+    {2, 5}, // ']'
+    {1, 7}, // '^'
+    {0, 8}, // '_'
+    {2, 5}, // '`'
+    {1, 7}, // 'a'
+    {0, 8}, // 'b'
+    {1, 7}, // 'c'
+    {1, 7}, // 'd'
+    {1, 7}, // 'e'
+    {2, 6}, // 'f'
+    {1, 7}, // 'g'
+    {0, 8}, // 'h'
+    {2, 5}, // 'i'
+    {1, 4}, // 'j'
+    {0, 8}, // 'k'
+    {2, 5}, // 'l'
+    {0, 8}, // 'm'
+    {0, 8}, // 'n'
+    {1, 7}, // 'o'
+    {1, 7}, // 'p'
+    {1, 7}, // 'q'
+    {2, 6}, // 'r'
+    {2, 5}, // 's'
+    {2, 5}, // 't'
+    {1, 7}, // 'u'
+    {1, 7}, // 'v'
+    {0, 8}, // 'w'
+    {1, 7}, // 'x'
+    {1, 7}, // 'y'
+    {1, 7}, // 'z'
+    {2, 5}, // '{'
+    {3, 2}, // '|'
+    {2, 5}, // '}'
+    {1, 7}, // '~'
+};
@@ -1,292 +1,402 @@
 #include "font_variable.h"
 #include <stdint.h>
 
-const HZK_16_t HZK_16[] = {
-    {"星",
-     {0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0xF8,
-      0x0F, 0x80, 0x00, 0x88, 0x00, 0xF8, 0x1F, 0x84, 0x00, 0x82, 0x00,
-      0xF8, 0x0F, 0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00}, /*"星",0*/
-     /* (16 X 16 , 宋体 )*/},
+/* 字体: 宋体 (LSB First)，共 47 个字符 */
 
-    {"期",
-     {0x44, 0x00, 0x44, 0x3E, 0xFE, 0x22, 0x44, 0x22, 0x44, 0x22, 0x7C,
-      0x3E, 0x44, 0x22, 0x44, 0x22, 0x7C, 0x22, 0x44, 0x3E, 0x44, 0x22,
-      0xFF, 0x22, 0x20, 0x21, 0x44, 0x21, 0x82, 0x28, 0x41, 0x10}, /*"期",1*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"一",
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"一",2*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"二",
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"二",3*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"三",
-     {0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00}, /*"三",4*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"四",
-     {0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x22, 0x22, 0x22, 0x22, 0x22,
-      0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x22, 0x12, 0x3C, 0x0A, 0x20,
-      0x06, 0x20, 0x02, 0x20, 0xFE, 0x3F, 0x02, 0x20, 0x00, 0x00}, /*"四",5*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"五",
-     {0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
-      0x00, 0xFC, 0x0F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
-      0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0xFF, 0x7F, 0x00, 0x00}, /*"五",6*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"六",
-     {0x40, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF,
-      0x7F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x04, 0x10, 0x08,
-      0x10, 0x10, 0x08, 0x10, 0x04, 0x20, 0x02, 0x20, 0x00, 0x00}, /*"六",7*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"天",
-     {0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
-      0x00, 0xFF, 0x7F, 0x80, 0x00, 0x40, 0x01, 0x40, 0x01, 0x20, 0x02,
-      0x20, 0x02, 0x10, 0x04, 0x08, 0x08, 0x04, 0x10, 0x03, 0x60}, /*"天",8*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"日",
-     {0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-      0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08}, /*"日",9*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"周",
-     {0x00, 0x00, 0xFC, 0x1F, 0x84, 0x10, 0x84, 0x10, 0xF4, 0x17, 0x84,
-      0x10, 0x84, 0x10, 0xFC, 0x1F, 0x04, 0x10, 0xE4, 0x13, 0x24, 0x12,
-      0x24, 0x12, 0xE4, 0x13, 0x02, 0x10, 0x02, 0x14, 0x01, 0x08}, /*"周",10*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"温",
-     {0x00, 0x00, 0xC4, 0x1F, 0x48, 0x10, 0x48, 0x10, 0xC1, 0x1F, 0x42,
-      0x10, 0x42, 0x10, 0xC8, 0x1F, 0x08, 0x00, 0xE4, 0x3F, 0x27, 0x25,
-      0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0xF4, 0x7F, 0x00, 0x00}, /*"温",11*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"度",
-     {0x80, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x44, 0x04, 0x44, 0x04, 0xFC,
-      0x3F, 0x44, 0x04, 0x44, 0x04, 0xC4, 0x07, 0x04, 0x00, 0xF4, 0x0F,
-      0x24, 0x08, 0x42, 0x04, 0x82, 0x03, 0x61, 0x0C, 0x1C, 0x70}, /*"度",12*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"我",
-     {0x20, 0x02, 0x70, 0x0A, 0x1E, 0x12, 0x10, 0x12, 0x10, 0x02, 0xFF,
-      0x7F, 0x10, 0x02, 0x10, 0x22, 0x50, 0x22, 0x30, 0x12, 0x18, 0x0C,
-      0x16, 0x44, 0x10, 0x4A, 0x10, 0x51, 0xD4, 0x60, 0x08, 0x40}, /*"我",13*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"爱",
-     {0x00, 0x10, 0x80, 0x3F, 0x7E, 0x08, 0x44, 0x08, 0x88, 0x04, 0xFE,
-      0x7F, 0x42, 0x40, 0x41, 0x20, 0xFE, 0x1F, 0x20, 0x00, 0xE0, 0x0F,
-      0x50, 0x08, 0x88, 0x04, 0x04, 0x03, 0xC2, 0x0C, 0x38, 0x70}, /*"爱",14*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"你",
-     {0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x88, 0x7F, 0x88, 0x40, 0x4C,
-      0x20, 0x2C, 0x04, 0x0A, 0x04, 0x89, 0x14, 0x88, 0x24, 0x48, 0x24,
-      0x48, 0x44, 0x28, 0x44, 0x08, 0x04, 0x08, 0x05, 0x08, 0x02}, /*"你",15*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"喜",
-     {0x80, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFC,
-      0x1F, 0x04, 0x10, 0xFC, 0x1F, 0x10, 0x04, 0xFF, 0x7F, 0x00, 0x00,
-      0xFC, 0x1F, 0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10}, /*"喜",16*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"欢",
-     {0x00, 0x01, 0x00, 0x01, 0x3F, 0x01, 0x20, 0x3F, 0xA0, 0x20, 0x92,
-      0x10, 0x54, 0x02, 0x28, 0x02, 0x08, 0x02, 0x14, 0x05, 0x24, 0x05,
-      0xA2, 0x08, 0x81, 0x08, 0x40, 0x10, 0x20, 0x20, 0x10, 0x40}, /*"欢",17*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"℃",
-     {0x06, 0x00, 0x89, 0x2F, 0x69, 0x30, 0x36, 0x20, 0x10, 0x20, 0x18,
-      0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-      0x10, 0x00, 0x30, 0x20, 0x60, 0x10, 0x80, 0x0F, 0x00, 0x00}, /*"℃",18*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"~",
-     {0x04, 0x00, 0x5A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~",19*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"北",
-     {0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x22, 0x20, 0x12, 0x3E,
-      0x0A, 0x20, 0x06, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02,
-      0x20, 0x42, 0x38, 0x42, 0x27, 0x42, 0x22, 0x7C, 0x20, 0x00}, /*"北",20*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"京",
-     {0x40, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-      0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x80, 0x00,
-      0x88, 0x08, 0x88, 0x10, 0x84, 0x20, 0xA2, 0x20, 0x40, 0x00}, /*"京",21*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"南",
-     {0x80, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x80, 0x00, 0xFE,
-      0x3F, 0x12, 0x24, 0x22, 0x22, 0xF2, 0x27, 0x82, 0x20, 0x82, 0x20,
-      0xFA, 0x2F, 0x82, 0x20, 0x82, 0x20, 0x82, 0x28, 0x02, 0x10}, /*"南",22*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"上",
-     {0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
-      0x00, 0xC0, 0x1F, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-      0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xFF, 0x7F, 0x00, 0x00}, /*"上",23*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"海",
-     {0x80, 0x00, 0x84, 0x00, 0x88, 0x3F, 0x48, 0x00, 0xA1, 0x1F, 0x82,
-      0x10, 0x92, 0x12, 0x90, 0x14, 0xE8, 0x7F, 0x88, 0x10, 0x47, 0x12,
-      0x44, 0x14, 0xC4, 0x3F, 0x04, 0x10, 0x04, 0x0A, 0x00, 0x04}, /*"海",24*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"杭",
-     {0x08, 0x01, 0x08, 0x02, 0x08, 0x02, 0xC8, 0x3F, 0x3F, 0x00, 0x08,
-      0x00, 0x8C, 0x0F, 0x9C, 0x08, 0xAA, 0x08, 0xAA, 0x08, 0x89, 0x08,
-      0x88, 0x48, 0x88, 0x48, 0x48, 0x48, 0x48, 0x70, 0x28, 0x00}, /*"杭",25*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"州",
-     {0x08, 0x20, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x2A,
-      0x25, 0x4A, 0x29, 0x4A, 0x29, 0x09, 0x21, 0x08, 0x21, 0x08, 0x21,
-      0x08, 0x21, 0x04, 0x21, 0x04, 0x21, 0x02, 0x20, 0x01, 0x20}, /*"州",26*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"修",
-     {0x08, 0x01, 0x08, 0x01, 0x88, 0x1F, 0x84, 0x10, 0x54, 0x09, 0x36,
-      0x06, 0x95, 0x19, 0x74, 0x64, 0x14, 0x03, 0xD4, 0x08, 0x14, 0x04,
-      0x14, 0x13, 0xD4, 0x08, 0x04, 0x06, 0x84, 0x01, 0x64, 0x00}, /*"修",27*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"水",
-     {0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x10, 0x80, 0x10, 0xBE,
-      0x09, 0xA0, 0x05, 0x90, 0x02, 0x90, 0x02, 0x88, 0x04, 0x88, 0x08,
-      0x84, 0x10, 0x82, 0x60, 0x81, 0x00, 0xA0, 0x00, 0x40, 0x00}, /*"水",28*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"昌",
-     {0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0x08,
-      0x08, 0xF8, 0x0F, 0x00, 0x00, 0xFC, 0x1F, 0x04, 0x10, 0x04, 0x10,
-      0xFC, 0x1F, 0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10}, /*"昌",29*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"差",
-     {0x10, 0x04, 0x20, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x80, 0x00, 0xFC,
-      0x1F, 0x40, 0x00, 0x40, 0x00, 0xFF, 0x7F, 0x20, 0x00, 0x10, 0x00,
-      0xE8, 0x1F, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0xF8, 0x3F}, /*"差",30*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"风",
-     {0x00, 0x00, 0xFC, 0x0F, 0x04, 0x08, 0x04, 0x08, 0x14, 0x0A, 0x24,
-      0x0A, 0x44, 0x09, 0x44, 0x09, 0x84, 0x08, 0x84, 0x08, 0x44, 0x09,
-      0x44, 0x49, 0x24, 0x52, 0x12, 0x52, 0x02, 0x60, 0x01, 0x40}, /*"风",31*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"向",
-     {0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0xFE, 0x3F, 0x02, 0x20, 0x02,
-      0x20, 0xE2, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-      0xE2, 0x23, 0x22, 0x22, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10}, /*"向",32*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"空",
-     {0x40, 0x00, 0x80, 0x00, 0xFE, 0x7F, 0x02, 0x40, 0x11, 0x24, 0x08,
-      0x08, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x80, 0x00,
-      0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00}, /*"空",33*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"气",
-     {0x08, 0x00, 0x08, 0x00, 0xFC, 0x3F, 0x04, 0x00, 0xF2, 0x0F, 0x01,
-      0x00, 0xFC, 0x0F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-      0x00, 0x08, 0x00, 0x50, 0x00, 0x50, 0x00, 0x60, 0x00, 0x40}, /*"气",34*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"湿",
-     {0x00, 0x00, 0xE4, 0x1F, 0x28, 0x10, 0x28, 0x10, 0xE1, 0x1F, 0x22,
-      0x10, 0x22, 0x10, 0xE8, 0x1F, 0x88, 0x04, 0x84, 0x04, 0x97, 0x24,
-      0xA4, 0x14, 0xC4, 0x0C, 0x84, 0x04, 0xF4, 0x7F, 0x00, 0x00}, /*"湿",35*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"压",
-     {0x00, 0x00, 0xFC, 0x7F, 0x04, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
-      0x01, 0x04, 0x01, 0xF4, 0x3F, 0x04, 0x01, 0x04, 0x01, 0x04, 0x09,
-      0x04, 0x11, 0x04, 0x11, 0x02, 0x01, 0xFA, 0x7F, 0x01, 0x00}, /*"压",36*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"更",
-     {0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x80, 0x00, 0xFC, 0x1F, 0x84,
-      0x10, 0x84, 0x10, 0xFC, 0x1F, 0x84, 0x10, 0x84, 0x10, 0xFC, 0x1F,
-      0x88, 0x00, 0x50, 0x00, 0x60, 0x00, 0x98, 0x03, 0x07, 0x7C}, /*"更",37*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"新",
-     {0x08, 0x00, 0x10, 0x20, 0xFE, 0x1E, 0x00, 0x02, 0x44, 0x02, 0x28,
-      0x02, 0xFF, 0x7E, 0x10, 0x12, 0x10, 0x12, 0xFE, 0x12, 0x10, 0x12,
-      0x54, 0x12, 0x92, 0x12, 0x11, 0x11, 0x14, 0x11, 0x88, 0x10}, /*"新",38*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"时",
-     {0x00, 0x10, 0x00, 0x10, 0x3E, 0x10, 0x22, 0x10, 0xA2, 0x7F, 0x22,
-      0x10, 0x22, 0x10, 0x3E, 0x10, 0x22, 0x11, 0x22, 0x12, 0x22, 0x12,
-      0x22, 0x10, 0x3E, 0x10, 0x22, 0x10, 0x00, 0x14, 0x00, 0x08}, /*"时",39*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"间",
-     {0x04, 0x00, 0xC8, 0x3F, 0x08, 0x20, 0x02, 0x20, 0xE2, 0x23, 0x22,
-      0x22, 0x22, 0x22, 0x22, 0x22, 0xE2, 0x23, 0x22, 0x22, 0x22, 0x22,
-      0x22, 0x22, 0xE2, 0x23, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10}, /*"间",40*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"室",
-     {0x40, 0x00, 0x80, 0x00, 0xFE, 0x7F, 0x02, 0x40, 0x01, 0x20, 0xFC,
-      0x1F, 0x20, 0x00, 0x10, 0x04, 0xF8, 0x0F, 0x80, 0x08, 0x80, 0x00,
-      0xFC, 0x1F, 0x80, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x00, 0x00}, /*"室",41*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"内",
-     {0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F, 0x82, 0x20, 0x82,
-      0x20, 0x82, 0x20, 0x42, 0x21, 0x42, 0x22, 0x22, 0x24, 0x12, 0x28,
-      0x0A, 0x28, 0x02, 0x20, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10}, /*"内",42*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"东",
-     {0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xFE, 0x3F, 0x20, 0x00, 0x90,
-      0x00, 0x88, 0x00, 0x84, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x90, 0x04,
-      0x88, 0x08, 0x84, 0x10, 0x82, 0x20, 0xA0, 0x00, 0x40, 0x00}, /*"东",43*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"西",
-     {0x00, 0x00, 0xFF, 0x7F, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0xFC,
-      0x1F, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x14, 0x1C,
-      0x0C, 0x10, 0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10}, /*"西",44*/
-     /* (16 X 16 , 宋体 )*/},
-
-    {"偏",
-     {0x08, 0x01, 0x08, 0x02, 0xE8, 0x3F, 0x24, 0x20, 0x24, 0x20, 0xE6,
-      0x3F, 0x26, 0x00, 0x25, 0x00, 0xE4, 0x3F, 0x64, 0x25, 0x54, 0x25,
-      0xD4, 0x3F, 0x54, 0x25, 0x54, 0x25, 0x4C, 0x25, 0x44, 0x30}, /*"偏",45*/
-     /* (16 X 16 , 宋体 )*/},
-    {"级",
-     {0x08, 0x00, 0xC8, 0x3F, 0x04, 0x21, 0x04, 0x11, 0x12, 0x11, 0x1F,
-      0x09, 0x08, 0x39, 0x04, 0x21, 0x82, 0x22, 0x9F, 0x22, 0x82, 0x14,
-      0x80, 0x14, 0x58, 0x08, 0x47, 0x14, 0x22, 0x22, 0x80, 0x41}, /*"级",0*/
-     /* (16 X 16 , 宋体 )*/},
+/**
+ * @brief 16 点阵汉字码点表 (Unicode，严格升序)
+ * @note  LCD_Show_String 在此表中二分查找，第 i 个码点的字模是 HZK_16[i]。
+ *        由 Utils/输入汉字自动生成要求格式的模文件.py 生成，手工增删条目后必须保持升序。
+ *        LCD_FONT_SUBSET=ON 时本文件只作模板：构建时由 Utils/font_subset.py 按固件实际用到的字
+ *        重新生成码点表与字模 (HZK_16_PACKED 为 1 表示字模已压缩为 HZK_16_RLE)。
+ */
+const uint16_t HZK_16_Code[] = {
+    0x007E, // ~
+    0x2103, // ℃
+    0x4E00, // 一
+    0x4E09, // 三
+    0x4E0A, // 上
+    0x4E1C, // 东
+    0x4E8C, // 二
+    0x4E94, // 五
+    0x4EAC, // 京
+    0x4F60, // 你
+    0x4FEE, // 修
+    0x504F, // 偏
+    0x516D, // 六
+    0x5185, // 内
+    0x5317, // 北
+    0x5357, // 南
+    0x538B, // 压
+    0x5411, // 向
+    0x5468, // 周
+    0x559C, // 喜
+    0x56DB, // 四
+    0x5929, // 天
+    0x5BA4, // 室
+    0x5DDE, // 州
+    0x5DEE, // 差
+    0x5EA6, // 度
+    0x6211, // 我
+    0x65B0, // 新
+    0x65E5, // 日
+    0x65F6, // 时
+    0x660C, // 昌
+    0x661F, // 星
+    0x66F4, // 更
+    0x671F, // 期
+    0x676D, // 杭
+    0x6B22, // 欢
+    0x6C14, // 气
+    0x6C34, // 水
+    0x6D77, // 海
+    0x6E29, // 温
+    0x6E7F, // 湿
+    0x7231, // 爱
+    0x7A7A, // 空
+    0x7EA7, // 级
+    0x897F, // 西
+    0x95F4, // 间
+    0x98CE, // 风
+};
 
+/**
+ * @brief 16 点阵汉字字模 (与 HZK_16_Code 一一对应)
+ */
+const uint8_t HZK_16[][32] = {
+    /* "~" U+007E, 0 */
+    {
+        0x04, 0x00, 0x5A, 0x00, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "℃" U+2103, 1 */
+    {
+        0x06, 0x00, 0x89, 0x2F, 0x69, 0x30, 0x36, 0x20,
+        0x10, 0x20, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00,
+        0x30, 0x20, 0x60, 0x10, 0x80, 0x0F, 0x00, 0x00,
+    },
+    /* "一" U+4E00, 2 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "三" U+4E09, 3 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "上" U+4E0A, 4 */
+    {
+        0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+        0x40, 0x00, 0x40, 0x00, 0xC0, 0x1F, 0x40, 0x00,
+        0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+        0x40, 0x00, 0x40, 0x00, 0xFF, 0x7F, 0x00, 0x00,
+    },
+    /* "东" U+4E1C, 5 */
+    {
+        0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xFE, 0x3F,
+        0x20, 0x00, 0x90, 0x00, 0x88, 0x00, 0x84, 0x00,
+        0xFC, 0x1F, 0x80, 0x00, 0x90, 0x04, 0x88, 0x08,
+        0x84, 0x10, 0x82, 0x20, 0xA0, 0x00, 0x40, 0x00,
+    },
+    /* "二" U+4E8C, 6 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "五" U+4E94, 7 */
+    {
+        0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x40, 0x00,
+        0x40, 0x00, 0x40, 0x00, 0xFC, 0x0F, 0x20, 0x08,
+        0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x10, 0x08,
+        0x10, 0x08, 0x10, 0x08, 0xFF, 0x7F, 0x00, 0x00,
+    },
+    /* "京" U+4EAC, 8 */
+    {
+        0x40, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x00, 0x00,
+        0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08,
+        0x08, 0x08, 0xF8, 0x0F, 0x80, 0x00, 0x88, 0x08,
+        0x88, 0x10, 0x84, 0x20, 0xA2, 0x20, 0x40, 0x00,
+    },
+    /* "你" U+4F60, 9 */
+    {
+        0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x88, 0x7F,
+        0x88, 0x40, 0x4C, 0x20, 0x2C, 0x04, 0x0A, 0x04,
+        0x89, 0x14, 0x88, 0x24, 0x48, 0x24, 0x48, 0x44,
+        0x28, 0x44, 0x08, 0x04, 0x08, 0x05, 0x08, 0x02,
+    },
+    /* "修" U+4FEE, 10 */
+    {
+        0x08, 0x01, 0x08, 0x01, 0x88, 0x1F, 0x84, 0x10,
+        0x54, 0x09, 0x36, 0x06, 0x95, 0x19, 0x74, 0x64,
+        0x14, 0x03, 0xD4, 0x08, 0x14, 0x04, 0x14, 0x13,
+        0xD4, 0x08, 0x04, 0x06, 0x84, 0x01, 0x64, 0x00,
+    },
+    /* "偏" U+504F, 11 */
+    {
+        0x08, 0x01, 0x08, 0x02, 0xE8, 0x3F, 0x24, 0x20,
+        0x24, 0x20, 0xE6, 0x3F, 0x26, 0x00, 0x25, 0x00,
+        0xE4, 0x3F, 0x64, 0x25, 0x54, 0x25, 0xD4, 0x3F,
+        0x54, 0x25, 0x54, 0x25, 0x4C, 0x25, 0x44, 0x30,
+    },
+    /* "六" U+516D, 12 */
+    {
+        0x40, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01,
+        0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+        0x20, 0x02, 0x20, 0x04, 0x10, 0x08, 0x10, 0x10,
+        0x08, 0x10, 0x04, 0x20, 0x02, 0x20, 0x00, 0x00,
+    },
+    /* "内" U+5185, 13 */
+    {
+        0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F,
+        0x82, 0x20, 0x82, 0x20, 0x82, 0x20, 0x42, 0x21,
+        0x42, 0x22, 0x22, 0x24, 0x12, 0x28, 0x0A, 0x28,
+        0x02, 0x20, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10,
+    },
+    /* "北" U+5317, 14 */
+    {
+        0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x22,
+        0x20, 0x12, 0x3E, 0x0A, 0x20, 0x06, 0x20, 0x02,
+        0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x42,
+        0x38, 0x42, 0x27, 0x42, 0x22, 0x7C, 0x20, 0x00,
+    },
+    /* "南" U+5357, 15 */
+    {
+        0x80, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x80, 0x00,
+        0x80, 0x00, 0xFE, 0x3F, 0x12, 0x24, 0x22, 0x22,
+        0xF2, 0x27, 0x82, 0x20, 0x82, 0x20, 0xFA, 0x2F,
+        0x82, 0x20, 0x82, 0x20, 0x82, 0x28, 0x02, 0x10,
+    },
+    /* "压" U+538B, 16 */
+    {
+        0x00, 0x00, 0xFC, 0x7F, 0x04, 0x00, 0x04, 0x01,
+        0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0xF4, 0x3F,
+        0x04, 0x01, 0x04, 0x01, 0x04, 0x09, 0x04, 0x11,
+        0x04, 0x11, 0x02, 0x01, 0xFA, 0x7F, 0x01, 0x00,
+    },
+    /* "向" U+5411, 17 */
+    {
+        0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0xFE, 0x3F,
+        0x02, 0x20, 0x02, 0x20, 0xE2, 0x23, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xE2, 0x23,
+        0x22, 0x22, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10,
+    },
+    /* "周" U+5468, 18 */
+    {
+        0x00, 0x00, 0xFC, 0x1F, 0x84, 0x10, 0x84, 0x10,
+        0xF4, 0x17, 0x84, 0x10, 0x84, 0x10, 0xFC, 0x1F,
+        0x04, 0x10, 0xE4, 0x13, 0x24, 0x12, 0x24, 0x12,
+        0xE4, 0x13, 0x02, 0x10, 0x02, 0x14, 0x01, 0x08,
+    },
+    /* "喜" U+559C, 19 */
+    {
+        0x80, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0xFC, 0x1F,
+        0x00, 0x00, 0xFC, 0x1F, 0x04, 0x10, 0xFC, 0x1F,
+        0x10, 0x04, 0xFF, 0x7F, 0x00, 0x00, 0xFC, 0x1F,
+        0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10,
+    },
+    /* "四" U+56DB, 20 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x12, 0x22, 0x12, 0x3C, 0x0A, 0x20, 0x06, 0x20,
+        0x02, 0x20, 0xFE, 0x3F, 0x02, 0x20, 0x00, 0x00,
+    },
+    /* "天" U+5929, 21 */
+    {
+        0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x80, 0x00,
+        0x80, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x80, 0x00,
+        0x40, 0x01, 0x40, 0x01, 0x20, 0x02, 0x20, 0x02,
+        0x10, 0x04, 0x08, 0x08, 0x04, 0x10, 0x03, 0x60,
+    },
+    /* "室" U+5BA4, 22 */
+    {
+        0x40, 0x00, 0x80, 0x00, 0xFE, 0x7F, 0x02, 0x40,
+        0x01, 0x20, 0xFC, 0x1F, 0x20, 0x00, 0x10, 0x04,
+        0xF8, 0x0F, 0x80, 0x08, 0x80, 0x00, 0xFC, 0x1F,
+        0x80, 0x00, 0x80, 0x00, 0xFF, 0x7F, 0x00, 0x00,
+    },
+    /* "州" U+5DDE, 23 */
+    {
+        0x08, 0x20, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21,
+        0x08, 0x21, 0x2A, 0x25, 0x4A, 0x29, 0x4A, 0x29,
+        0x09, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21,
+        0x04, 0x21, 0x04, 0x21, 0x02, 0x20, 0x01, 0x20,
+    },
+    /* "差" U+5DEE, 24 */
+    {
+        0x10, 0x04, 0x20, 0x02, 0xFE, 0x3F, 0x80, 0x00,
+        0x80, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x40, 0x00,
+        0xFF, 0x7F, 0x20, 0x00, 0x10, 0x00, 0xE8, 0x1F,
+        0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0xF8, 0x3F,
+    },
+    /* "度" U+5EA6, 25 */
+    {
+        0x80, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x44, 0x04,
+        0x44, 0x04, 0xFC, 0x3F, 0x44, 0x04, 0x44, 0x04,
+        0xC4, 0x07, 0x04, 0x00, 0xF4, 0x0F, 0x24, 0x08,
+        0x42, 0x04, 0x82, 0x03, 0x61, 0x0C, 0x1C, 0x70,
+    },
+    /* "我" U+6211, 26 */
+    {
+        0x20, 0x02, 0x70, 0x0A, 0x1E, 0x12, 0x10, 0x12,
+        0x10, 0x02, 0xFF, 0x7F, 0x10, 0x02, 0x10, 0x22,
+        0x50, 0x22, 0x30, 0x12, 0x18, 0x0C, 0x16, 0x44,
+        0x10, 0x4A, 0x10, 0x51, 0xD4, 0x60, 0x08, 0x40,
+    },
+    /* "新" U+65B0, 27 */
+    {
+        0x08, 0x00, 0x10, 0x20, 0xFE, 0x1E, 0x00, 0x02,
+        0x44, 0x02, 0x28, 0x02, 0xFF, 0x7E, 0x10, 0x12,
+        0x10, 0x12, 0xFE, 0x12, 0x10, 0x12, 0x54, 0x12,
+        0x92, 0x12, 0x11, 0x11, 0x14, 0x11, 0x88, 0x10,
+    },
+    /* "日" U+65E5, 28 */
+    {
+        0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08,
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F,
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+        0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08,
+    },
+    /* "时" U+65F6, 29 */
+    {
+        0x00, 0x10, 0x00, 0x10, 0x3E, 0x10, 0x22, 0x10,
+        0xA2, 0x7F, 0x22, 0x10, 0x22, 0x10, 0x3E, 0x10,
+        0x22, 0x11, 0x22, 0x12, 0x22, 0x12, 0x22, 0x10,
+        0x3E, 0x10, 0x22, 0x10, 0x00, 0x14, 0x00, 0x08,
+    },
+    /* "昌" U+660C, 30 */
+    {
+        0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F,
+        0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x00, 0x00,
+        0xFC, 0x1F, 0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F,
+        0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10,
+    },
+    /* "星" U+661F, 31 */
+    {
+        0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0xF8, 0x0F,
+        0x08, 0x08, 0xF8, 0x0F, 0x80, 0x00, 0x88, 0x00,
+        0xF8, 0x1F, 0x84, 0x00, 0x82, 0x00, 0xF8, 0x0F,
+        0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00,
+    },
+    /* "更" U+66F4, 32 */
+    {
+        0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x80, 0x00,
+        0xFC, 0x1F, 0x84, 0x10, 0x84, 0x10, 0xFC, 0x1F,
+        0x84, 0x10, 0x84, 0x10, 0xFC, 0x1F, 0x88, 0x00,
+        0x50, 0x00, 0x60, 0x00, 0x98, 0x03, 0x07, 0x7C,
+    },
+    /* "期" U+671F, 33 */
+    {
+        0x44, 0x00, 0x44, 0x3E, 0xFE, 0x22, 0x44, 0x22,
+        0x44, 0x22, 0x7C, 0x3E, 0x44, 0x22, 0x44, 0x22,
+        0x7C, 0x22, 0x44, 0x3E, 0x44, 0x22, 0xFF, 0x22,
+        0x20, 0x21, 0x44, 0x21, 0x82, 0x28, 0x41, 0x10,
+    },
+    /* "杭" U+676D, 34 */
+    {
+        0x08, 0x01, 0x08, 0x02, 0x08, 0x02, 0xC8, 0x3F,
+        0x3F, 0x00, 0x08, 0x00, 0x8C, 0x0F, 0x9C, 0x08,
+        0xAA, 0x08, 0xAA, 0x08, 0x89, 0x08, 0x88, 0x48,
+        0x88, 0x48, 0x48, 0x48, 0x48, 0x70, 0x28, 0x00,
+    },
+    /* "欢" U+6B22, 35 */
+    {
+        0x00, 0x01, 0x00, 0x01, 0x3F, 0x01, 0x20, 0x3F,
+        0xA0, 0x20, 0x92, 0x10, 0x54, 0x02, 0x28, 0x02,
+        0x08, 0x02, 0x14, 0x05, 0x24, 0x05, 0xA2, 0x08,
+        0x81, 0x08, 0x40, 0x10, 0x20, 0x20, 0x10, 0x40,
+    },
+    /* "气" U+6C14, 36 */
+    {
+        0x08, 0x00, 0x08, 0x00, 0xFC, 0x3F, 0x04, 0x00,
+        0xF2, 0x0F, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x08,
+        0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+        0x00, 0x50, 0x00, 0x50, 0x00, 0x60, 0x00, 0x40,
+    },
+    /* "水" U+6C34, 37 */
+    {
+        0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x10,
+        0x80, 0x10, 0xBE, 0x09, 0xA0, 0x05, 0x90, 0x02,
+        0x90, 0x02, 0x88, 0x04, 0x88, 0x08, 0x84, 0x10,
+        0x82, 0x60, 0x81, 0x00, 0xA0, 0x00, 0x40, 0x00,
+    },
+    /* "海" U+6D77, 38 */
+    {
+        0x80, 0x00, 0x84, 0x00, 0x88, 0x3F, 0x48, 0x00,
+        0xA1, 0x1F, 0x82, 0x10, 0x92, 0x12, 0x90, 0x14,
+        0xE8, 0x7F, 0x88, 0x10, 0x47, 0x12, 0x44, 0x14,
+        0xC4, 0x3F, 0x04, 0x10, 0x04, 0x0A, 0x00, 0x04,
+    },
+    /* "温" U+6E29, 39 */
+    {
+        0x00, 0x00, 0xC4, 0x1F, 0x48, 0x10, 0x48, 0x10,
+        0xC1, 0x1F, 0x42, 0x10, 0x42, 0x10, 0xC8, 0x1F,
+        0x08, 0x00, 0xE4, 0x3F, 0x27, 0x25, 0x24, 0x25,
+        0x24, 0x25, 0x24, 0x25, 0xF4, 0x7F, 0x00, 0x00,
+    },
+    /* "湿" U+6E7F, 40 */
+    {
+        0x00, 0x00, 0xE4, 0x1F, 0x28, 0x10, 0x28, 0x10,
+        0xE1, 0x1F, 0x22, 0x10, 0x22, 0x10, 0xE8, 0x1F,
+        0x88, 0x04, 0x84, 0x04, 0x97, 0x24, 0xA4, 0x14,
+        0xC4, 0x0C, 0x84, 0x04, 0xF4, 0x7F, 0x00, 0x00,
+    },
+    /* "爱" U+7231, 41 */
+    {
+        0x00, 0x10, 0x80, 0x3F, 0x7E, 0x08, 0x44, 0x08,
+        0x88, 0x04, 0xFE, 0x7F, 0x42, 0x40, 0x41, 0x20,
+        0xFE, 0x1F, 0x20, 0x00, 0xE0, 0x0F, 0x50, 0x08,
+        0x88, 0x04, 0x04, 0x03, 0xC2, 0x0C, 0x38, 0x70,
+    },
+    /* "空" U+7A7A, 42 */
+    {
+        0x40, 0x00, 0x80, 0x00, 0xFE, 0x7F, 0x02, 0x40,
+        0x11, 0x24, 0x08, 0x08, 0x04, 0x10, 0x00, 0x00,
+        0xF8, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+        0x80, 0x00, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00,
+    },
+    /* "级" U+7EA7, 43 */
+    {
+        0x08, 0x00, 0xC8, 0x3F, 0x04, 0x21, 0x04, 0x11,
+        0x12, 0x11, 0x1F, 0x09, 0x08, 0x39, 0x04, 0x21,
+        0x82, 0x22, 0x9F, 0x22, 0x82, 0x14, 0x80, 0x14,
+        0x58, 0x08, 0x47, 0x14, 0x22, 0x22, 0x80, 0x41,
+    },
+    /* "西" U+897F, 44 */
+    {
+        0x00, 0x00, 0xFF, 0x7F, 0x20, 0x02, 0x20, 0x02,
+        0x20, 0x02, 0xFC, 0x1F, 0x24, 0x12, 0x24, 0x12,
+        0x24, 0x12, 0x24, 0x12, 0x14, 0x1C, 0x0C, 0x10,
+        0x04, 0x10, 0x04, 0x10, 0xFC, 0x1F, 0x04, 0x10,
+    },
+    /* "间" U+95F4, 45 */
+    {
+        0x04, 0x00, 0xC8, 0x3F, 0x08, 0x20, 0x02, 0x20,
+        0xE2, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0xE2, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0xE2, 0x23, 0x02, 0x20, 0x02, 0x28, 0x02, 0x10,
+    },
+    /* "风" U+98CE, 46 */
+    {
+        0x00, 0x00, 0xFC, 0x0F, 0x04, 0x08, 0x04, 0x08,
+        0x14, 0x0A, 0x24, 0x0A, 0x44, 0x09, 0x44, 0x09,
+        0x84, 0x08, 0x84, 0x08, 0x44, 0x09, 0x44, 0x49,
+        0x24, 0x52, 0x12, 0x52, 0x02, 0x60, 0x01, 0x40,
+    },
 };
 
 // 自动计算 HZK_16 数组里的字符个数
-#define HZK_16_COUNT (sizeof(HZK_16) / sizeof(HZK_16[0]))
+#define HZK_16_COUNT (sizeof(HZK_16_Code) / sizeof(HZK_16_Code[0]))
 
 /**
  * @brief 全局 16 点阵字体配置对象实例
@@ -300,12 +410,47 @@ font_info_t font_16 = {
     // --- 汉字 部分 ---
     .cn_w      = 16,
     .cn_h      = 16,
-    .hzk_table = (const void*) HZK_16,
+    .hzk_code  = HZK_16_Code,
+    .hzk_count = HZK_16_COUNT,
+#if HZK_16_PACKED
+    .hzk_rle = &HZK_16_RLE, // 构建时裁剪后压缩生成 (LCD_FONT_SUBSET)
+#else
+    .hzk_glyph = &HZK_16[0][0],
 
-    // 这里的 count 最好是用 sizeof 动态算，或者写个宏
+    // --- 寻址参数 ---
+    .hzk_data_size = sizeof(HZK_16[0]),
+#endif
+#if LCD_FONT_EXT
+    .hzk_ext = 1, // 缺字到外部 Flash 字库查找
+#endif
+};
+
+/**
+ * @brief 16 点阵比例字体 (同一套字模，ASCII 按 ASCII_8x16_Metrics 紧排)
+ * @note  状态栏等左对齐的提示文字使用，同样宽度能放下更多字符；
+ *        数字与固定列宽的内容仍用等宽的 font_16。
+ */
+font_info_t font_16_prop = {
+    // --- ASCII 部分 ---
+    .ascii_w       = 8,
+    .ascii_h       = 16,
+    .ascii_map     = ASCII_8x16,
+    .ascii_metrics = ASCII_8x16_Metrics,
+
+    // --- 汉字 部分 ---
+    .cn_w      = 16,
+    .cn_h      = 16,
+    .hzk_code  = HZK_16_Code,
     .hzk_count = HZK_16_COUNT,
+#if HZK_16_PACKED
+    .hzk_rle = &HZK_16_RLE, // 构建时裁剪后压缩生成 (LCD_FONT_SUBSET)
+#else
+    .hzk_glyph = &HZK_16[0][0],
 
     // --- 寻址参数 ---
-    .hzk_struct_size = sizeof(HZK_16_t),
-    .hzk_data_offset = 4, // index 占 2 字节
-    .hzk_data_size   = 32};
\ No newline at end of file
+    .hzk_data_size = sizeof(HZK_16[0]),
+#endif
+#if LCD_FONT_EXT
+    .hzk_ext = 1, // 缺字到外部 Flash 字库查找
+#endif
+};
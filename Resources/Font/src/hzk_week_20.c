@@ -1,178 +1,209 @@
 #include "font_variable.h"
+#include <stdint.h>
 
-const HZK_Week_20_t HZK_Week_20[] = {
-    {"℃",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7C, 0x01, 0x24, 0x86, 0x01,
-         0x24, 0x03, 0x01, 0x98, 0x01, 0x02, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
-         0xC0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x86, 0x01,
-         0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"℃",0*/
-     /* (20 X 20 , 华文中宋 )*/},
+/* 字体: 华文中宋 (LSB First)，共 22 个字符 */
 
-    {"星",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0xC0, 0x00,
-         0xF0, 0xFF, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0xCE, 0x00,
-         0x30, 0x86, 0x01, 0xF0, 0xFF, 0x03, 0x18, 0x06, 0x00, 0x0C, 0xC6, 0x00, 0xF4, 0xFF, 0x01,
-         0x02, 0x06, 0x00, 0x00, 0x06, 0x07, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"星",0*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"期",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x30, 0x13, 0x01, 0x30, 0xF3, 0x07,
-         0x30, 0x37, 0x03, 0xFC, 0x3F, 0x03, 0x30, 0x33, 0x03, 0xF0, 0xF3, 0x03, 0x30, 0x33, 0x03,
-         0xF0, 0x33, 0x03, 0x30, 0xF3, 0x03, 0xFE, 0x37, 0x03, 0x00, 0x38, 0x03, 0xB0, 0x19, 0x03,
-         0x18, 0x1B, 0x03, 0x08, 0x2E, 0x03, 0x04, 0xC6, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
-     } /*"期",1*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"一",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-         0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"一",2*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"二",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0xC0, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x03, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"二",3*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"三",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03,
-         0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
-         0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"三",4*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"四",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0xF8, 0xFF, 0x03,
-         0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03,
-         0x98, 0x19, 0x03, 0x98, 0x18, 0x03, 0xD8, 0x18, 0x03, 0x58, 0xF8, 0x03, 0x38, 0x00, 0x03,
-         0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"四",5*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"五",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xFC, 0xFF, 0x03,
-         0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x80, 0x61, 0x00, 0xF8, 0xFF, 0x00,
-         0x80, 0x61, 0x00, 0x80, 0x61, 0x00, 0x80, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00,
-         0xC0, 0x60, 0x06, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"五",6*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"六",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00,
-         0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-         0x80, 0x09, 0x00, 0xC0, 0x31, 0x00, 0xC0, 0x60, 0x00, 0x60, 0xC0, 0x00, 0x30, 0x80, 0x01,
-         0x10, 0x80, 0x03, 0x08, 0x00, 0x03, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"六",7*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"七",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
-         0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x83, 0x07, 0x00, 0x7F, 0x00, 0xC0, 0x03, 0x00,
-         0x3C, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02,
-         0x00, 0x03, 0x07, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"七",8*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"天",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xF8, 0xFF, 0x03,
-         0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0xFC, 0xFF, 0x07,
-         0x00, 0x0E, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x80, 0x31, 0x00,
-         0xC0, 0xE0, 0x00, 0x60, 0xC0, 0x03, 0x18, 0x80, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-     } /*"天",9*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"日",
-     {
-         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00, 0xE0, 0xFF, 0x01,
-         0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00,
-         0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00,
-         0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
-     } /*"日",10*/
-     /* (20 X 20 , 华文中宋 )*/},
-    {"北",
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x39, 0x00, 0x80, 0x19, 0x00,
-      0x80, 0x19, 0x00, 0x80, 0x19, 0x01, 0x80, 0x99, 0x03, 0xFC, 0xD9, 0x00, 0x80, 0x39, 0x00,
-      0x80, 0x19, 0x00, 0x80, 0x19, 0x00, 0x80, 0x19, 0x00, 0x80, 0x19, 0x02, 0xF8, 0x19, 0x02,
-      0x8C, 0x19, 0x06, 0x84, 0xF9, 0x07, 0x80, 0xF9, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00},
-     /*"北",11*/},
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"京",
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x04, 0x07,
-      0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00, 0xE0, 0xFF, 0x01, 0x60, 0xC0, 0x00,
-      0x60, 0xC0, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0xC6, 0x00, 0xE0, 0x26, 0x00, 0x30, 0xC6, 0x00,
-      0x18, 0x86, 0x03, 0x0C, 0x06, 0x03, 0x82, 0x07, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00},
-     /*"京",12*/},
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"南", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-            0x00, 0x06, 0x07, 0xFE, 0xFF, 0x07, 0x00, 0x06, 0x00, 0x08, 0x06, 0x03,
-            0xF8, 0xFF, 0x03, 0x98, 0x11, 0x03, 0x38, 0x29, 0x03, 0xD8, 0x7F, 0x03,
-            0x18, 0x46, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x06, 0x03, 0x18, 0x06, 0x03,
-            0x18, 0x06, 0x03, 0x18, 0xC6, 0x03, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00}}, /*"南",13*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"温", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x01,
-            0x30, 0xFF, 0x01, 0x30, 0x83, 0x01, 0x20, 0xFF, 0x01, 0x26, 0x83, 0x01,
-            0x2C, 0x83, 0x01, 0x18, 0xFF, 0x01, 0x90, 0x83, 0x01, 0x98, 0xFF, 0x07,
-            0x88, 0x6D, 0x03, 0x8E, 0x6D, 0x03, 0x8C, 0x6D, 0x03, 0x8C, 0x6D, 0x03,
-            0x8C, 0x6D, 0x03, 0xEC, 0xFF, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00}}, /*"温",14*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"州", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x03,
-            0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03,
-            0xE8, 0x1C, 0x03, 0x68, 0x6D, 0x03, 0x6C, 0x6F, 0x03, 0x6E, 0x2D, 0x03,
-            0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0x20, 0x0C, 0x03, 0x30, 0x0C, 0x03,
-            0x10, 0x0C, 0x03, 0x0C, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00}}, /*"州",15*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"修", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x60, 0x30, 0x00,
-            0x60, 0x30, 0x02, 0xB0, 0xF8, 0x07, 0xB0, 0x99, 0x03, 0xB8, 0xD5, 0x01,
-            0xB8, 0xE3, 0x00, 0xB4, 0xE1, 0x07, 0xB2, 0x39, 0x0E, 0xB0, 0x77, 0x00,
-            0xB0, 0x99, 0x00, 0xB0, 0xC7, 0x01, 0xB0, 0x71, 0x02, 0xB0, 0x9C, 0x07,
-            0x30, 0xE3, 0x01, 0x30, 0x38, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00}}, /*"修",16*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"水", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-            0x00, 0x06, 0x00, 0x00, 0x06, 0x01, 0x40, 0x8E, 0x03, 0xFE, 0xCE, 0x01,
-            0xC0, 0x6E, 0x00, 0x60, 0x16, 0x00, 0x60, 0x16, 0x00, 0x60, 0x26, 0x00,
-            0x30, 0x66, 0x00, 0x10, 0xC6, 0x01, 0x18, 0x86, 0x03, 0x04, 0x06, 0x0F,
-            0x62, 0x06, 0x02, 0x80, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00}}, /*"水",17*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"昌", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00,
-            0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00,
-            0xE0, 0xFF, 0x00, 0x60, 0x40, 0x00, 0x08, 0x00, 0x03, 0xF8, 0xFF, 0x03,
-            0x18, 0x00, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03,
-            0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00}}, /*"昌",18*/
-    /* (20 X 20 , 华文中宋 )*/
-
-    {"上", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-            0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x86, 0x01,
-            0x00, 0xFE, 0x03, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-            0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
-            0x00, 0x06, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, /*"上",19*/
-    /* (20 X 20 , 华文中宋 )*/
+/**
+ * @brief 20 点阵汉字 (周日专用) 码点表 (Unicode，严格升序)
+ * @note  LCD_Show_String 在此表中二分查找，第 i 个码点的字模是 HZK_Week_20[i]。
+ *        由 Utils/输入汉字自动生成要求格式的模文件.py 生成，手工增删条目后必须保持升序。
+ *        LCD_FONT_SUBSET=ON 时本文件只作模板：构建时由 Utils/font_subset.py 按固件实际用到的字
+ *        重新生成码点表与字模 (HZK_Week_20_PACKED 为 1 表示字模已压缩为 HZK_Week_20_RLE)。
+ */
+const uint16_t HZK_Week_20_Code[] = {
+    0x2103, // ℃
+    0x4E00, // 一
+    0x4E03, // 七
+    0x4E09, // 三
+    0x4E0A, // 上
+    0x4E8C, // 二
+    0x4E94, // 五
+    0x4EAC, // 京
+    0x4FEE, // 修
+    0x516D, // 六
+    0x5317, // 北
+    0x5357, // 南
+    0x56DB, // 四
+    0x5929, // 天
+    0x5DDE, // 州
+    0x65E5, // 日
+    0x660C, // 昌
+    0x661F, // 星
+    0x671F, // 期
+    0x6C34, // 水
+    0x6D77, // 海
+    0x6E29, // 温
+};
 
-    {"海", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x06, 0x00,
-            0x30, 0x03, 0x03, 0xA0, 0xFF, 0x07, 0x80, 0x81, 0x00, 0xCE, 0xFF, 0x03,
-            0xCC, 0x89, 0x01, 0xA8, 0x91, 0x01, 0xA0, 0x91, 0x05, 0xF0, 0xFF, 0x0F,
-            0x9E, 0x89, 0x01, 0x98, 0x99, 0x01, 0x98, 0x91, 0x03, 0xD8, 0xFF, 0x07,
-            0x98, 0xC0, 0x01, 0x18, 0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00}}, /*"海",20*/
-    /* (20 X 20 , 华文中宋 )*/
+/**
+ * @brief 20 点阵汉字 (周日专用) 字模 (与 HZK_Week_20_Code 一一对应)
+ */
+const uint8_t HZK_Week_20[][60] = {
+    /* "℃" U+2103, 0 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7C, 0x01, 0x24, 0x86, 0x01,
+        0x24, 0x03, 0x01, 0x98, 0x01, 0x02, 0x80, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00,
+        0xC0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x86, 0x01,
+        0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "一" U+4E00, 1 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "七" U+4E03, 2 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+        0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x83, 0x07, 0x00, 0x7F, 0x00, 0xC0, 0x03, 0x00,
+        0x3C, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02,
+        0x00, 0x03, 0x07, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "三" U+4E09, 3 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03,
+        0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
+        0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "上" U+4E0A, 4 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x86, 0x01, 0x00, 0xFE, 0x03, 0x00, 0x06, 0x00,
+        0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x06, 0x00, 0x00, 0x06, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "二" U+4E8C, 5 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC0, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "五" U+4E94, 6 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xFC, 0xFF, 0x03,
+        0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x80, 0x61, 0x00, 0xF8, 0xFF, 0x00,
+        0x80, 0x61, 0x00, 0x80, 0x61, 0x00, 0x80, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00,
+        0xC0, 0x60, 0x06, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "京" U+4EAC, 7 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x04, 0x07,
+        0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00, 0xE0, 0xFF, 0x01, 0x60, 0xC0, 0x00,
+        0x60, 0xC0, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0xC6, 0x00, 0xE0, 0x26, 0x00, 0x30, 0xC6, 0x00,
+        0x18, 0x86, 0x03, 0x0C, 0x06, 0x03, 0x82, 0x07, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "修" U+4FEE, 8 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x60, 0x30, 0x00, 0x60, 0x30, 0x02,
+        0xB0, 0xF8, 0x07, 0xB0, 0x99, 0x03, 0xB8, 0xD5, 0x01, 0xB8, 0xE3, 0x00, 0xB4, 0xE1, 0x07,
+        0xB2, 0x39, 0x0E, 0xB0, 0x77, 0x00, 0xB0, 0x99, 0x00, 0xB0, 0xC7, 0x01, 0xB0, 0x71, 0x02,
+        0xB0, 0x9C, 0x07, 0x30, 0xE3, 0x01, 0x30, 0x38, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "六" U+516D, 9 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+        0x80, 0x09, 0x00, 0xC0, 0x31, 0x00, 0xC0, 0x60, 0x00, 0x60, 0xC0, 0x00, 0x30, 0x80, 0x01,
+        0x10, 0x80, 0x03, 0x08, 0x00, 0x03, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "北" U+5317, 10 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x39, 0x00, 0x80, 0x19, 0x00,
+        0x80, 0x19, 0x00, 0x80, 0x19, 0x01, 0x80, 0x99, 0x03, 0xFC, 0xD9, 0x00, 0x80, 0x39, 0x00,
+        0x80, 0x19, 0x00, 0x80, 0x19, 0x00, 0x80, 0x19, 0x00, 0x80, 0x19, 0x02, 0xF8, 0x19, 0x02,
+        0x8C, 0x19, 0x06, 0x84, 0xF9, 0x07, 0x80, 0xF9, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "南" U+5357, 11 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x07,
+        0xFE, 0xFF, 0x07, 0x00, 0x06, 0x00, 0x08, 0x06, 0x03, 0xF8, 0xFF, 0x03, 0x98, 0x11, 0x03,
+        0x38, 0x29, 0x03, 0xD8, 0x7F, 0x03, 0x18, 0x46, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x06, 0x03,
+        0x18, 0x06, 0x03, 0x18, 0x06, 0x03, 0x18, 0xC6, 0x03, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00,
+    },
+    /* "四" U+56DB, 12 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0xF8, 0xFF, 0x03,
+        0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03, 0x98, 0x19, 0x03,
+        0x98, 0x19, 0x03, 0x98, 0x18, 0x03, 0xD8, 0x18, 0x03, 0x58, 0xF8, 0x03, 0x38, 0x00, 0x03,
+        0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "天" U+5929, 13 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xF8, 0xFF, 0x03,
+        0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x03, 0xFC, 0xFF, 0x07,
+        0x00, 0x0E, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x80, 0x31, 0x00,
+        0xC0, 0xE0, 0x00, 0x60, 0xC0, 0x03, 0x18, 0x80, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "州" U+5DDE, 14 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x03, 0x60, 0x0C, 0x03,
+        0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0xE8, 0x1C, 0x03, 0x68, 0x6D, 0x03,
+        0x6C, 0x6F, 0x03, 0x6E, 0x2D, 0x03, 0x60, 0x0C, 0x03, 0x60, 0x0C, 0x03, 0x20, 0x0C, 0x03,
+        0x30, 0x0C, 0x03, 0x10, 0x0C, 0x03, 0x0C, 0x00, 0x03, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+    },
+    /* "日" U+65E5, 15 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00, 0xE0, 0xFF, 0x01,
+        0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00,
+        0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00,
+        0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0x60, 0xC0, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "昌" U+660C, 16 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x00, 0xE0, 0xFF, 0x00,
+        0x60, 0xC0, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0xC0, 0x00, 0xE0, 0xFF, 0x00, 0x60, 0x40, 0x00,
+        0x08, 0x00, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03,
+        0x18, 0x00, 0x03, 0xF8, 0xFF, 0x03, 0x18, 0x00, 0x03, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00,
+    },
+    /* "星" U+661F, 17 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0xC0, 0x00,
+        0xF0, 0xFF, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xC0, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0xCE, 0x00,
+        0x30, 0x86, 0x01, 0xF0, 0xFF, 0x03, 0x18, 0x06, 0x00, 0x0C, 0xC6, 0x00, 0xF4, 0xFF, 0x01,
+        0x02, 0x06, 0x00, 0x00, 0x06, 0x07, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "期" U+671F, 18 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x30, 0x13, 0x01, 0x30, 0xF3, 0x07,
+        0x30, 0x37, 0x03, 0xFC, 0x3F, 0x03, 0x30, 0x33, 0x03, 0xF0, 0xF3, 0x03, 0x30, 0x33, 0x03,
+        0xF0, 0x33, 0x03, 0x30, 0xF3, 0x03, 0xFE, 0x37, 0x03, 0x00, 0x38, 0x03, 0xB0, 0x19, 0x03,
+        0x18, 0x1B, 0x03, 0x08, 0x2E, 0x03, 0x04, 0xC6, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
+    },
+    /* "水" U+6C34, 19 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x06, 0x01, 0x40, 0x8E, 0x03, 0xFE, 0xCE, 0x01, 0xC0, 0x6E, 0x00, 0x60, 0x16, 0x00,
+        0x60, 0x16, 0x00, 0x60, 0x26, 0x00, 0x30, 0x66, 0x00, 0x10, 0xC6, 0x01, 0x18, 0x86, 0x03,
+        0x04, 0x06, 0x0F, 0x62, 0x06, 0x02, 0x80, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "海" U+6D77, 20 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x06, 0x00, 0x30, 0x03, 0x03,
+        0xA0, 0xFF, 0x07, 0x80, 0x81, 0x00, 0xCE, 0xFF, 0x03, 0xCC, 0x89, 0x01, 0xA8, 0x91, 0x01,
+        0xA0, 0x91, 0x05, 0xF0, 0xFF, 0x0F, 0x9E, 0x89, 0x01, 0x98, 0x99, 0x01, 0x98, 0x91, 0x03,
+        0xD8, 0xFF, 0x07, 0x98, 0xC0, 0x01, 0x18, 0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    },
+    /* "温" U+6E29, 21 */
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x01, 0x30, 0xFF, 0x01,
+        0x30, 0x83, 0x01, 0x20, 0xFF, 0x01, 0x26, 0x83, 0x01, 0x2C, 0x83, 0x01, 0x18, 0xFF, 0x01,
+        0x90, 0x83, 0x01, 0x98, 0xFF, 0x07, 0x88, 0x6D, 0x03, 0x8E, 0x6D, 0x03, 0x8C, 0x6D, 0x03,
+        0x8C, 0x6D, 0x03, 0x8C, 0x6D, 0x03, 0xEC, 0xFF, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
 };
 
 // 自动计算 HZK_Week_20 数组里的字符个数
-#define HZK_Week_20_COUNT (sizeof(HZK_Week_20) / sizeof(HZK_Week_20[0]))
+#define HZK_Week_20_COUNT (sizeof(HZK_Week_20_Code) / sizeof(HZK_Week_20_Code[0]))
+
+/**
+ * @brief ASCII_10x20 (ascii_week_10x20.c) 的字符区间：只取模了 ' '~'9'，其余字符画缺字占位块
+ */
+static const font_range_t ASCII_10x20_Ranges[] = {
+    {' ', 26, 0}, // ' '~'9' (日期、秒、温度)
+};
 
 /**
  * @brief 全局 20 点阵字体配置对象实例
@@ -181,17 +212,33 @@ font_info_t font_time_20 = {
     // --- ASCII 部分 ---
     .ascii_w   = 10,
     .ascii_h   = 20,
+#if LCD_FONT_AA
+    .ascii_gray = ASCII_10x20_GRAY, // 构建时生成的 4-bpp 灰度字模 (抗锯齿)
+#else
     .ascii_map = ASCII_10x20,
+#endif
+    .ascii_ranges      = ASCII_10x20_Ranges,
+    .ascii_range_count = sizeof(ASCII_10x20_Ranges) / sizeof(ASCII_10x20_Ranges[0]),
 
     // --- 汉字 部分 ---
     .cn_w      = 20,
     .cn_h      = 20,
-    .hzk_table = (const void*) HZK_Week_20,
-
-    // 这里的 count 最好是用 sizeof 动态算，或者写个宏
+    .hzk_code  = HZK_Week_20_Code,
     .hzk_count = HZK_Week_20_COUNT,
+#if LCD_FONT_AA
+    .hzk_gray = &HZK_Week_20_GRAY[0][0], // 构建时生成的 4-bpp 灰度字模 (抗锯齿)
+#elif HZK_Week_20_PACKED
+    .hzk_rle = &HZK_Week_20_RLE, // 构建时裁剪后压缩生成 (LCD_FONT_SUBSET)
+#else
+    .hzk_glyph = &HZK_Week_20[0][0],
 
     // --- 寻址参数 ---
-    .hzk_struct_size = sizeof(HZK_Week_20_t),
-    .hzk_data_offset = 4, // index 占 2 字节
-    .hzk_data_size   = 60};
\ No newline at end of file
+    .hzk_data_size = sizeof(HZK_Week_20[0]),
+#endif
+#if LCD_FONT_EXT
+    .hzk_ext = 1, // 缺字到外部 Flash 字库查找
+#endif
+
+    // --- 渲染选项 ---
+    .glyph_cache = 1, // 时钟/日期每秒重绘，同样的字同样的颜色
+};
\ No newline at end of file
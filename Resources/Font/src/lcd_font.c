@@ -4,90 +4,377 @@
  */
 
 #include "lcd_font.h"
+#include "lcd_font_rle.h"
+#include "lcd_font_gray.h"
+#include "lcd_glyph_cache.h"
+#if LCD_FONT_EXT
+#include "lcd_font_ext.h"
+#endif
 #include "st7789.h" // 依赖底层驱动的绘图指令
+#include "st7789_pipe.h"
+#include "st7789_pix.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <string.h>
 
 /**
- * @brief  底层绘图：绘制单个字模 (私有)
- * @param  x, y: 起始坐标
- * @param  w, h: 字模宽高
- * @param  dots: 字模数据指针
- * @param  size: 字模数据总字节数
+ * @brief 一段文字中最多容纳的字符数
+ * @note  一行 240 像素最多放 30 个 8 像素宽的 ASCII，超出时自动拆成多段
+ */
+#define LCD_RUN_MAX_GLYPHS 32
+
+#if LCD_FONT_EXT && LCD_FONT_EXT_SLOTS < LCD_RUN_MAX_GLYPHS
+#error "LCD_FONT_EXT_SLOTS 不能少于一段的最大字数，否则同一段里的外部字模会互相淘汰"
+#endif
+
+#define LCD_MISSING_COLOR 0xF800 // 字库缺字的占位色 (红)
+
+/**
+ * @brief 一段文字中的单个字符
+ */
+typedef struct
+{
+    const uint8_t*          dots;   ///< 位图字模 (LSB First，行按字节对齐)
+    const font_rle_t*       rle;    ///< 压缩字模所在的字库
+    const font_rle_glyph_t* packed; ///< 压缩字模，与 dots 二选一，都为 NULL 表示缺字
+    const uint8_t*          gray;   ///< 4-bpp 灰度字模，非 NULL 时代替 dots / packed
+    LCD_RLE_Cursor_t        cursor; ///< 压缩字模的逐行解码位置
+    const uint16_t*         pixels; ///< 缓存中已展开的 RGB565 像素，NULL 表示逐行展开
+    uint8_t                 left;   ///< 绘制窗口在字符格内的起始列 (比例字宽)
+    uint8_t                 w;      ///< 绘制宽度 = 步进宽度 (px)
+    uint8_t                 h;      ///< 高度 (px)
+    uint8_t                 stride; ///< 位图 (灰度) 字模每行字节数
+    uint8_t                 cache;  ///< 所属字体是否使用字模缓存
+} LCD_Glyph_t;
+
+static LCD_Glyph_t s_run_glyphs[LCD_RUN_MAX_GLYPHS]; // 当前文字段
+
+uint8_t LCD_UTF8_Decode(const char* str, uint32_t* cp)
+{
+    const uint8_t* s = (const uint8_t*) str;
+    uint8_t        len;
+    uint32_t       code;
+
+    if ((s[0] & 0xE0) == 0xC0)
+    {
+        len  = 2;
+        code = s[0] & 0x1F;
+    }
+    else if ((s[0] & 0xF0) == 0xE0)
+    {
+        len  = 3;
+        code = s[0] & 0x0F;
+    }
+    else if ((s[0] & 0xF8) == 0xF0)
+    {
+        len  = 4;
+        code = s[0] & 0x07;
+    }
+    else
+    {
+        *cp = 0; // 孤立的后续字节或非法首字节
+        return 1;
+    }
+
+    for (uint8_t i = 1; i < len; i++)
+    {
+        // 后续字节必须是 10xxxxxx (遇到 '\0' 也会在这里停下)
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *cp = 0;
+            return 1;
+        }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+
+    *cp = code;
+    return len;
+}
+
+int32_t LCD_Find_Code(const font_info_t* font, uint32_t cp)
+{
+    if (!font->hzk_code || font->hzk_count == 0 || cp > 0xFFFF)
+        return -1;
+
+    uint16_t lo = 0;
+    uint16_t hi = font->hzk_count;
+
+    while (lo < hi)
+    {
+        uint16_t mid  = (lo + hi) / 2;
+        uint16_t code = font->hzk_code[mid];
+
+        if (code == cp)
+            return mid;
+        if (code < cp)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return -1;
+}
+
+/**
+ * @brief  在字体的字符区间表中查找 ASCII 字模序号 (私有，二分查找)
+ * @note   没有区间表的字体收录完整的 0x20~0x7E
+ * @retval 字模序号，未收录返回 -1
+ */
+static int32_t LCD_Find_Ascii(const font_info_t* font, uint8_t c)
+{
+    if (!font->ascii_ranges)
+        return c - 0x20;
+
+    uint8_t lo = 0;
+    uint8_t hi = font->ascii_range_count;
+
+    while (lo < hi)
+    {
+        uint8_t             mid = (lo + hi) / 2;
+        const font_range_t* r   = &font->ascii_ranges[mid];
+
+        if (c < r->first)
+            hi = mid;
+        else if (c >= r->first + r->count)
+            lo = mid + 1;
+        else
+            return r->offset + (c - r->first);
+    }
+    return -1;
+}
+
+/**
+ * @brief  取出下一个字符的字模 (私有)
+ * @param  font:  字体
+ * @param  str:   字符串当前位置 (不能是 '\0' / '\n')
+ * @param  glyph: 输出字模描述
+ * @param  fetch: 0 = 只要宽高 (测量用)，片内缺字时不读外部字库，宽高取字体的汉字点阵
+ * @retval 消耗的字节数
+ */
+static uint8_t LCD_Next_Glyph(const font_info_t* font,
+                              const char*        str,
+                              LCD_Glyph_t*       glyph,
+                              uint8_t            fetch)
+{
+    // ASCII 可见字符 (标准 ASCII < 0x80，兼容 UTF-8 的单字节部分)
+    if (*str >= 0x20 && *str <= 0x7E)
+    {
+        int32_t index = LCD_Find_Ascii(font, (uint8_t) *str);
+
+        glyph->dots   = NULL; // 字体未收录时保持 NULL，画占位块
+        glyph->packed = NULL;
+        glyph->gray   = NULL;
+        glyph->stride = (font->ascii_w + 7) / 8;
+        if (index >= 0 && font->ascii_gray)
+        {
+            glyph->stride = (font->ascii_w + 1) / 2;
+            glyph->gray   = font->ascii_gray + (uint32_t) index * glyph->stride * font->ascii_h;
+        }
+        else if (index >= 0 && font->ascii_rle)
+        {
+            glyph->rle    = font->ascii_rle;
+            glyph->packed = &font->ascii_rle->glyphs[index];
+        }
+        else if (index >= 0)
+        {
+            // 单个字符的字节数 = 行宽字节数 (向上取整) * 高度
+            uint32_t char_size = (uint32_t) ((font->ascii_w + 7) / 8) * font->ascii_h;
+
+            glyph->dots = font->ascii_map + (uint32_t) index * char_size;
+        }
+
+        // 比例字体只画字符格内的一个窗口，光标按步进宽度前进
+        if (index >= 0 && font->ascii_metrics)
+        {
+            glyph->left = font->ascii_metrics[index].left;
+            glyph->w    = font->ascii_metrics[index].advance;
+        }
+        else
+        {
+            glyph->left = 0;
+            glyph->w    = font->ascii_w;
+        }
+        glyph->h     = font->ascii_h;
+        glyph->cache = font->glyph_cache;
+        return 1;
+    }
+
+    // 汉字/特殊符号：UTF-8 解码 + 码点二分查找，缺字时跳过整个字符画占位块
+    uint32_t cp;
+    uint8_t  len   = LCD_UTF8_Decode(str, &cp);
+    int32_t  index = LCD_Find_Code(font, cp);
+
+    glyph->dots   = NULL;
+    glyph->packed = NULL;
+    glyph->gray   = NULL;
+    glyph->stride = (font->cn_w + 7) / 8;
+    if (index >= 0 && font->hzk_gray)
+    {
+        glyph->stride = (font->cn_w + 1) / 2;
+        glyph->gray   = font->hzk_gray + (uint32_t) index * glyph->stride * font->cn_h;
+    }
+    else if (index >= 0 && font->hzk_rle)
+    {
+        glyph->rle    = font->hzk_rle;
+        glyph->packed = &font->hzk_rle->glyphs[index];
+    }
+    else if (index >= 0)
+    {
+        glyph->dots = font->hzk_glyph + (uint32_t) index * font->hzk_data_size;
+    }
+
+    glyph->left  = 0;
+    glyph->w     = font->cn_w;
+    glyph->h     = font->cn_h;
+    glyph->cache = font->glyph_cache;
+
+#if LCD_FONT_EXT
+    // 片内没有的字到外部 Flash 字库查找；缓存槽位会换成别的字，不能作为 RGB565 缓存的键
+    if (index < 0 && font->hzk_ext && fetch)
+    {
+        glyph->dots  = LCD_Font_Ext_Get(cp, font->cn_w, font->cn_h);
+        glyph->cache = 0;
+    }
+#endif
+    return len;
+}
+
+/**
+ * @brief  展开字模的下一行 (私有)
+ * @note   压缩字模由解码位置记住当前行，必须从第 0 行起逐行调用
+ * @param  row: 字模内的行号 (位图字模直接定位)
+ * @param  lut: 本段的混色表 (灰度字模使用)
+ */
+static void LCD_Glyph_Row(LCD_Glyph_t*    g,
+                          uint16_t*       dst,
+                          uint16_t        row,
+                          uint16_t        fg,
+                          uint16_t        bg,
+                          const uint16_t* lut)
+{
+    if (g->gray)
+    {
+        LCD_Gray_Expand_Row(dst, g->gray + (uint32_t) row * g->stride, g->left, g->w, lut);
+        return;
+    }
+    if (g->packed)
+    {
+        LCD_RLE_Next_Row(&g->cursor, dst, fg, bg);
+        return;
+    }
+
+    // 定位到字模当前行，行末的 padding bit 由行宽字节数跳过
+    ST7789_Pix_Expand_Bits(dst, g->dots + (uint32_t) row * g->stride, g->left, g->w, fg, bg);
+}
+
+/**
+ * @brief  绘制一段同行文字 (私有)
+ * @note   整段只开一次地址窗口，逐行把每个字的这一行展开进管线行缓冲，由 DMA 连续发送。
+ *         各字底部对齐 (同一基线)，比段高矮的字上方补背景色。
+ *         使用字模缓存的字体先取缓存：命中时每行只是一次拷贝，未命中时整字展开存入缓存。
+ *         压缩字模不整字解压，每行从各自的解码位置解出一行扫描线。
+ *         灰度字模整段共用一张 (fg, bg) 混色表，每像素一次查表。
+ * @param  x, y:   段左上角
+ * @param  w, h:   段宽 (各字宽度之和)、段高 (最高的字)
+ * @param  count:  字数 (s_run_glyphs 前 count 项)
  * @param  fg, bg: 前景色/背景色
  */
-static void LCD_Draw_Glyph_Base(uint16_t       x,
-                                uint16_t       y,
-                                uint16_t       w,
-                                uint16_t       h,
-                                const uint8_t* dots,
-                                uint32_t       size, // 这个参数现在仅作保险用
-                                uint16_t       fg,
-                                uint16_t       bg)
+static void LCD_Draw_Run(uint16_t x,
+                         uint16_t y,
+                         uint16_t w,
+                         uint16_t h,
+                         uint8_t  count,
+                         uint16_t fg,
+                         uint16_t bg)
 {
-    // 1. 设置窗口 (保持不变)
-    TFT_SEND_CMD(0x2A);
-    TFT_SEND_DATA(x >> 8);
-    TFT_SEND_DATA(x & 0xFF);
-    TFT_SEND_DATA((x + w - 1) >> 8);
-    TFT_SEND_DATA((x + w - 1) & 0xFF);
+    if (!ST7789_Pipe_Begin(x, y, w, h))
+    {
+#if LCD_FONT_EXT
+        LCD_Font_Ext_Release(); // 收集时钉住的外部字模
+#endif
+        return;
+    }
 
-    TFT_SEND_CMD(0x2B);
-    TFT_SEND_DATA(y >> 8);
-    TFT_SEND_DATA(y & 0xFF);
-    TFT_SEND_DATA((y + h - 1) >> 8);
-    TFT_SEND_DATA((y + h - 1) & 0xFF);
+    const uint16_t* lut = NULL;
+
+    // 1. 压缩字模回到第 0 行；取混色表与缓存 (本段结束前取到的字模不会被淘汰)
+    for (uint8_t i = 0; i < count; i++)
+    {
+        LCD_Glyph_t* g = &s_run_glyphs[i];
+        const void*  key;
+        uint8_t      hit;
+        uint16_t*    px;
 
-    TFT_SEND_CMD(0x2C);
+        if (g->gray)
+            key = g->gray;
+        else if (g->packed)
+            key = g->packed;
+        else
+            key = g->dots;
 
-    uint8_t fg_h = fg >> 8, fg_l = fg & 0xFF;
-    uint8_t bg_h = bg >> 8, bg_l = bg & 0xFF;
+        if (g->gray && !lut)
+            lut = LCD_Gray_LUT(fg, bg);
+        if (g->packed)
+            LCD_RLE_Begin(&g->cursor, g->rle, g->packed, g->left, g->w);
 
-    LCD_DC_SET();
-    LCD_CS_CLR();
+        g->pixels = NULL;
+        if (!g->cache || !key)
+            continue;
 
-    // === 核心修改：计算每行实际占用的字节数 (向上取整) ===
-    // 例如宽度 12：(12+7)/8 = 2 字节
-    uint8_t bytes_per_row = (w + 7) / 8;
+        px = LCD_Glyph_Cache_Get(key, g->w, g->h, fg, bg, &hit);
+        if (px && !hit)
+        {
+            for (uint16_t row = 0; row < g->h; row++)
+            {
+                LCD_Glyph_Row(g, px + row * g->w, row, fg, bg, lut);
+            }
+        }
+        g->pixels = px;
+    }
 
+    // 2. 逐行拼装
     for (uint16_t row = 0; row < h; row++)
     {
-        // 定位到当前行的起始数据位置
-        const uint8_t* row_data = dots + (row * bytes_per_row);
+        // 在行缓冲里展开一行，上一批行此时正由 DMA 发送
+        uint16_t* line = ST7789_Pipe_Line();
 
-        for (uint16_t col = 0; col < w; col++)
+        for (uint8_t i = 0; i < count; i++)
         {
-            // 计算当前点在这一行里的 字节索引 和 位索引
-            uint8_t byte_idx = col / 8;
-            uint8_t bit_idx  = col % 8;
+            LCD_Glyph_t* g   = &s_run_glyphs[i];
+            uint16_t     top = h - g->h; // 底部对齐时字上方的空白行数
+            uint16_t     g_w = g->w;
 
-            // 取出对应的字节
-            uint8_t pixel_byte = row_data[byte_idx];
-
-            // 判断该位是否点亮
-            // 你的字模是 LSB First (低位在前)，所以用 (1 << bit_idx)
-            // 如果是 MSB First，则用 (0x80 >> bit_idx)
-            if (pixel_byte & (1 << bit_idx))
+            if (row < top || (!g->dots && !g->packed && !g->gray))
             {
-                ST7789_SPI_SendByte(fg_h);
-                ST7789_SPI_SendByte(fg_l);
+                uint16_t c = (row >= top) ? LCD_MISSING_COLOR : bg;
+                for (uint16_t col = 0; col < g_w; col++)
+                {
+                    line[col] = c;
+                }
+            }
+            else if (g->pixels)
+            {
+                memcpy(line, g->pixels + (row - top) * g_w, g_w * 2);
             }
             else
             {
-                ST7789_SPI_SendByte(bg_h);
-                ST7789_SPI_SendByte(bg_l);
+                LCD_Glyph_Row(g, line, row - top, fg, bg, lut);
             }
+            line += g_w;
         }
-        // 一行画完，循环结束。
-        // 下次循环 row++，row_data 指针会自动跳过行末的 padding bit，对齐到下一行首。
     }
 
-    LCD_CS_SET();
+    // 提交最后一块缓冲，不等待发送完成
+    ST7789_Pipe_End();
+    LCD_Glyph_Cache_Release();
+#if LCD_FONT_EXT
+    LCD_Font_Ext_Release();
+#endif
 }
 
 /**
- * @brief  显示字符串 (智能匹配 GBK/UTF-8 编码)
+ * @brief  显示字符串 (UTF-8 编码)
+ * @note   把同一行上连续的字收集成一段，一段只开一次窗口、一次流式发送；
+ *         遇到换行、自动换行或段满时提交当前段。
  */
 void LCD_Show_String(uint16_t           x,
                      uint16_t           y,
@@ -103,13 +390,23 @@ void LCD_Show_String(uint16_t           x,
     uint16_t cursor_x = x;
     uint16_t cursor_y = y;
 
+    // 当前段
+    uint16_t run_x = x;
+    uint16_t run_w = 0;
+    uint8_t  run_h = 0;
+    uint8_t  run_n = 0;
+
     while (*str)
     {
         // === A. 处理换行符 ===
         if (*str == '\n')
         {
+            LCD_Draw_Run(run_x, cursor_y, run_w, run_h, run_n, color_fg, color_bg);
+            run_w = run_h = run_n = 0;
+
             cursor_x = x;
             cursor_y += font->ascii_h;
+            run_x = cursor_x;
             str++;
             continue;
         }
@@ -118,99 +415,72 @@ void LCD_Show_String(uint16_t           x,
         if (cursor_y + font->cn_h > TFT_LINE_NUMBER)
             break;
 
-        // 自动换行检测
-        if (cursor_x + font->cn_w > TFT_COLUMN_NUMBER)
+        // 自动换行检测 / 段满：先提交当前段
+        uint8_t wrap = (cursor_x + font->cn_w > TFT_COLUMN_NUMBER) ? 1 : 0;
+        if (wrap || run_n == LCD_RUN_MAX_GLYPHS)
         {
-            cursor_x = x;
-            cursor_y += font->cn_h;
-        }
+            LCD_Draw_Run(run_x, cursor_y, run_w, run_h, run_n, color_fg, color_bg);
+            run_w = run_h = run_n = 0;
 
-        // === B. 处理 ASCII 字符 (标准 ASCII < 0x80) ===
-        // 注意：这里只要最高位是0，就认为是 ASCII，兼容 UTF-8 和 GBK 的 ASCII 部分
-        if (*str >= 0x20 && *str <= 0x7E)
-        {
-            // ... 换行和越界检测保持不变 ...
-
-            uint32_t char_idx = *str - 0x20;
-
-            // === 核心修改：计算单个字符占用的字节数 ===
-            // 公式：(行宽字节数) * 高度
-            // 之前是 (w*h)/8，现在必须考虑字节对齐 padding
-            uint32_t bytes_per_row = (font->ascii_w + 7) / 8;
-            uint32_t char_size     = bytes_per_row * font->ascii_h;
-
-            LCD_Draw_Glyph_Base(cursor_x,
-                                cursor_y,
-                                font->ascii_w,
-                                font->ascii_h,
-                                font->ascii_map + (char_idx * char_size),
-                                char_size,
-                                color_fg,
-                                color_bg);
-
-            cursor_x += font->ascii_w;
-            str++;
+            if (wrap)
+            {
+                cursor_x = x;
+                cursor_y += font->cn_h;
+                if (cursor_y + font->cn_h > TFT_LINE_NUMBER)
+                    break;
+            }
+            run_x = cursor_x;
         }
-        // === C. 处理 汉字/特殊符号 (智能字符串匹配模式) ===
-        else
-        {
-            const uint8_t* p_target_data = NULL;
-            int            match_len     = 0; // 记录匹配到的字符串长度 (用于跳过)
 
-            // --- 遍历字库比对字符串 ---
-            if (font->hzk_table && font->hzk_count > 0)
-            {
-                const uint8_t* p_base = (const uint8_t*) font->hzk_table;
+        // === B. 收集字模 (ASCII / 汉字) ===
+        LCD_Glyph_t* g = &s_run_glyphs[run_n++];
+        str += LCD_Next_Glyph(font, str, g, 1);
 
-                for (uint16_t i = 0; i < font->hzk_count; i++)
-                {
-                    const uint8_t* p_entry = p_base + (i * font->hzk_struct_size);
-
-                    // 1. 获取字库中当前字的字符串索引 (假设它在结构体首地址)
-                    // 这里的 *(const char**) 是指：取结构体前4个字节，当作一个字符串指针
-                    const char* key = *(const char**) p_entry;
-
-                    // 2. 获取 key 的长度 (例如 "朱" 在 UTF-8 是 3，GBK 是 2)
-                    size_t key_len = strlen(key);
-
-                    // 3. 比对：看当前的 str 开头是否和 key 一模一样
-                    if (strncmp(str, key, key_len) == 0)
-                    {
-                        // 匹配成功！
-                        // 计算数据偏移：结构体首地址 + 数据偏移量
-                        p_target_data = p_entry + font->hzk_data_offset;
-                        match_len     = key_len; // 记下长度，后面 str 要跳过这么多
-                        break;
-                    }
-                }
-            }
+        run_w += g->w;
+        if (g->h > run_h)
+            run_h = g->h;
+        cursor_x += g->w;
+    }
 
-            if (p_target_data)
-            {
-                // 绘制汉字
-                LCD_Draw_Glyph_Base(cursor_x,
-                                    cursor_y,
-                                    font->cn_w,
-                                    font->cn_h,
-                                    p_target_data,
-                                    font->hzk_data_size,
-                                    color_fg,
-                                    color_bg);
-                cursor_x += font->cn_w;
-                str += match_len; // 关键：匹配了几个字节就跳过几个
-            }
-            else
-            {
-                // 没找到字 (字库缺失或乱码)
-                // 绘制红色方块提示 (调试用)
-                TFT_Fill_Rect_DMA(cursor_x, cursor_y, font->cn_w, font->cn_h, 0xF800); // RED
+    // 2. 提交最后一段
+    LCD_Draw_Run(run_x, cursor_y, run_w, run_h, run_n, color_fg, color_bg);
+}
 
-                cursor_x += font->cn_w; // 占位宽度
+void LCD_Measure_String(const char* str, const font_info_t* font, uint16_t* w, uint16_t* h)
+{
+    uint16_t    max_w  = 0;
+    uint16_t    max_h  = 0;
+    uint16_t    line_w = 0;
+    uint16_t    line_h = 0;
+    uint16_t    line_y = 0;
+    LCD_Glyph_t g;
 
-                // 强制跳过 1 个字节，防止死循环 (尝试重新对齐)
-                // 商业代码里这里可以优化，但跳过1字节是最安全的兜底
-                str++;
-            }
+    while (str && font && *str)
+    {
+        // 与 LCD_Show_String 一致：换行按 ASCII 高度下移
+        if (*str == '\n')
+        {
+            line_y += font->ascii_h;
+            line_w = line_h = 0;
+            str++;
+            continue;
         }
+
+        // 外部字模与片内汉字同为 cn_w x cn_h，测量不必读 Flash
+        str += LCD_Next_Glyph(font, str, &g, 0);
+
+        line_w += g.w;
+        if (g.h > line_h)
+            line_h = g.h;
+
+        if (line_w > max_w)
+            max_w = line_w;
+        if (line_y + line_h > max_h)
+            max_h = line_y + line_h;
     }
-}
\ No newline at end of file
+
+    if (w)
+        *w = max_w;
+    if (h)
+        *h = max_h;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file    lcd_font_ext.c
+ * @brief   外部 SPI Flash 汉字字库与 RAM 字模缓存实现
+ */
+
+#include "lcd_font_ext.h"
+#include "w25qxx.h"
+#include <stddef.h>
+#include <string.h>
+
+#define EXT_GBK_TRAILS 190 // 每个首字节下的尾字节数 (0x40~0xFE 去掉 0x7F)
+
+/**
+ * @brief 缓存条目状态
+ */
+typedef enum
+{
+    EXT_SLOT_FREE = 0, // 空闲
+    EXT_SLOT_GLYPH,    // 存有字模
+    EXT_SLOT_ABSENT    // 字库中没有这个字 (避免反复读 Flash)
+} Ext_Slot_State_e;
+
+/**
+ * @brief 缓存条目 (字模存放在 s_ext_pool 的同号槽位)
+ */
+typedef struct
+{
+    uint16_t code;     // 键：Unicode 码点
+    uint8_t  section;  // 键：字号
+    uint8_t  state;    // Ext_Slot_State_e
+    uint8_t  pinned;   // 本段文字正在使用，不可淘汰
+    uint32_t last_use; // 最近使用的时钟值，越小越久未用
+} Ext_Slot_t;
+
+static LCD_Font_Ext_Header_t s_ext_header;
+static uint8_t               s_ext_ready = 0;
+
+static Ext_Slot_t           s_ext_slots[LCD_FONT_EXT_SLOTS];
+static uint8_t              s_ext_pool[LCD_FONT_EXT_SLOTS][LCD_FONT_EXT_GLYPH_MAX];
+static uint32_t             s_ext_clock = 0;
+static LCD_Font_Ext_Stats_t s_ext_stats = {0};
+
+// ====================================================================
+// 私有函数
+// ====================================================================
+
+/**
+ * @brief  查找点阵宽高对应的字号
+ * @retval 字号序号，-1 表示镜像中没有
+ */
+static int8_t Ext_Find_Section(uint8_t w, uint8_t h)
+{
+    for (uint8_t i = 0; i < s_ext_header.section_count; i++)
+    {
+        if (s_ext_header.sections[i].w == w && s_ext_header.sections[i].h == h)
+            return (int8_t) i;
+    }
+    return -1;
+}
+
+/**
+ * @brief  选一个槽位：空闲的优先，否则淘汰最久未用的未钉住条目
+ * @retval 槽位序号，-1 表示全部被钉住
+ */
+static int16_t Ext_Alloc_Slot(void)
+{
+    int16_t victim = -1;
+
+    for (uint16_t i = 0; i < LCD_FONT_EXT_SLOTS; i++)
+    {
+        if (s_ext_slots[i].state == EXT_SLOT_FREE)
+            return (int16_t) i;
+        if (!s_ext_slots[i].pinned &&
+            (victim < 0 || s_ext_slots[i].last_use < s_ext_slots[victim].last_use))
+            victim = (int16_t) i;
+    }
+    if (victim >= 0)
+        s_ext_stats.evictions++;
+    return victim;
+}
+
+/**
+ * @brief  从 Flash 读出一个字模
+ * @retval 1: 读到  0: 字库中没有
+ */
+static uint8_t Ext_Load(uint16_t cp, uint8_t section, uint8_t* dst)
+{
+    uint8_t  raw[2];
+    uint16_t gbk;
+    uint32_t map_addr = LCD_FONT_EXT_BASE + s_ext_header.map_offset + (uint32_t) cp * 2;
+
+    // 1. Unicode -> GBK (对照表小端存放)
+    if (W25Q_Read(map_addr, raw, 2) != W25Q_OK)
+        return 0;
+    gbk = (uint16_t) (raw[0] | (raw[1] << 8));
+
+    uint8_t hi = gbk >> 8;
+    uint8_t lo = gbk & 0xFF;
+    if (hi < 0x81 || hi > 0xFE || lo < 0x40 || lo > 0xFE || lo == 0x7F)
+        return 0;
+
+    // 2. GBK 码直接算出字模序号与地址
+    uint32_t index = (uint32_t) (hi - 0x81) * EXT_GBK_TRAILS + (lo - 0x40) - (lo > 0x7F ? 1 : 0);
+    uint16_t size  = s_ext_header.sections[section].glyph_bytes;
+    uint32_t addr  = LCD_FONT_EXT_BASE + s_ext_header.sections[section].offset + index * size;
+
+    return W25Q_Read(addr, dst, size) == W25Q_OK;
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+uint8_t LCD_Font_Ext_Init(void)
+{
+    s_ext_ready = 0;
+    memset(s_ext_slots, 0, sizeof(s_ext_slots));
+
+    if (W25Q_Read(LCD_FONT_EXT_BASE, (uint8_t*) &s_ext_header, sizeof(s_ext_header)) != W25Q_OK)
+        return 0;
+    if (memcmp(s_ext_header.magic, "WCFX", 4) != 0 || s_ext_header.version != 1 ||
+        s_ext_header.section_count > LCD_FONT_EXT_MAX_SECTIONS)
+        return 0;
+
+    // 超出槽位大小的字号不能缓存，直接停用
+    for (uint8_t i = 0; i < s_ext_header.section_count; i++)
+    {
+        if (s_ext_header.sections[i].glyph_bytes > LCD_FONT_EXT_GLYPH_MAX)
+            s_ext_header.sections[i].w = s_ext_header.sections[i].h = 0;
+    }
+
+    s_ext_ready = 1;
+    return 1;
+}
+
+const uint8_t* LCD_Font_Ext_Get(uint32_t cp, uint8_t w, uint8_t h)
+{
+    if (!s_ext_ready || cp > 0xFFFF)
+        return NULL;
+
+    int8_t section = Ext_Find_Section(w, h);
+    if (section < 0)
+        return NULL;
+
+    s_ext_stats.lookups++;
+
+    // 1. 查找
+    for (uint16_t i = 0; i < LCD_FONT_EXT_SLOTS; i++)
+    {
+        Ext_Slot_t* s = &s_ext_slots[i];
+        if (s->state != EXT_SLOT_FREE && s->code == cp && s->section == (uint8_t) section)
+        {
+            s->last_use = ++s_ext_clock;
+            s->pinned   = 1;
+            s_ext_stats.hits++;
+            return (s->state == EXT_SLOT_GLYPH) ? s_ext_pool[i] : NULL;
+        }
+    }
+
+    // 2. 未命中：读 Flash 放进槽位
+    int16_t slot = Ext_Alloc_Slot();
+    if (slot < 0)
+    {
+        s_ext_stats.bypass++;
+        return NULL;
+    }
+
+    Ext_Slot_t* s = &s_ext_slots[slot];
+    s->code       = (uint16_t) cp;
+    s->section    = (uint8_t) section;
+    s->state      = Ext_Load((uint16_t) cp, (uint8_t) section, s_ext_pool[slot]) ? EXT_SLOT_GLYPH
+                                                                                 : EXT_SLOT_ABSENT;
+    s->last_use   = ++s_ext_clock;
+    s->pinned     = 1;
+
+    s_ext_stats.misses++;
+    if (s->state == EXT_SLOT_ABSENT)
+        s_ext_stats.absent++;
+    return (s->state == EXT_SLOT_GLYPH) ? s_ext_pool[slot] : NULL;
+}
+
+void LCD_Font_Ext_Release(void)
+{
+    for (uint16_t i = 0; i < LCD_FONT_EXT_SLOTS; i++)
+    {
+        s_ext_slots[i].pinned = 0;
+    }
+}
+
+void LCD_Font_Ext_Get_Stats(LCD_Font_Ext_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_ext_stats;
+}
+
+void LCD_Font_Ext_Reset_Stats(void)
+{
+    memset(&s_ext_stats, 0, sizeof(s_ext_stats));
+}
@@ -0,0 +1,122 @@
+/**
+ * @file    lcd_font_gray.c
+ * @brief   4-bpp 灰度字模的混色查表与逐行展开实现
+ */
+
+#include "lcd_font_gray.h"
+#include <string.h>
+
+#define GRAY_MAX (LCD_GRAY_LEVELS - 1) // 最大灰度级 = 前景色
+
+/**
+ * @brief 混色表缓存条目
+ */
+typedef struct
+{
+    uint16_t fg, bg;               // 键
+    uint8_t  valid;                // 已计算
+    uint32_t last_use;             // 最近使用的时钟值，越小越久未用
+    uint16_t lut[LCD_GRAY_LEVELS]; // 混色表
+} Gray_LUT_Slot_t;
+
+static Gray_LUT_Slot_t  s_gray_slots[LCD_GRAY_LUT_SLOTS];
+static uint32_t         s_gray_clock = 0;
+static LCD_Gray_Stats_t s_gray_stats = {0};
+
+// ====================================================================
+// 私有函数
+// ====================================================================
+
+/**
+ * @brief  两个分量按 level / 15 混合 (四舍五入)
+ */
+static uint16_t Gray_Mix(uint16_t f, uint16_t b, uint8_t level)
+{
+    return (uint16_t) ((f * level + b * (GRAY_MAX - level) + GRAY_MAX / 2) / GRAY_MAX);
+}
+
+/**
+ * @brief  计算一张混色表 (只在未命中时执行，每种配色 16 x 3 次乘法)
+ */
+static void Gray_Build(uint16_t* lut, uint16_t fg, uint16_t bg)
+{
+    for (uint8_t i = 0; i < LCD_GRAY_LEVELS; i++)
+    {
+        uint16_t r = Gray_Mix(fg >> 11, bg >> 11, i);
+        uint16_t g = Gray_Mix((fg >> 5) & 0x3F, (bg >> 5) & 0x3F, i);
+        uint16_t b = Gray_Mix(fg & 0x1F, bg & 0x1F, i);
+
+        lut[i] = (uint16_t) ((r << 11) | (g << 5) | b);
+    }
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+const uint16_t* LCD_Gray_LUT(uint16_t fg, uint16_t bg)
+{
+    Gray_LUT_Slot_t* victim = &s_gray_slots[0];
+
+    for (uint8_t i = 0; i < LCD_GRAY_LUT_SLOTS; i++)
+    {
+        Gray_LUT_Slot_t* s = &s_gray_slots[i];
+
+        if (s->valid && s->fg == fg && s->bg == bg)
+        {
+            s->last_use = ++s_gray_clock;
+            s_gray_stats.hits++;
+            return s->lut;
+        }
+        // 空闲的优先，否则淘汰最久未用的
+        if (!s->valid || (victim->valid && s->last_use < victim->last_use))
+            victim = s;
+    }
+
+    Gray_Build(victim->lut, fg, bg);
+    victim->fg       = fg;
+    victim->bg       = bg;
+    victim->valid    = 1;
+    victim->last_use = ++s_gray_clock;
+    s_gray_stats.builds++;
+    return victim->lut;
+}
+
+void LCD_Gray_Expand_Row(uint16_t*       dst,
+                         const uint8_t*  row,
+                         uint8_t         skip,
+                         uint16_t        w,
+                         const uint16_t* lut)
+{
+    const uint8_t* p = row + skip / 2;
+
+    // 窗口从奇数列开始：先输出这个字节的高半字节
+    if ((skip & 1) && w)
+    {
+        *dst++ = lut[*p++ >> 4];
+        w--;
+    }
+
+    // 每字节两个像素，低半字节在前
+    for (; w >= 2; w -= 2)
+    {
+        uint8_t pair = *p++;
+
+        dst[0] = lut[pair & 0x0F];
+        dst[1] = lut[pair >> 4];
+        dst += 2;
+    }
+
+    if (w)
+        *dst = lut[*p & 0x0F];
+}
+
+void LCD_Gray_Get_Stats(LCD_Gray_Stats_t* stats)
+{
+    if (stats)
+        *stats = s_gray_stats;
+}
+
+void LCD_Gray_Reset_Stats(void)
+{
+    memset(&s_gray_stats, 0, sizeof(s_gray_stats));
+}
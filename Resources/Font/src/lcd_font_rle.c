@@ -0,0 +1,122 @@
+/**
+ * @file    lcd_font_rle.c
+ * @brief   压缩字模 (包围盒 + 行程编码) 的流式解码实现
+ */
+
+#include "lcd_font_rle.h"
+#include "st7789_pix.h"
+
+#define RLE_RAW_FLAG    0x80 // 组头 bit7：原始位图行
+#define RLE_REPEAT_MASK 0x7F // 组头 bit6~0：本组行数
+
+/**
+ * @brief  填充同色像素 (私有)
+ */
+static uint16_t* RLE_Fill(uint16_t* dst, uint16_t n, uint16_t color)
+{
+    while (n--)
+    {
+        *dst++ = color;
+    }
+    return dst;
+}
+
+/**
+ * @brief  跳过一个行组 (私有)
+ * @param  w: 包围盒宽度
+ * @retval 下一个行组的起始位置
+ */
+static const uint8_t* RLE_Skip_Group(const uint8_t* p, uint8_t w)
+{
+    if (*p & RLE_RAW_FLAG)
+        return p + 1 + (w + 7) / 8;
+
+    return p + 2 + (p[1] + 1) / 2;
+}
+
+/**
+ * @brief  解码当前行组的一行，只输出包围盒内 [from, to) 这几列 (私有)
+ */
+static void RLE_Decode_Group(const uint8_t* p,
+                             uint16_t*      dst,
+                             uint8_t        from,
+                             uint8_t        to,
+                             uint16_t       fg,
+                             uint16_t       bg)
+{
+    uint8_t head = *p++;
+
+    if (head & RLE_RAW_FLAG)
+    {
+        // 原始行：LSB First，与位图字库相同
+        ST7789_Pix_Expand_Bits(dst, p, from, to - from, fg, bg);
+        return;
+    }
+
+    // 行程行：背景色开始，前景/背景交替，落在窗口外的部分跳过
+    uint8_t  n     = *p++;
+    uint16_t col   = 0;
+    uint16_t color = bg;
+
+    for (uint8_t i = 0; i < n && col < to; i++)
+    {
+        uint8_t  run   = (i & 1) ? (p[i >> 1] >> 4) : (p[i >> 1] & 0x0F);
+        uint16_t start = (col > from) ? col : from;
+        uint16_t end   = (col + run < to) ? col + run : to;
+
+        if (end > start)
+            dst = RLE_Fill(dst, end - start, color);
+        col += run;
+        color = (color == bg) ? fg : bg;
+    }
+    if (col < to)
+        RLE_Fill(dst, to - ((col > from) ? col : from), bg); // 行尾未编码的部分
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+void LCD_RLE_Begin(LCD_RLE_Cursor_t*       cur,
+                   const font_rle_t*       rle,
+                   const font_rle_glyph_t* glyph,
+                   uint8_t                 left,
+                   uint8_t                 width)
+{
+    cur->glyph  = glyph;
+    cur->group  = rle->data + glyph->offset;
+    cur->repeat = glyph->h ? (cur->group[0] & RLE_REPEAT_MASK) : 0;
+    cur->row    = 0;
+    cur->left   = left;
+    cur->width  = width;
+}
+
+void LCD_RLE_Next_Row(LCD_RLE_Cursor_t* cur, uint16_t* dst, uint16_t fg, uint16_t bg)
+{
+    const font_rle_glyph_t* g   = cur->glyph;
+    uint8_t                 row = cur->row++;
+
+    // 包围盒在窗口坐标中的可见部分 [v0, v1)
+    int16_t bx = (int16_t) g->x - cur->left;
+    int16_t v0 = (bx > 0) ? bx : 0;
+    int16_t v1 = (bx + g->w < cur->width) ? bx + g->w : cur->width;
+
+    // 1. 包围盒上下方的空白行，或包围盒整个落在窗口外
+    if (row < g->y || row >= g->y + g->h || v1 <= v0)
+    {
+        RLE_Fill(dst, cur->width, bg);
+    }
+    else
+    {
+        // 2. 左右边距补背景色，中间解码当前行组
+        RLE_Fill(dst, v0, bg);
+        RLE_Decode_Group(cur->group, dst + v0, v0 - bx, v1 - bx, fg, bg);
+        RLE_Fill(dst + v1, cur->width - v1, bg);
+    }
+
+    // 3. 本组的行用完后前进到下一组 (窗口外的行也要走过)
+    if (row >= g->y && row < g->y + g->h && --cur->repeat == 0 && row + 1 < g->y + g->h)
+    {
+        cur->group  = RLE_Skip_Group(cur->group, g->w);
+        cur->repeat = *cur->group & RLE_REPEAT_MASK;
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    lcd_glyph_cache.c
+ * @brief   展开后的 RGB565 字模 LRU 缓存实现
+ */
+
+#include "lcd_glyph_cache.h"
+#include <stddef.h>
+#include <string.h>
+
+#define CACHE_POOL_PIXELS (LCD_GLYPH_CACHE_BYTES / 2)
+#define CACHE_MAX_PIXELS  (CACHE_POOL_PIXELS / LCD_GLYPH_CACHE_MAX_SHARE) // 单个字模上限 (同 FITS)
+
+#if LCD_GLYPH_CACHE_BYTES + ST7789_TILE_CCM_BYTES > ST7789_CCM_BYTES
+#error "字模缓存与瓦片层副本之和超过 64K CCM"
+#endif
+
+/**
+ * @brief 缓存条目
+ */
+typedef struct
+{
+    const void* key;      // 键：字模地址
+    uint16_t    fg, bg;   // 键：颜色
+    uint16_t    offset;   // 在像素池中的起始位置 (像素)
+    uint16_t    size;     // 像素数 (w * h)
+    uint32_t    last_use; // 最近使用的时钟值，越小越久未用
+    uint8_t     pinned;   // 本段文字正在使用，不可淘汰
+} Cache_Entry_t;
+
+#if LCD_GLYPH_CACHE_BYTES > 0
+// 像素池放在 CCM (NOLOAD 段，条目表为空时内容无意义，无需清零)
+static uint16_t s_cache_pool[CACHE_POOL_PIXELS] __attribute__((section(".ccm_noinit"), aligned(4)));
+#endif
+
+static Cache_Entry_t           s_cache[LCD_GLYPH_CACHE_ENTRIES]; // 按 offset 升序排列
+static uint8_t                 s_cache_count = 0;
+static uint32_t                s_cache_clock = 0;
+static LCD_Glyph_Cache_Stats_t s_cache_stats = {0};
+
+// ====================================================================
+// 空间管理 (私有函数)
+// ====================================================================
+
+/**
+ * @brief  在相邻条目之间找一段足够大的空隙 (首次适配)
+ * @retval 空隙起始位置 (像素)，-1 表示没有
+ */
+static int32_t Cache_Find_Gap(uint16_t size)
+{
+    uint32_t end = 0; // 上一个条目的末尾
+
+    for (uint8_t i = 0; i < s_cache_count; i++)
+    {
+        if (s_cache[i].offset - end >= size)
+            return (int32_t) end;
+        end = s_cache[i].offset + s_cache[i].size;
+    }
+    return (CACHE_POOL_PIXELS - end >= size) ? (int32_t) end : -1;
+}
+
+/**
+ * @brief  删除第 i 个条目
+ */
+static void Cache_Remove(uint8_t i)
+{
+    s_cache_stats.bytes_used -= (uint32_t) s_cache[i].size * 2;
+    memmove(&s_cache[i], &s_cache[i + 1], (s_cache_count - i - 1) * sizeof(Cache_Entry_t));
+    s_cache_count--;
+}
+
+/**
+ * @brief  淘汰最久未用的未钉住条目
+ * @retval 1: 淘汰了一个  0: 全部被钉住
+ */
+static uint8_t Cache_Evict_LRU(void)
+{
+    int16_t victim = -1;
+
+    for (uint8_t i = 0; i < s_cache_count; i++)
+    {
+        if (!s_cache[i].pinned && (victim < 0 || s_cache[i].last_use < s_cache[victim].last_use))
+            victim = i;
+    }
+    if (victim < 0)
+        return 0;
+
+    Cache_Remove((uint8_t) victim);
+    s_cache_stats.evictions++;
+    return 1;
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+uint16_t* LCD_Glyph_Cache_Get(const void* key,
+                              uint16_t    w,
+                              uint16_t    h,
+                              uint16_t    fg,
+                              uint16_t    bg,
+                              uint8_t*    hit)
+{
+    uint32_t size = (uint32_t) w * h;
+
+    *hit = 0;
+
+#if LCD_GLYPH_CACHE_BYTES > 0
+    // 1. 查找
+    for (uint8_t i = 0; i < s_cache_count; i++)
+    {
+        Cache_Entry_t* e = &s_cache[i];
+        if (e->key == key && e->fg == fg && e->bg == bg && e->size == size)
+        {
+            e->last_use = ++s_cache_clock;
+            e->pinned   = 1;
+            s_cache_stats.hits++;
+            *hit = 1;
+            return &s_cache_pool[e->offset];
+        }
+    }
+
+    // 2. 分配：条目表满或找不到空隙时淘汰最久未用的，直到放得下
+    int32_t offset = -1;
+    if (key && size > 0 && size <= CACHE_MAX_PIXELS)
+    {
+        for (;;)
+        {
+            if (s_cache_count < LCD_GLYPH_CACHE_ENTRIES)
+            {
+                offset = Cache_Find_Gap((uint16_t) size);
+                if (offset >= 0)
+                    break;
+            }
+            if (!Cache_Evict_LRU())
+                break;
+        }
+    }
+
+    if (offset < 0)
+    {
+        s_cache_stats.bypass++;
+        return NULL;
+    }
+
+    // 3. 按 offset 有序插入
+    uint8_t pos = 0;
+    while (pos < s_cache_count && s_cache[pos].offset < offset)
+        pos++;
+    memmove(&s_cache[pos + 1], &s_cache[pos], (s_cache_count - pos) * sizeof(Cache_Entry_t));
+    s_cache_count++;
+
+    Cache_Entry_t* e = &s_cache[pos];
+    e->key           = key;
+    e->fg            = fg;
+    e->bg            = bg;
+    e->offset        = (uint16_t) offset;
+    e->size          = (uint16_t) size;
+    e->last_use      = ++s_cache_clock;
+    e->pinned        = 1;
+
+    s_cache_stats.misses++;
+    s_cache_stats.bytes_used += size * 2;
+    return &s_cache_pool[offset];
+#else
+    (void) key;
+    (void) size;
+    (void) fg;
+    (void) bg;
+    s_cache_stats.bypass++;
+    return NULL;
+#endif
+}
+
+void LCD_Glyph_Cache_Release(void)
+{
+    for (uint8_t i = 0; i < s_cache_count; i++)
+    {
+        s_cache[i].pinned = 0;
+    }
+}
+
+void LCD_Glyph_Cache_Clear(void)
+{
+    s_cache_count            = 0;
+    s_cache_stats.bytes_used = 0;
+}
+
+void LCD_Glyph_Cache_Get_Stats(LCD_Glyph_Cache_Stats_t* stats)
+{
+    if (!stats)
+        return;
+
+    *stats         = s_cache_stats;
+    stats->entries = s_cache_count;
+}
+
+void LCD_Glyph_Cache_Reset_Stats(void)
+{
+    s_cache_stats.hits      = 0;
+    s_cache_stats.misses    = 0;
+    s_cache_stats.evictions = 0;
+    s_cache_stats.bypass    = 0;
+}
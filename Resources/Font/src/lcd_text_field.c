@@ -0,0 +1,216 @@
+/**
+ * @file    lcd_text_field.c
+ * @brief   按字差分重绘的单行文本框实现
+ */
+
+#include "lcd_text_field.h"
+#include "lcd_font.h"
+#include "st7789.h"
+#include <string.h>
+
+/**
+ * @brief 一次更新中解析出的新字符串布局
+ */
+typedef struct
+{
+    uint8_t  offset[LCD_TEXT_FIELD_MAX_GLYPHS + 1];
+    uint16_t pos[LCD_TEXT_FIELD_MAX_GLYPHS + 1];
+    uint8_t  count;
+} Field_Layout_t;
+
+// ====================================================================
+// 私有函数
+// ====================================================================
+
+/**
+ * @brief  UTF-8 字符的字节数 (私有)
+ * @note   与字体引擎一致：非法或截断的序列按 1 字节处理
+ */
+static uint8_t Field_Char_Len(const char* str)
+{
+    const uint8_t* s = (const uint8_t*) str;
+    uint8_t        len;
+
+    if (s[0] < 0x80)
+        return 1;
+    if ((s[0] & 0xE0) == 0xC0)
+        len = 2;
+    else if ((s[0] & 0xF0) == 0xE0)
+        len = 3;
+    else if ((s[0] & 0xF8) == 0xF0)
+        len = 4;
+    else
+        return 1;
+
+    for (uint8_t i = 1; i < len; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+            return 1;
+    }
+    return len;
+}
+
+/**
+ * @brief  测量 str 前 len 个字节 (私有)
+ */
+static void Field_Measure(const font_info_t* font,
+                          const char*        str,
+                          uint8_t            len,
+                          uint16_t*          w,
+                          uint16_t*          h)
+{
+    char buf[LCD_TEXT_FIELD_MAX_BYTES];
+
+    memcpy(buf, str, len);
+    buf[len] = '\0';
+    LCD_Measure_String(buf, font, w, h);
+}
+
+/**
+ * @brief  逐字解析新字符串的字节偏移与 x 位置 (私有)
+ * @retval 1: 成功  0: 超出容量或含换行，只能整串重画
+ */
+static uint8_t Field_Layout(const font_info_t* font, const char* text, Field_Layout_t* lay)
+{
+    uint8_t  i = 0;
+    uint16_t x = 0;
+
+    lay->count = 0;
+    while (text[i])
+    {
+        if (text[i] == '\n' || lay->count == LCD_TEXT_FIELD_MAX_GLYPHS)
+            return 0;
+
+        uint8_t  len = Field_Char_Len(&text[i]);
+        uint16_t w;
+
+        Field_Measure(font, &text[i], len, &w, NULL);
+        lay->offset[lay->count] = i;
+        lay->pos[lay->count]    = x;
+        lay->count++;
+
+        x += w;
+        i += len;
+    }
+    lay->offset[lay->count] = i;
+    lay->pos[lay->count]    = x;
+    return 1;
+}
+
+/**
+ * @brief  绘制 text 中字节区间 [from, to) 的一段字 (私有)
+ * @note   LCD_Show_String 把一段字底部对齐到段内最高的字，这里按整行行高下移，
+ *         保证与整串绘制时的位置一致
+ */
+static void Field_Draw(const LCD_Text_Field_t* field,
+                       const char*             text,
+                       uint8_t                 from,
+                       uint8_t                 to,
+                       uint16_t                x)
+{
+    char     buf[LCD_TEXT_FIELD_MAX_BYTES];
+    uint16_t h;
+
+    memcpy(buf, &text[from], to - from);
+    buf[to - from] = '\0';
+    LCD_Measure_String(buf, field->font, NULL, &h);
+    LCD_Show_String(field->x + x, field->y + field->h - h, buf, field->font, field->fg, field->bg);
+}
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+void LCD_Text_Field_Init(LCD_Text_Field_t*  field,
+                         uint16_t           x,
+                         uint16_t           y,
+                         const font_info_t* font,
+                         uint16_t           fg,
+                         uint16_t           bg)
+{
+    memset(field, 0, sizeof(*field));
+    field->x    = x;
+    field->y    = y;
+    field->font = font;
+    field->fg   = fg;
+    field->bg   = bg;
+}
+
+void LCD_Text_Field_Invalidate(LCD_Text_Field_t* field)
+{
+    field->valid = 0;
+}
+
+void LCD_Text_Field_Set(LCD_Text_Field_t* field, const char* text)
+{
+    Field_Layout_t lay;
+    uint16_t       new_w, new_h;
+    uint16_t       old_w = field->pos[field->count];
+    size_t         bytes = strlen(text);
+
+    LCD_Measure_String(text, field->font, &new_w, &new_h);
+
+    // 超出容量或含换行时无法逐字比较，只记住占用的尺寸
+    uint8_t laid = (bytes < LCD_TEXT_FIELD_MAX_BYTES) && Field_Layout(field->font, text, &lay);
+
+    if (!laid || !field->valid || new_h != field->h)
+    {
+        // 1. 整串重画 (行高变化时旧文字可能露在外面，先整块擦掉)
+        if (field->valid && new_h != field->h)
+            TFT_Fill_Rect_DMA(field->x, field->y, old_w, field->h, field->bg);
+        else if (field->valid && old_w > new_w)
+            TFT_Fill_Rect_DMA(field->x + new_w, field->y, old_w - new_w, field->h, field->bg);
+
+        LCD_Show_String(field->x, field->y, text, field->font, field->fg, field->bg);
+        field->h = new_h;
+    }
+    else
+    {
+        // 2. 逐字比较：内容、位置、宽度都相同的字跳过，连续的变化字合并成一段
+        uint8_t run = 0xFF; // 当前变化段的第一个字，0xFF 表示没有
+
+        for (uint8_t i = 0; i <= lay.count; i++)
+        {
+            uint8_t same = 0;
+
+            if (i < lay.count && i < field->count)
+            {
+                uint8_t len     = lay.offset[i + 1] - lay.offset[i];
+                uint8_t old_len = field->offset[i + 1] - field->offset[i];
+
+                same = len == old_len && lay.pos[i] == field->pos[i] &&
+                       lay.pos[i + 1] == field->pos[i + 1] &&
+                       memcmp(&text[lay.offset[i]], &field->text[field->offset[i]], len) == 0;
+            }
+
+            if (i < lay.count && !same && run == 0xFF)
+                run = i;
+
+            if ((same || i == lay.count) && run != 0xFF)
+            {
+                Field_Draw(field, text, lay.offset[run], lay.offset[i], lay.pos[run]);
+                run = 0xFF;
+            }
+        }
+
+        // 3. 旧文字更宽时擦掉多出来的一条
+        if (old_w > new_w)
+            TFT_Fill_Rect_DMA(field->x + new_w, field->y, old_w - new_w, field->h, field->bg);
+    }
+
+    // 4. 保存本次布局；无法逐字记录时按 0 个字、总宽 new_w 保存，下次全部重画
+    if (laid)
+    {
+        memcpy(field->text, text, bytes + 1);
+        memcpy(field->offset, lay.offset, lay.count + 1);
+        memcpy(field->pos, lay.pos, (lay.count + 1) * sizeof(lay.pos[0]));
+        field->count = lay.count;
+    }
+    else
+    {
+        field->text[0]   = '\0';
+        field->offset[0] = 0;
+        field->pos[0]    = new_w;
+        field->count     = 0;
+    }
+    field->valid = 1;
+}
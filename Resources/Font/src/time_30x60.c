@@ -1,4 +1,5 @@
 #include "font_variable.h"
+#include "lcd_glyph_cache.h"
 #include <stdint.h>
 
 const uint8_t ASCII_30x60[] = {
@@ -244,490 +245,6 @@ const uint8_t ASCII_30x60[] = {
     0x00, /*"-",0*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xE0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0F,
-    0x00,
-    0x00,
-    0xF0,
-    0x1F,
-    0x00,
-    0x00,
-    0xF0,
-    0x1F,
-    0x00,
-    0x00,
-    0xF0,
-    0x1F,
-    0x00,
-    0x00,
-    0xF0,
-    0x0F,
-    0x00,
-    0x00,
-    0xE0,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00, /*".",1*/
-    /* (30 X 60 , SimSun-ExtG, 加粗 )*/
-
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x3E,
-    0x00,
-    0x00,
-    0x00,
-    0x1E,
-    0x00,
-    0x00,
-    0x00,
-    0x1F,
-    0x00,
-    0x00,
-    0x00,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x0F,
-    0x00,
-    0x00,
-    0x80,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x07,
-    0x00,
-    0x00,
-    0xC0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x03,
-    0x00,
-    0x00,
-    0xE0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x01,
-    0x00,
-    0x00,
-    0xF0,
-    0x00,
-    0x00,
-    0x00,
-    0xF8,
-    0x00,
-    0x00,
-    0x00,
-    0x78,
-    0x00,
-    0x00,
-    0x00,
-    0x7C,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x3C,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00, /*"/",2*/
-    /* (30 X 60 , SimSun-ExtG, 加粗 )*/
-
     0x00,
     0x00,
     0x00,
@@ -967,7 +484,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"0",3*/
+    0x00, /*"0",1*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -1209,7 +726,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"1",4*/
+    0x00, /*"1",2*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -1451,7 +968,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"2",5*/
+    0x00, /*"2",3*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -1693,7 +1210,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"3",6*/
+    0x00, /*"3",4*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -1935,7 +1452,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"4",7*/
+    0x00, /*"4",5*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -2177,7 +1694,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"5",8*/
+    0x00, /*"5",6*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -2419,7 +1936,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"6",9*/
+    0x00, /*"6",7*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -2661,7 +2178,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"7",10*/
+    0x00, /*"7",8*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -2903,7 +2420,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"8",11*/
+    0x00, /*"8",9*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -3145,7 +2662,7 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*"9",12*/
+    0x00, /*"9",10*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 
     0x00,
@@ -3387,19 +2904,18 @@ const uint8_t ASCII_30x60[] = {
     0x00,
     0x00,
     0x00,
-    0x00, /*":",13*/
+    0x00, /*":",11*/
     /* (30 X 60 , SimSun-ExtG, 加粗 )*/
 };
 
-// 先计算单个字符的大小（字节）
-// (30 + 7) / 8 * 60 = 4 * 60 = 240 字节
-#define CHAR_SIZE_3060 240
-
-// 当前字模数组是连续的，起始字符是 '-' (ASCII 45)
-// 标准算法是减 32 (ASCII 0x20)
-// 所以补偿的偏移量 = (45 - 32) = 13 个字符
-// 这是一个“虚指针”，指向数组前面不存在的内存，但程序加上偏移后刚好指回数组头
-#define ASCII_3060_OFFSET_PTR (ASCII_30x60 - (13 * CHAR_SIZE_3060))
+/**
+ * @brief 字符区间：时钟只用到 '-' (占位) 与 '0'~':'，其余字符不占 Flash
+ * @note  顺序与上面的字模一致，压缩与未压缩两种格式共用
+ */
+static const font_range_t ASCII_30x60_Ranges[] = {
+    {'-', 1, 0},  // "--:--" 占位
+    {'0', 11, 1}, // '0'~'9' 与 ':'
+};
 
 /**
  * @brief 全局 16 点阵字体配置对象实例
@@ -3408,17 +2924,27 @@ font_info_t font_time_30x60 = {
     // --- ASCII 部分 ---
     .ascii_w   = 30,
     .ascii_h   = 60,
-    .ascii_map = (const uint8_t*) ASCII_3060_OFFSET_PTR,
+#if LCD_FONT_AA
+    .ascii_gray = ASCII_30x60_GRAY, // 构建时由上面的位图生成的 4-bpp 灰度字模 (抗锯齿)
+#elif LCD_FONT_RLE
+    .ascii_rle = &ASCII_30x60_RLE, // 构建时由上面的位图压缩生成 (包围盒 + 行程编码)
+#else
+    .ascii_map = ASCII_30x60,
+#endif
+    .ascii_ranges      = ASCII_30x60_Ranges,
+    .ascii_range_count = sizeof(ASCII_30x60_Ranges) / sizeof(ASCII_30x60_Ranges[0]),
 
     // --- 汉字 部分 ---
     .cn_w      = 60,
     .cn_h      = 60,
-    .hzk_table = 0,
-
-    // 这里的 count 最好是用 sizeof 动态算，或者写个宏
+    .hzk_code  = 0,
+    .hzk_glyph = 0,
     .hzk_count = 0,
 
     // --- 寻址参数 ---
-    .hzk_struct_size = 0,
-    .hzk_data_offset = 4, // index 占 2 字节
-    .hzk_data_size   = 0};
\ No newline at end of file
+    .hzk_data_size = 0,
+
+    // --- 渲染选项 ---
+    // 时钟每秒重绘，同样的字同样的颜色；瓦片 8 行时像素池只有 4K，放不下 30x60 的字，不缓存
+    .glyph_cache = LCD_GLYPH_CACHE_FITS(30, 60),
+};
\ No newline at end of file
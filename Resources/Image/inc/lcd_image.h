@@ -14,13 +14,29 @@
 #include <stdint.h>
 
 /* ==================================================================
- * 1. 函数接口声明 (Function Declarations)
+ * 1. 图片格式配置 (Image Format Configuration)
+ * ================================================================== */
+
+/**
+ * @brief 图片数组格式
+ * @note  0: 取模软件导出的大端字节流 (高字节在前)，8 位 SPI 帧发送
+ *        1: 构建时转换的原生 16 位 RGB565 (4 字节对齐)，16 位 SPI 帧发送
+ *        由 CMake 选项 LCD_IMAGE_NATIVE16 统一控制，不要单独修改
+ */
+#ifndef LCD_IMAGE_NATIVE16
+#define LCD_IMAGE_NATIVE16 0
+#endif
+
+/* ==================================================================
+ * 2. 函数接口声明 (Function Declarations)
  * ================================================================== */
 
 /**
  * @brief  在指定位置显示图片
  * @note   将图片数据渲染到 LCD 指定区域，支持透明通道和边界裁剪。
  *         图片数据格式: 按行优先的字节数组 (RGB565)，上层需确保数据对齐。
+ *         通过 DMA 异步发送，入队后立即返回；pData 在发送完成前必须有效
+ *         (Flash 中的 const 数组天然满足，RAM 缓冲需先调用 ST7789_Flush)。
  * @param  x:      起始 X 坐标 (像素)
  * @param  y:      起始 Y 坐标 (像素)
  * @param  w:      图片宽度 (像素)
@@ -30,4 +46,31 @@
  */
 void LCD_Show_Image(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const unsigned char* pData);
 
+/**
+ * @brief 扫描线解码回调类型
+ * @note  每次生成一行原生 16 位 RGB565 像素 (调色板、解压等格式在这里展开)
+ * @param ctx:  用户上下文 (解码器状态)
+ * @param row:  行号 (0 ~ h-1，严格递增)
+ * @param line: 输出缓冲，写满 w 个像素
+ * @param w:    行宽 (像素)
+ */
+typedef void (*LCD_Image_Line_Decoder_t)(void* ctx, uint16_t row, uint16_t* line, uint16_t w);
+
+/**
+ * @brief  逐行解码显示图片
+ * @note   通过乒乓行缓冲管线绘制：解码下一行的同时 DMA 在发送上一行，
+ *         适用于不能直接由 DMA 从 Flash 搬运的格式。
+ * @param  x, y:   起始坐标
+ * @param  w, h:   图片宽高 (像素)，w 不超过 ST7789_PIPE_BUF_PIXELS
+ * @param  decode: 扫描线解码回调
+ * @param  ctx:    传给回调的上下文
+ * @retval None
+ */
+void LCD_Show_Image_Lines(uint16_t                 x,
+                          uint16_t                 y,
+                          uint16_t                 w,
+                          uint16_t                 h,
+                          LCD_Image_Line_Decoder_t decode,
+                          void*                    ctx);
+
 #endif /* __IMAGE_H */
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "lcd_image.h"
 #include "st7789.h"
+#include "st7789_pipe.h"
+#include <stddef.h>
 
 /**
  * @brief 显示图片 (RGB565 数组)
@@ -9,34 +11,30 @@
  */
 void LCD_Show_Image(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const unsigned char* pData)
 {
-    uint32_t size = w * h * 2; // RGB565 每个像素 2 字节
-    uint32_t i;
+    // DMA 直接从 Flash 中的数组取数发往 SPI2 (源地址自增)，不经过 RAM 拷贝。
+    // 超过 NDTR 上限的大图 (如 240x320 开机画面) 由驱动在 TC 中断里分段续传。
+#if LCD_IMAGE_NATIVE16
+    // 原生 16 位格式：半字 DMA + 16 位 SPI 帧，DMA 请求数减半
+    ST7789_Queue_Blit16(x, y, w, h, (const uint16_t*) pData, NULL, NULL);
+#else
+    ST7789_Queue_Blit(x, y, w, h, pData, NULL, NULL);
+#endif
+}
 
-    // 1. 设置显示窗口
-    TFT_SEND_CMD(0x2A);
-    TFT_SEND_DATA(x >> 8);
-    TFT_SEND_DATA(x & 0xFF);
-    TFT_SEND_DATA((x + w - 1) >> 8);
-    TFT_SEND_DATA((x + w - 1) & 0xFF);
-
-    TFT_SEND_CMD(0x2B);
-    TFT_SEND_DATA(y >> 8);
-    TFT_SEND_DATA(y & 0xFF);
-    TFT_SEND_DATA((y + h - 1) >> 8);
-    TFT_SEND_DATA((y + h - 1) & 0xFF);
-
-    // 2. 开始写入内存
-    TFT_SEND_CMD(0x2C);
-
-    LCD_DC_SET();
-    LCD_CS_CLR();
+void LCD_Show_Image_Lines(uint16_t                 x,
+                          uint16_t                 y,
+                          uint16_t                 w,
+                          uint16_t                 h,
+                          LCD_Image_Line_Decoder_t decode,
+                          void*                    ctx)
+{
+    if (decode == NULL || !ST7789_Pipe_Begin(x, y, w, h))
+        return;
 
-    // 3. 循环发送数据 (纯阻塞发送)
-    // 这里的效率其实很低，后面做项目我会教你用 DMA 瞬间发完
-    for (i = 0; i < size; i++)
+    for (uint16_t row = 0; row < h; row++)
     {
-        ST7789_SPI_SendByte(pData[i]);
+        decode(ctx, row, ST7789_Pipe_Line(), w);
     }
 
-    LCD_CS_SET();
-}
\ No newline at end of file
+    ST7789_Pipe_End();
+}
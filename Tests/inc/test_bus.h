@@ -0,0 +1,79 @@
+/**
+ * @file    test_bus.h
+ * @brief   记录型传输层后端 (主机测试用)
+ * @note    不解码像素，只记录命令、窗口参数、CS 区间与每次流传输的长度，
+ *          流传输与仿真后端一样在 poll 中完成，用于快速遍历大量尺寸组合。
+ */
+
+#ifndef __TEST_BUS_H
+#define __TEST_BUS_H
+
+#include "st7789_bus.h"
+#include <stdint.h>
+
+/**
+ * @brief 记录的统计信息 (Test_Bus_Reset 清零)
+ */
+typedef struct
+{
+    uint32_t commands;        ///< 命令字节数
+    uint32_t caset;           ///< CASET (0x2A) 次数
+    uint32_t raset;           ///< RASET (0x2B) 次数
+    uint32_t ramwr;           ///< RAMWR (0x2C) 次数
+    uint32_t begins;          ///< CS 有效次数
+    uint32_t streams;         ///< 流传输段数
+    uint32_t stream_items;    ///< 流传输数据项总数
+    uint32_t max_segment;     ///< 最长的一段
+    uint32_t max_cs_streams;  ///< 一次 CS 有效期内最多的段数
+    uint32_t stream_outside;  ///< CS 无效时启动的流传输 (应为 0)
+} Test_Bus_Stats_t;
+
+/**
+ * @brief 线上的一个字节 (SPI 后端实际发出的字节序列)
+ */
+typedef struct
+{
+    uint8_t dc;   ///< 0 = 命令，1 = 数据
+    uint8_t byte; ///< 字节值
+} Test_Bus_Wire_t;
+
+/**
+ * @brief 记录型后端函数表
+ */
+extern const ST7789_Bus_t g_test_bus;
+
+/**
+ * @brief  统计清零 (窗口状态保留)
+ * @retval None
+ */
+void Test_Bus_Reset(void);
+
+/**
+ * @brief  读取统计信息
+ * @param  stats: 输出
+ * @retval None
+ */
+void Test_Bus_Get_Stats(Test_Bus_Stats_t* stats);
+
+/**
+ * @brief  读取最近一次 CASET/RASET 设定的窗口 (屏幕上实际生效的窗口)
+ * @retval None
+ */
+void Test_Bus_Window(uint16_t* xs, uint16_t* ys, uint16_t* xe, uint16_t* ye);
+
+/**
+ * @brief  开始 / 停止记录线上字节
+ * @note   按 SPI 后端的发送方式展开：像素高字节在前，流传输逐项展开
+ * @param  buf: 记录缓冲，NULL 停止记录
+ * @param  capacity: 缓冲条数 (超出部分只计数)
+ * @retval None
+ */
+void Test_Bus_Wire_Log(Test_Bus_Wire_t* buf, uint32_t capacity);
+
+/**
+ * @brief  读取已记录的线上字节数 (含超出缓冲的部分)
+ * @retval 字节数
+ */
+uint32_t Test_Bus_Wire_Count(void);
+
+#endif /* __TEST_BUS_H */
@@ -0,0 +1,60 @@
+/**
+ * @file    test_simd_emu.h
+ * @brief   Cortex-M4 SIMD 指令的 C 模拟 (主机测试用)
+ * @note    以 -include 强制包含进 test_pix_simd 目标，配合 ST7789_PIX_SIMD=1 让 st7789_pix.c
+ *          在主机上编译目标板的 SIMD 路径。语义按 ARMv7-M 手册：UADD8 逐字节相加并按进位
+ *          置位 APSR.GE[3:0]，SEL 按 GE 逐字节选取第一个操作数。
+ */
+
+#ifndef __TEST_SIMD_EMU_H
+#define __TEST_SIMD_EMU_H
+
+#include <stdint.h>
+
+/**
+ * @brief  APSR.GE[3:0] (私有)
+ */
+static inline uint32_t* Test_Simd_GE(void)
+{
+    static uint32_t ge = 0;
+    return &ge;
+}
+
+static inline uint32_t __UADD8(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0, ge = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint32_t sum = ((a >> (8 * i)) & 0xFF) + ((b >> (8 * i)) & 0xFF);
+        if (sum > 0xFF)
+            ge |= 1u << i;
+        r |= (sum & 0xFF) << (8 * i);
+    }
+    *Test_Simd_GE() = ge;
+    return r;
+}
+
+static inline uint32_t __SEL(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint32_t m = 0xFFu << (8 * i);
+        r |= ((*Test_Simd_GE() >> i) & 1) ? (a & m) : (b & m);
+    }
+    return r;
+}
+
+static inline uint32_t __REV16(uint32_t v)
+{
+    return ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+}
+
+static inline uint32_t __PKHBT(uint32_t a, uint32_t b, uint32_t shift)
+{
+    return (a & 0x0000FFFF) | ((b << shift) & 0xFFFF0000);
+}
+
+#endif /* __TEST_SIMD_EMU_H */
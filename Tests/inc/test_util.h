@@ -0,0 +1,81 @@
+/**
+ * @file    test_util.h
+ * @brief   主机测试公共工具：断言计数、基准图比对、可控时钟
+ * @note    测试程序返回 Test_Summary() 的结果，ctest 以退出码判断通过与否。
+ */
+
+#ifndef __TEST_UTIL_H
+#define __TEST_UTIL_H
+
+#include <stdint.h>
+
+/* ==================================================================
+ * 1. 断言 (Checks)
+ * ================================================================== */
+
+/**
+ * @brief 条件检查：失败时打印表达式与位置，测试继续执行
+ */
+#define TEST_CHECK(cond) Test_Check((cond) != 0, #cond, __FILE__, __LINE__)
+
+/**
+ * @brief 相等检查：失败时同时打印两边的值
+ */
+#define TEST_CHECK_EQ(a, b)                                                                        \
+    Test_Check_Eq((long long) (a), (long long) (b), #a, #b, __FILE__, __LINE__)
+
+/**
+ * @brief  记录一次检查结果 (请使用 TEST_CHECK)
+ * @retval ok
+ */
+int Test_Check(int ok, const char* expr, const char* file, int line);
+
+/**
+ * @brief  记录一次相等检查结果 (请使用 TEST_CHECK_EQ)
+ * @retval 1: 相等，0: 不等
+ */
+int Test_Check_Eq(
+    long long a, long long b, const char* ea, const char* eb, const char* file, int line);
+
+/**
+ * @brief  打印检查总数与失败数
+ * @param  name: 测试名
+ * @retval 进程退出码 (0 = 全部通过)
+ */
+int Test_Summary(const char* name);
+
+/* ==================================================================
+ * 2. 基准图比对 (Golden Images)
+ * ================================================================== */
+
+#ifdef ST7789_BUS_EMU
+/**
+ * @brief  把仿真显存导出为 TEST_OUTPUT_DIR/<name>.ppm，并与 TEST_GOLDEN_DIR/<name>.ppm 比对
+ * @note   环境变量 UPDATE_GOLDEN=1 时改为用本次输出覆盖基准图
+ * @param  name: 图片名 (不含扩展名)
+ * @retval 1: 一致 (或已更新)，0: 不一致 / 读写失败 (计入失败数)
+ */
+int Test_Golden_PPM(const char* name);
+#endif
+
+/* ==================================================================
+ * 3. 可控时钟 (Controllable Tick)
+ * ================================================================== */
+
+/**
+ * @brief  冻结 / 恢复毫秒时钟
+ * @note   默认每次读取 BSP_GetTick_ms() 自增 1ms，保证驱动中的延时等待能结束；
+ *         冻结后只有 Test_Tick_Advance() 会推进时间，用于测试超时逻辑
+ * @param  freeze: 1 = 冻结，0 = 恢复自增
+ * @retval None
+ */
+void Test_Tick_Freeze(uint8_t freeze);
+
+/**
+ * @brief  推进毫秒时钟
+ * @param  ms: 推进的毫秒数
+ * @retval None
+ */
+void Test_Tick_Advance(uint32_t ms);
+
+#endif /* __TEST_UTIL_H */
@@ -0,0 +1,44 @@
+/**
+ * @file    host_stub.c
+ * @brief   主机测试用的 SysTick 延时替身 (BSP_Tick_Delay.h)
+ */
+
+#include "BSP_Tick_Delay.h"
+#include "test_util.h"
+
+static uint64_t s_tick_ms     = 0; // 当前毫秒数
+static uint8_t  s_tick_frozen = 0; // 1 = 只由 Test_Tick_Advance 推进
+
+void BSP_SysTick_Init(void)
+{
+}
+
+uint64_t BSP_GetTick_ms(void)
+{
+    return s_tick_frozen ? s_tick_ms : s_tick_ms++;
+}
+
+uint64_t BSP_GetTick_us(void)
+{
+    return BSP_GetTick_ms() * 1000;
+}
+
+void BSP_Delay_ms(uint32_t ms)
+{
+    s_tick_ms += ms;
+}
+
+void BSP_Delay_us(uint32_t us)
+{
+    s_tick_ms += us / 1000;
+}
+
+void Test_Tick_Freeze(uint8_t freeze)
+{
+    s_tick_frozen = freeze;
+}
+
+void Test_Tick_Advance(uint32_t ms)
+{
+    s_tick_ms += ms;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file    test_bus.c
+ * @brief   记录型传输层后端实现
+ */
+
+#include "test_bus.h"
+#include <string.h>
+
+static Test_Bus_Stats_t s_bus_stats;
+
+static uint8_t  s_bus_cmd     = 0;   // 当前命令
+static uint8_t  s_bus_args[4] = {0}; // CASET/RASET 参数
+static uint8_t  s_bus_argc    = 0;
+static uint16_t s_bus_win[4]  = {0}; // xs, xe, ys, ye
+static uint8_t  s_bus_cs      = 0;   // CS 当前是否有效
+static uint32_t s_bus_cs_segs = 0;   // 本次 CS 有效期内的段数
+
+static volatile uint8_t s_bus_pending = 0; // 流传输已 "完成"，等待 poll 通知驱动
+
+static Test_Bus_Wire_t* s_bus_wire     = NULL; // 线上字节记录 (NULL = 不记录)
+static uint32_t         s_bus_wire_cap = 0;
+static uint32_t         s_bus_wire_n   = 0;
+
+/**
+ * @brief  记录一个线上字节 (私有)
+ */
+static inline void Test_Bus_Wire(uint8_t dc, uint8_t byte)
+{
+    if (!s_bus_wire)
+        return;
+    if (s_bus_wire_n < s_bus_wire_cap)
+    {
+        s_bus_wire[s_bus_wire_n].dc   = dc;
+        s_bus_wire[s_bus_wire_n].byte = byte;
+    }
+    s_bus_wire_n++;
+}
+
+// ====================================================================
+// 传输层函数表实现
+// ====================================================================
+static void Test_Bus_Init(void)
+{
+    memset(&s_bus_stats, 0, sizeof(s_bus_stats));
+    s_bus_cs      = 0;
+    s_bus_pending = 0;
+}
+
+static void Test_Bus_Reset_Pin(uint8_t level)
+{
+}
+
+static void Test_Bus_Begin(void)
+{
+    s_bus_stats.begins++;
+    s_bus_cs      = 1;
+    s_bus_cs_segs = 0;
+}
+
+static void Test_Bus_End(void)
+{
+    s_bus_cs = 0;
+}
+
+static void Test_Bus_Write_Cmd(uint8_t cmd)
+{
+    Test_Bus_Wire(0, cmd);
+
+    s_bus_stats.commands++;
+    s_bus_cmd  = cmd;
+    s_bus_argc = 0;
+
+    if (cmd == 0x2A)
+        s_bus_stats.caset++;
+    else if (cmd == 0x2B)
+        s_bus_stats.raset++;
+    else if (cmd == 0x2C)
+        s_bus_stats.ramwr++;
+}
+
+static void Test_Bus_Write_Bytes(const uint8_t* data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+        Test_Bus_Wire(1, data[i]);
+
+    if (s_bus_cmd != 0x2A && s_bus_cmd != 0x2B)
+        return;
+
+    while (len-- && s_bus_argc < 4)
+    {
+        s_bus_args[s_bus_argc++] = *data++;
+    }
+    if (s_bus_argc == 4)
+    {
+        uint16_t* win = &s_bus_win[s_bus_cmd == 0x2A ? 0 : 2];
+        win[0]        = (uint16_t) ((s_bus_args[0] << 8) | s_bus_args[1]);
+        win[1]        = (uint16_t) ((s_bus_args[2] << 8) | s_bus_args[3]);
+    }
+}
+
+static void Test_Bus_Write_Repeat(uint16_t pixel, uint32_t count)
+{
+    while (s_bus_wire && count--)
+    {
+        Test_Bus_Wire(1, pixel >> 8);
+        Test_Bus_Wire(1, pixel & 0xFF);
+    }
+}
+
+static void Test_Bus_Set_16bit(uint8_t enable)
+{
+}
+
+static void Test_Bus_Stream(const void* src, uint16_t count, uint8_t halfword, uint8_t mem_inc)
+{
+    if (s_bus_wire && halfword)
+    {
+        const uint16_t* p = (const uint16_t*) src;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            Test_Bus_Wire(1, p[mem_inc ? i : 0] >> 8);
+            Test_Bus_Wire(1, p[mem_inc ? i : 0] & 0xFF);
+        }
+    }
+    else if (s_bus_wire)
+    {
+        const uint8_t* p = (const uint8_t*) src;
+        for (uint16_t i = 0; i < count; i++)
+            Test_Bus_Wire(1, p[mem_inc ? i : 0]);
+    }
+
+    s_bus_stats.streams++;
+    s_bus_stats.stream_items += count;
+    if (count > s_bus_stats.max_segment)
+        s_bus_stats.max_segment = count;
+
+    if (!s_bus_cs)
+        s_bus_stats.stream_outside++;
+    if (++s_bus_cs_segs > s_bus_stats.max_cs_streams)
+        s_bus_stats.max_cs_streams = s_bus_cs_segs;
+
+    s_bus_pending = 1;
+}
+
+static void Test_Bus_Lock(void)
+{
+}
+
+static void Test_Bus_Unlock(void)
+{
+}
+
+static void Test_Bus_Poll(void)
+{
+    if (!s_bus_pending)
+        return;
+
+    s_bus_pending = 0;
+    ST7789_Bus_Stream_Done();
+}
+
+const ST7789_Bus_t g_test_bus = {
+    .name         = "test",
+    .init         = Test_Bus_Init,
+    .reset        = Test_Bus_Reset_Pin,
+    .begin        = Test_Bus_Begin,
+    .end          = Test_Bus_End,
+    .write_cmd    = Test_Bus_Write_Cmd,
+    .write_bytes  = Test_Bus_Write_Bytes,
+    .write_repeat = Test_Bus_Write_Repeat,
+    .set_16bit    = Test_Bus_Set_16bit,
+    .stream       = Test_Bus_Stream,
+    .lock         = Test_Bus_Lock,
+    .unlock       = Test_Bus_Unlock,
+    .poll         = Test_Bus_Poll,
+};
+
+// ====================================================================
+// 查询接口
+// ====================================================================
+void Test_Bus_Reset(void)
+{
+    memset(&s_bus_stats, 0, sizeof(s_bus_stats));
+}
+
+void Test_Bus_Get_Stats(Test_Bus_Stats_t* stats)
+{
+    *stats = s_bus_stats;
+}
+
+void Test_Bus_Window(uint16_t* xs, uint16_t* ys, uint16_t* xe, uint16_t* ye)
+{
+    *xs = s_bus_win[0];
+    *xe = s_bus_win[1];
+    *ys = s_bus_win[2];
+    *ye = s_bus_win[3];
+}
+
+void Test_Bus_Wire_Log(Test_Bus_Wire_t* buf, uint32_t capacity)
+{
+    s_bus_wire     = buf;
+    s_bus_wire_cap = capacity;
+    s_bus_wire_n   = 0;
+}
+
+uint32_t Test_Bus_Wire_Count(void)
+{
+    return s_bus_wire_n;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file    test_dma_segment.c
+ * @brief   DMA 分段填充测试：NDTR 切段算法与每种填充尺寸的总线行为
+ * @note    遍历 1x1 ~ 240x320 的每一种 w x h，经记录型后端检查：
+ *          各段之和等于 w*h、每段不超过 65535、所有段在同一次 CS 有效期内发出、
+ *          每次填充最多一条 CASET 与一条 RASET，且生效的窗口正好是填充区域。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_bus.h"
+#include "test_util.h"
+
+/**
+ * @brief  切段算法本身：任意长度都能无遗漏地拆成合法的段
+ */
+static void Test_Segment_Math(void)
+{
+    uint32_t bad = 0;
+
+    for (uint32_t n = 1; n <= (uint32_t) TFT_COLUMN_NUMBER * TFT_LINE_NUMBER; n++)
+    {
+        uint32_t remaining = n;
+        uint32_t segments  = 0;
+
+        while (remaining > 0)
+        {
+            uint16_t seg = ST7789_DMA_Segment(remaining);
+            if (seg == 0 || seg > ST7789_DMA_MAX_NDTR)
+                break;
+            remaining -= seg;
+            segments++;
+        }
+
+        if (remaining != 0 || segments != (n + ST7789_DMA_MAX_NDTR - 1) / ST7789_DMA_MAX_NDTR)
+            bad++;
+    }
+
+    TEST_CHECK_EQ(bad, 0);
+    TEST_CHECK_EQ(ST7789_DMA_Segment(76800), 65535);
+    TEST_CHECK_EQ(ST7789_DMA_Segment(76800 - 65535), 11265);
+}
+
+/**
+ * @brief  一次队列填充的总线行为
+ */
+static void Check_Fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    Test_Bus_Stats_t st;
+    uint16_t         xs, ys, xe, ye;
+    uint32_t         n = (uint32_t) w * h;
+
+    Test_Bus_Reset();
+    ST7789_Queue_Fill(x, y, w, h, 0x1234);
+    ST7789_Flush();
+    Test_Bus_Get_Stats(&st);
+    Test_Bus_Window(&xs, &ys, &xe, &ye);
+
+    TEST_CHECK_EQ(st.stream_items, n);
+    TEST_CHECK(st.max_segment <= ST7789_DMA_MAX_NDTR);
+    TEST_CHECK_EQ(st.streams, (n + ST7789_DMA_MAX_NDTR - 1) / ST7789_DMA_MAX_NDTR);
+    TEST_CHECK_EQ(st.max_cs_streams, st.streams);
+    TEST_CHECK_EQ(st.stream_outside, 0);
+
+    TEST_CHECK_EQ(st.ramwr, 1);
+    TEST_CHECK(st.caset <= 1 && st.raset <= 1);
+    TEST_CHECK(xs == x && xe == x + w - 1 && ys == y && ye == y + h - 1);
+}
+
+/**
+ * @brief  每一种尺寸都靠在右下角 (避开瓦片区的整块捕获)，相邻尺寸共用 CASET 或 RASET
+ */
+static void Test_Every_Fill_Size(void)
+{
+    for (uint16_t w = 1; w <= TFT_COLUMN_NUMBER; w++)
+    {
+        for (uint16_t h = 1; h <= TFT_LINE_NUMBER; h++)
+        {
+            Check_Fill(TFT_COLUMN_NUMBER - w, TFT_LINE_NUMBER - h, w, h);
+        }
+    }
+}
+
+/**
+ * @brief  整屏填充：76800 像素 = 65535 + 11265 两段，CS 不断开
+ */
+static void Test_Full_Screen(void)
+{
+    Test_Bus_Stats_t st;
+
+    Test_Bus_Reset();
+    TFT_full_DMA(0xFFFF);
+    ST7789_Flush();
+    Test_Bus_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.streams, 2);
+    TEST_CHECK_EQ(st.max_segment, 65535);
+    TEST_CHECK_EQ(st.stream_items, 76800);
+    TEST_CHECK_EQ(st.max_cs_streams, 2);
+}
+
+int main(void)
+{
+    ST7789_Bus_Select(&g_test_bus);
+    ST7789_Init();
+
+    Test_Segment_Math();
+    Test_Full_Screen();
+    Test_Every_Fill_Size();
+
+    return Test_Summary("test_dma_segment");
+}
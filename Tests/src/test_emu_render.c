@@ -0,0 +1,150 @@
+/**
+ * @file    test_emu_render.c
+ * @brief   仿真后端回归测试：真实驱动 + 渲染层经 g_st7789_bus_emu 上屏
+ * @note    检查初始化命令数、阻塞/队列填充的像素与线上开销、瓦片合成，
+ *          最后把整屏结果与 golden/emu_render.ppm 比对。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "lcd_image.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_tile.h"
+#include "test_util.h"
+
+extern const unsigned char gImage_WIFI[];
+
+#define INIT_SCRIPT_COMMANDS 16 // s_st7789_init_script 中的命令条数
+
+/**
+ * @brief  读取仿真显存中的一个像素
+ */
+static uint16_t Pixel(uint16_t x, uint16_t y)
+{
+    return ST7789_Emu_Framebuffer()[y * TFT_COLUMN_NUMBER + x];
+}
+
+/**
+ * @brief  检查矩形区域是否全部为指定颜色
+ */
+static int Rect_Is(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    for (uint16_t r = 0; r < h; r++)
+        for (uint16_t c = 0; c < w; c++)
+            if (Pixel(x + c, y + r) != color)
+                return 0;
+    return 1;
+}
+
+static void Test_Init(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    ST7789_Init();
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.commands, INIT_SCRIPT_COMMANDS);
+    TEST_CHECK_EQ(st.pixels, 0);
+    TEST_CHECK_EQ(st.streams, 0);
+    TEST_CHECK(st.cs_toggles >= INIT_SCRIPT_COMMANDS);
+}
+
+static void Test_Blocking_Fill(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 瓦片区之外：直接上屏，CASET + RASET + RAMWR 三条命令
+    ST7789_Emu_Reset_Stats();
+    TFT_Fill_Rect(10, 200, 50, 40, RED);
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.commands, 3);
+    TEST_CHECK_EQ(st.pixels, 50 * 40);
+    TEST_CHECK_EQ(st.bytes, 3 + 8 + 50 * 40 * 2);
+    TEST_CHECK(Rect_Is(10, 200, 50, 40, RED));
+    TEST_CHECK_EQ(Pixel(9, 200), 0);
+    TEST_CHECK_EQ(Pixel(60, 239), 0);
+
+    // 同一窗口再画一次：窗口缓存省掉 CASET/RASET，只剩 RAMWR
+    ST7789_Emu_Reset_Stats();
+    TFT_Fill_Rect(10, 200, 50, 40, BLUE);
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.commands, 1);
+    TEST_CHECK(Rect_Is(10, 200, 50, 40, BLUE));
+
+    // 越过右下角：裁剪到屏幕边界
+    ST7789_Emu_Reset_Stats();
+    TFT_Fill_Rect(230, 310, 50, 50, GREEN);
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.pixels, 10 * 10);
+    TEST_CHECK(Rect_Is(230, 310, 10, 10, GREEN));
+}
+
+static void Test_Queued_Fill(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    ST7789_Emu_Reset_Stats();
+    ST7789_Queue_Fill(100, 200, 100, 100, YELLOW);
+    ST7789_Flush();
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.pixels, 100 * 100);
+    TEST_CHECK(st.streams >= 1);
+    TEST_CHECK(Rect_Is(100, 200, 100, 100, YELLOW));
+    TEST_CHECK(!ST7789_Is_Busy());
+}
+
+static void Test_Tile_Compose(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 瓦片区内的两次重叠绘制：先只写瓦片，Flush 时一次上屏
+    ST7789_Emu_Reset_Stats();
+    TFT_Fill_Rect(0, 0, 240, 32, GRAY);
+    TFT_Fill_Rect(8, 8, 16, 16, WHITE);
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.pixels, 0);
+    TEST_CHECK(ST7789_Tile_Is_Dirty());
+
+    ST7789_Tile_Flush();
+    ST7789_Flush();
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.pixels, 240 * 32);
+    TEST_CHECK(!ST7789_Tile_Is_Dirty());
+    TEST_CHECK(Rect_Is(8, 8, 16, 16, WHITE));
+    TEST_CHECK_EQ(Pixel(0, 0), GRAY);
+    TEST_CHECK_EQ(Pixel(239, 31), GRAY);
+}
+
+static void Test_Text_And_Image(void)
+{
+    LCD_Show_String(20, 40, "12:34", &font_time_30x60, WHITE, BLACK);
+    LCD_Show_String(10, 140, "Hello ST7789", &font_16, WHITE, BLACK);
+    LCD_Show_String(10, 160, "2025-12-07", &font_ascii_16x32, CYAN, BLACK);
+    LCD_Show_Image(200, 3, 25, 25, gImage_WIFI);
+
+    ST7789_Tile_Flush();
+    ST7789_Flush();
+
+    TEST_CHECK(!ST7789_Is_Busy());
+    TEST_CHECK(!Rect_Is(20, 40, 150, 60, BLACK)); // 时钟数字确实画出来了
+}
+
+int main(void)
+{
+    Test_Init();
+    Test_Blocking_Fill();
+    Test_Queued_Fill();
+    Test_Tile_Compose();
+    Test_Text_And_Image();
+
+    Test_Golden_PPM("emu_render");
+
+    return Test_Summary("test_emu_render");
+}
@@ -0,0 +1,308 @@
+/**
+ * @file    test_fb8.c
+ * @brief   8 位调色板影子帧缓冲测试：调色板用完后的就近取色、逐行脏列范围、上屏结果
+ * @note    同一程序编译两次：test_fb8_direct 不开影子缓冲，把一幅场景直接画上屏并导出
+ *          fb8_scene_direct.ppm；test_fb8 定义 ST7789_FB8_ENABLE=1，同一场景先写进影子缓冲，
+ *          由 ST7789_FB8_Flush 上屏后与直接绘制的结果逐像素比对 (ctest 夹具保证先后顺序)。
+ *          脏列范围的检查先在仿真显存上写一层标记色 (模拟面板上原有的内容)，
+ *          上屏后只有每行 [x0, x1] (相邻脏行取并集) 内的像素被改写。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_fb8.h"
+#include "st7789_gfx.h"
+#include "st7789_tile.h"
+#include "test_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCENE_DIRECT TEST_OUTPUT_DIR "/fb8_scene_direct.ppm"
+#define SCENE_FB8    TEST_OUTPUT_DIR "/fb8_scene.ppm"
+
+#define POISON 0xF81F // 标记色 (场景中没有用到)
+
+static uint8_t  s_blit8[16 * 16 * 2]; // 字节流图片 (高字节在前)
+static uint16_t s_blit16[24 * 12];    // 原生 16 位图片
+
+/**
+ * @brief  上屏一帧 (与 APP_UI_Flush 相同：影子缓冲、瓦片层依次上屏)
+ */
+static void Flush_Frame(void)
+{
+    ST7789_Frame_Begin();
+    ST7789_FB8_Flush();
+    ST7789_Tile_Flush();
+    ST7789_Frame_End();
+    ST7789_Flush();
+}
+
+/**
+ * @brief  测试场景：底色、渐变、图形、三种字体的文字、两种格式的图片，含重复覆盖
+ * @note   颜色总数远小于 256，影子缓冲不会走就近取色，结果应与直接绘制完全一致
+ */
+static void Draw_Scene(void)
+{
+    for (uint16_t i = 0; i < 16 * 16; i++)
+    {
+        uint16_t c = ((i / 16 + i % 16) & 4) ? TFT_RGB(255, 200, 0) : TFT_RGB(0, 80, 160);
+
+        s_blit8[i * 2]     = c >> 8;
+        s_blit8[i * 2 + 1] = c & 0xFF;
+    }
+    for (uint16_t i = 0; i < 24 * 12; i++)
+        s_blit16[i] = (i % 24 < 12) ? TFT_RGB(40, 200, 40) : TFT_RGB(200, 40, 40);
+
+    TFT_Fill_Rect_DMA(0, 0, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER, TFT_RGB(20, 24, 32));
+    TFT_Fill_Gradient_V(0, 0, TFT_COLUMN_NUMBER, 40, TFT_RGB(0, 0, 64), TFT_RGB(0, 0, 255));
+    TFT_Fill_Round_Rect(10, 50, 220, 70, 8, TFT_RGB(60, 60, 60));
+    LCD_Show_String(30, 55, "12:59", &font_time_30x60, WHITE, TFT_RGB(60, 60, 60));
+
+    // 先写一遍再整块覆盖：影子缓冲只发送最终结果
+    LCD_Show_String(20, 130, "88888", &font_time_20, RED, BLACK);
+    TFT_Fill_Rect_DMA(20, 130, 60, 20, TFT_RGB(20, 24, 32));
+    LCD_Show_String(20, 130, "2025-12-07", &font_time_20, TFT_RGB(255, 180, 0), BLACK);
+
+    LCD_Show_String(20, 160, "11:41 Wi-Fi", &font_16_prop, WHITE, TFT_RGB(20, 24, 32));
+    TFT_Fill_Circle(180, 200, 30, TFT_RGB(0, 160, 255));
+    TFT_Draw_Line(10, 300, 230, 250, 3, YELLOW);
+    ST7789_Queue_Blit(20, 200, 16, 16, s_blit8, NULL, NULL);
+    ST7789_Queue_Blit16(50, 210, 24, 12, s_blit16, NULL, NULL);
+}
+
+#if ST7789_FB8_ENABLE
+
+/**
+ * @brief  读取 PPM 文件
+ * @retval 文件内容 (调用者 free)，失败返回 NULL
+ */
+static uint8_t* Read_File(const char* path, long* size)
+{
+    FILE*    f = fopen(path, "rb");
+    uint8_t* buf;
+
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(*size);
+    if (buf && fread(buf, 1, *size, f) != (size_t) *size)
+    {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+/**
+ * @brief  场景经影子缓冲上屏，与直接绘制的结果逐像素比对
+ */
+static void Test_Scene(void)
+{
+    ST7789_Emu_Stats_t st;
+    long               size_a = 0, size_b = 0;
+    uint32_t           diff   = 0;
+
+    ST7789_Emu_Reset_Stats();
+    Draw_Scene();
+
+    // 影子缓冲接管了全部绘制：上屏之前一个像素都没有发送
+    ST7789_Flush();
+    ST7789_Emu_Get_Stats(&st);
+    TEST_CHECK_EQ(st.pixels, 0);
+    TEST_CHECK(ST7789_FB8_Is_Dirty());
+
+    ST7789_Emu_Reset_Stats();
+    Flush_Frame();
+    ST7789_Emu_Get_Stats(&st);
+    TEST_CHECK(!ST7789_FB8_Is_Dirty());
+    TEST_CHECK_EQ(st.pixels, TFT_COLUMN_NUMBER * TFT_LINE_NUMBER); // 整屏都脏，合并为一个窗口
+    TEST_CHECK_EQ(st.windows, 1);
+
+    TEST_CHECK_EQ(ST7789_Emu_Dump_PPM(SCENE_FB8), 0);
+    uint8_t* a = Read_File(SCENE_FB8, &size_a);
+    uint8_t* b = Read_File(SCENE_DIRECT, &size_b);
+
+    TEST_CHECK(a != NULL && b != NULL && size_a == size_b);
+    if (a && b && size_a == size_b)
+    {
+        for (long i = size_a - (long) TFT_COLUMN_NUMBER * TFT_LINE_NUMBER * 3; i < size_a; i += 3)
+            diff += (a[i] != b[i] || a[i + 1] != b[i + 1] || a[i + 2] != b[i + 2]);
+    }
+    printf("  scene: %u pixels differ from the direct draw\n", diff);
+    TEST_CHECK_EQ(diff, 0);
+
+    free(a);
+    free(b);
+}
+
+/**
+ * @brief  仿真显存中 (x, y) 的像素
+ */
+static uint16_t Pixel(uint16_t x, uint16_t y)
+{
+    return ST7789_Emu_Framebuffer()[y * TFT_COLUMN_NUMBER + x];
+}
+
+/**
+ * @brief  一行中 [x0, x1] 为指定颜色，其余仍是标记色
+ * @retval 不符合的像素数
+ */
+static uint32_t Check_Row(uint16_t y, uint16_t x0, uint16_t x1, const uint16_t* expect)
+{
+    uint32_t bad = 0;
+
+    for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+    {
+        if (x < x0 || x > x1)
+            bad += Pixel(x, y) != POISON;
+        else
+            bad += Pixel(x, y) != expect[x];
+    }
+    return bad;
+}
+
+/**
+ * @brief  脏列范围：同一行取并集，相邻脏行合并为一个窗口 (列取并集)，干净的行把窗口隔开
+ */
+static void Test_Dirty_Span(void)
+{
+    ST7789_Emu_Stats_t st;
+    uint16_t*          gram = (uint16_t*) ST7789_Emu_Framebuffer(); // 直接写仿真显存做标记
+    uint16_t           row[TFT_COLUMN_NUMBER];
+
+    // 影子缓冲与屏幕都先清成黑色，再在屏幕上盖一层标记色 (影子缓冲不知道)
+    TFT_Fill_Rect_DMA(0, 190, TFT_COLUMN_NUMBER, 30, BLACK);
+    Flush_Frame();
+    for (uint32_t i = 190 * TFT_COLUMN_NUMBER; i < 220 * TFT_COLUMN_NUMBER; i++)
+        gram[i] = POISON;
+
+    TFT_Fill_Rect_DMA(30, 200, 10, 1, RED);   // 第 200 行：[30, 39]
+    TFT_Fill_Rect_DMA(100, 200, 5, 1, GREEN); //            [100, 104]，并集 [30, 104]
+    TFT_Fill_Rect_DMA(10, 210, 11, 1, BLUE);  // 第 210 行：[10, 20]
+    TFT_Fill_Rect_DMA(50, 211, 11, 1, BLUE);  // 第 211 行：[50, 60]，与上一行合并为 [10, 60]
+    TFT_Fill_Rect_DMA(10, 213, 10, 1, RED);   // 第 213 行 (212 行干净，另开窗口)
+    TFT_Fill_Rect_DMA(0, 213, 30, 1, WHITE);  // 向两边扩展并覆盖，只发送最终结果 [0, 29]
+
+    ST7789_Emu_Reset_Stats();
+    Flush_Frame();
+    ST7789_Emu_Get_Stats(&st);
+
+    TEST_CHECK_EQ(st.windows, 3);
+    TEST_CHECK_EQ(st.pixels, (104 - 30 + 1) + (60 - 10 + 1) * 2 + 30);
+
+    for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+        row[x] = (x < 40) ? RED : (x >= 100 && x <= 104) ? GREEN : BLACK;
+    TEST_CHECK_EQ(Check_Row(200, 30, 104, row), 0);
+
+    for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+        row[x] = (x <= 20) ? BLUE : BLACK;
+    TEST_CHECK_EQ(Check_Row(210, 10, 60, row), 0);
+    for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+        row[x] = (x >= 50 && x <= 60) ? BLUE : BLACK;
+    TEST_CHECK_EQ(Check_Row(211, 10, 60, row), 0);
+
+    for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+        row[x] = WHITE;
+    TEST_CHECK_EQ(Check_Row(213, 0, 29, row), 0);
+
+    // 其余行都没有发送
+    TEST_CHECK_EQ(Check_Row(212, 1, 0, row), 0);
+    TEST_CHECK_EQ(Check_Row(199, 1, 0, row), 0);
+    TEST_CHECK_EQ(Check_Row(214, 1, 0, row), 0);
+
+    // 上屏后脏记录清空：再刷一次什么都不发
+    TEST_CHECK(!ST7789_FB8_Is_Dirty());
+    ST7789_Emu_Reset_Stats();
+    Flush_Frame();
+    ST7789_Emu_Get_Stats(&st);
+    TEST_CHECK_EQ(st.pixels, 0);
+
+    // 最右一列 (x = 239) 与整行
+    TFT_Fill_Rect_DMA(TFT_COLUMN_NUMBER - 1, 215, 1, 1, RED);
+    TFT_Fill_Rect_DMA(0, 217, TFT_COLUMN_NUMBER, 1, RED);
+    ST7789_Emu_Reset_Stats();
+    Flush_Frame();
+    ST7789_Emu_Get_Stats(&st);
+    TEST_CHECK_EQ(st.windows, 2);
+    TEST_CHECK_EQ(st.pixels, 1 + TFT_COLUMN_NUMBER);
+    TEST_CHECK_EQ(Pixel(TFT_COLUMN_NUMBER - 1, 215), RED);
+    TEST_CHECK_EQ(Pixel(TFT_COLUMN_NUMBER - 2, 215), POISON);
+}
+
+/**
+ * @brief  调色板第 i 项的颜色 (i = 0 为黑色)：红 8 级 x 绿 8 级 x 蓝 4 级的网格
+ */
+static uint16_t Grid_Color(uint16_t i)
+{
+    return (uint16_t) ((((i & 7) * 4) << 11) | ((((i >> 3) & 7) * 8) << 5) | ((i >> 6) * 8));
+}
+
+/**
+ * @brief  分量在网格上最接近的级数
+ */
+static uint16_t Grid_Level(uint16_t v, uint16_t step, uint16_t levels)
+{
+    uint16_t k = (v + step / 2) / step;
+    return (k >= levels) ? levels - 1 : k;
+}
+
+/**
+ * @brief  256 项用完后：新颜色取最接近的已有颜色，不占用新项，已有颜色照常命中
+ */
+static void Test_Palette_Full(void)
+{
+    // 不在网格上的颜色 (各分量都不在两级正中间，最近的网格点唯一)
+    static const uint16_t s_probe[][3] = {
+        {1, 3, 2}, {13, 17, 9}, {31, 63, 31}, {5, 45, 14}, {27, 2, 30}, {17, 30, 19},
+    };
+    uint32_t bad = 0;
+
+    ST7789_FB8_Init(); // 清空调色板 (索引 0 = 黑色)
+
+    for (uint16_t i = 0; i < ST7789_FB8_PALETTE_SIZE; i++)
+        bad += ST7789_FB8_Color_Index(Grid_Color(i)) != i;
+    TEST_CHECK_EQ(bad, 0);
+
+    for (uint8_t p = 0; p < sizeof(s_probe) / sizeof(s_probe[0]); p++)
+    {
+        uint16_t r = s_probe[p][0], g = s_probe[p][1], b = s_probe[p][2];
+        uint16_t color = (uint16_t) ((r << 11) | (g << 5) | b);
+        uint16_t expect =
+            Grid_Level(r, 4, 8) | (Grid_Level(g, 8, 8) << 3) | (Grid_Level(b, 8, 4) << 6);
+
+        TEST_CHECK_EQ(ST7789_FB8_Color_Index(color), expect);
+        TEST_CHECK_EQ(ST7789_FB8_Color_Index(Grid_Color(100)), 100); // 已有颜色不受影响
+        TEST_CHECK_EQ(ST7789_FB8_Color_Index(color), expect);        // 没有被写进调色板
+    }
+
+    // 上屏：填充色被替换成最接近的调色板颜色
+    TFT_Fill_Rect_DMA(0, 240, 40, 10, (uint16_t) ((13 << 11) | (17 << 5) | 9));
+    Flush_Frame();
+    TEST_CHECK_EQ(Pixel(0, 240), Grid_Color(3 | (2 << 3) | (1 << 6)));
+    TEST_CHECK_EQ(Pixel(39, 249), Grid_Color(3 | (2 << 3) | (1 << 6)));
+}
+
+#endif /* ST7789_FB8_ENABLE */
+
+int main(void)
+{
+    ST7789_Init();
+
+#if ST7789_FB8_ENABLE
+    Test_Scene();
+    Test_Dirty_Span();
+    Test_Palette_Full();
+    return Test_Summary("test_fb8");
+#else
+    // 直接绘制的参照图，供 test_fb8 比对
+    Draw_Scene();
+    Flush_Frame();
+    TEST_CHECK_EQ(ST7789_Emu_Dump_PPM(SCENE_DIRECT), 0);
+    return Test_Summary("test_fb8_direct");
+#endif
+}
@@ -0,0 +1,478 @@
+/**
+ * @file    test_font_ext.c
+ * @brief   外部字库测试：镜像寻址、RAM 缓存命中率与查找耗时、测量不读 Flash
+ * @note    W25Qxx 由镜像文件代替 (W25QXX_FILE_EMU)。镜像在测试开始时按 font_ext_image.py
+ *          的格式生成：CJK 统一汉字依次占用 GBK 码位，字模为由码位算出的固定图案，
+ *          因此不需要 TTF 也能逐像素核对。
+ *          重放 fixtures/weather_api.txt 中的天气更新，按 APP_UI_UpdateWeather 的字段与字体
+ *          绘制，报告每轮的命中率、Flash 读取量、按 42MHz SPI 估算的读取时间和每字耗时。
+ */
+
+#include "lcd_font.h"
+#include "lcd_font_ext.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "w25qxx.h"
+#include "test_util.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define IMAGE_PATH   TEST_OUTPUT_DIR "/font_ext.bin"
+#define FIXTURE_PATH TEST_FIXTURE_DIR "/weather_api.txt"
+
+#define GBK_LEADS  126 // 0x81 ~ 0xFE
+#define GBK_TRAILS 190 // 0x40 ~ 0xFE 去掉 0x7F
+#define GBK_SLOTS  (GBK_LEADS * GBK_TRAILS)
+
+#define MAP_OFFSET 0x1000
+#define CJK_FIRST  0x4E00
+#define CJK_LAST   0x9FA5
+#define CELSIUS    0x2103 // ℃ 放在最后一个码位
+
+#define SPI_MHZ 42 // W25Qxx 读取时钟 (APB2 84MHz / 2)
+
+#define MAX_RECORDS 64
+#define FIELD_BYTES 32
+
+/**
+ * @brief 天气更新的字段 (顺序同 fixtures/weather_api.txt)
+ */
+typedef enum
+{
+    F_CITY = 0,
+    F_WEA,
+    F_TEM,
+    F_TEM_NIGHT,
+    F_TEM_DAY,
+    F_WIN,
+    F_WIN_SPEED,
+    F_AIR,
+    F_HUMIDITY,
+    F_PRESSURE,
+    F_UPDATE_TIME,
+    F_COUNT
+} Weather_Field_e;
+
+typedef struct
+{
+    char f[F_COUNT][FIELD_BYTES];
+} Weather_Record_t;
+
+static Weather_Record_t s_records[MAX_RECORDS];
+static uint32_t         s_record_count = 0;
+static uint32_t         s_glyphs_drawn = 0; // 本轮绘制的字符数
+
+static const uint8_t s_section_size[2][2] = {{16, 16}, {20, 20}};
+
+// ====================================================================
+// 镜像
+// ====================================================================
+
+/**
+ * @brief  码位序号对应的 GBK 码
+ */
+static uint16_t Slot_To_GBK(uint32_t slot)
+{
+    uint8_t hi = (uint8_t) (0x81 + slot / GBK_TRAILS);
+    uint8_t lo = (uint8_t) (0x40 + slot % GBK_TRAILS);
+    if (lo >= 0x7F)
+        lo++;
+    return (uint16_t) ((hi << 8) | lo);
+}
+
+/**
+ * @brief  码点占用的码位序号，-1 表示镜像中没有
+ */
+static int32_t Code_To_Slot(uint32_t cp)
+{
+    if (cp >= CJK_FIRST && cp <= CJK_LAST)
+        return (int32_t) (cp - CJK_FIRST);
+    if (cp == CELSIUS)
+        return GBK_SLOTS - 1;
+    return -1;
+}
+
+/**
+ * @brief  字模第 k 个字节的图案
+ */
+static uint8_t Pattern_Byte(int32_t slot, uint8_t section, uint32_t k)
+{
+    return (uint8_t) (slot * 131 + k * 29 + section * 7 + 1);
+}
+
+/**
+ * @brief  生成 16 / 20 点阵两个字号的镜像文件
+ */
+static int Build_Image(void)
+{
+    LCD_Font_Ext_Header_t header;
+    FILE*                 f = fopen(IMAGE_PATH, "wb");
+    if (!f)
+        return 0;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "WCFX", 4);
+    header.version       = 1;
+    header.section_count = 2;
+    header.map_offset    = MAP_OFFSET;
+
+    uint32_t offset = MAP_OFFSET + 0x10000 * 2;
+    for (uint8_t s = 0; s < 2; s++)
+    {
+        uint8_t w = s_section_size[s][0], h = s_section_size[s][1];
+
+        header.sections[s].w           = w;
+        header.sections[s].h           = h;
+        header.sections[s].glyph_bytes = (uint16_t) ((w + 7) / 8 * h);
+        header.sections[s].offset      = offset;
+        offset += (uint32_t) GBK_SLOTS * header.sections[s].glyph_bytes;
+    }
+    fwrite(&header, sizeof(header), 1, f);
+
+    // 对照表 (小端)
+    static uint8_t map[0x10000 * 2];
+    for (uint32_t cp = 0; cp < 0x10000; cp++)
+    {
+        int32_t  slot = Code_To_Slot(cp);
+        uint16_t gbk  = slot < 0 ? 0 : Slot_To_GBK((uint32_t) slot);
+        map[cp * 2]     = gbk & 0xFF;
+        map[cp * 2 + 1] = gbk >> 8;
+    }
+    fseek(f, MAP_OFFSET, SEEK_SET);
+    fwrite(map, sizeof(map), 1, f);
+
+    // 字模区
+    for (uint8_t s = 0; s < 2; s++)
+    {
+        uint16_t size = header.sections[s].glyph_bytes;
+        uint8_t  glyph[LCD_FONT_EXT_GLYPH_MAX];
+
+        fseek(f, (long) header.sections[s].offset, SEEK_SET);
+        for (int32_t slot = 0; slot < GBK_SLOTS; slot++)
+        {
+            for (uint16_t k = 0; k < size; k++)
+                glyph[k] = Pattern_Byte(slot, s, k);
+            fwrite(glyph, size, 1, f);
+        }
+    }
+
+    fclose(f);
+    return 1;
+}
+
+// ====================================================================
+// 样例数据
+// ====================================================================
+
+static int Load_Fixture(void)
+{
+    char  line[256];
+    FILE* f = fopen(FIXTURE_PATH, "r");
+    if (!f)
+        return 0;
+
+    while (fgets(line, sizeof(line), f) && s_record_count < MAX_RECORDS)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0')
+            continue;
+
+        Weather_Record_t* r     = &s_records[s_record_count];
+        char*             field = line;
+        uint8_t           n     = 0;
+
+        while (field && n < F_COUNT)
+        {
+            char* tab = strchr(field, '\t');
+            if (tab)
+                *tab = '\0';
+            snprintf(r->f[n++], FIELD_BYTES, "%.*s", FIELD_BYTES - 1, field);
+            field = tab ? tab + 1 : NULL;
+        }
+        if (n == F_COUNT)
+            s_record_count++;
+    }
+
+    fclose(f);
+    return s_record_count > 0;
+}
+
+/**
+ * @brief  UTF-8 字符数 (不含续字节)
+ */
+static uint32_t Char_Count(const char* s)
+{
+    uint32_t n = 0;
+    for (; *s; s++)
+        n += ((*s & 0xC0) != 0x80);
+    return n;
+}
+
+static void Show(uint16_t x, uint16_t y, const char* str, const font_info_t* font)
+{
+    LCD_Show_String(x, y, str, font, BLACK, WHITE);
+    s_glyphs_drawn += Char_Count(str);
+}
+
+/**
+ * @brief  按 APP_UI_UpdateWeather 的字段与字体绘制一次更新
+ */
+static void Draw_Record(const Weather_Record_t* r)
+{
+    char buf[FIELD_BYTES * 2 + 16];
+
+    snprintf(buf, sizeof(buf), "更新时间 %s", r->f[F_UPDATE_TIME]);
+    Show(120, 9, buf, &font_16);
+
+    snprintf(buf, sizeof(buf), "%s℃", r->f[F_TEM]);
+    Show(25, 200, buf, &font_time_20);
+    Show(152, 135, r->f[F_CITY], &font_time_20);
+
+    snprintf(buf, sizeof(buf), "%s~%s℃", r->f[F_TEM_NIGHT], r->f[F_TEM_DAY]);
+    Show(140, 172, "温差", &font_16);
+    Show(177, 172, buf, &font_16);
+
+    snprintf(buf, sizeof(buf), "%s %s", r->f[F_WIN], r->f[F_WIN_SPEED]);
+    Show(140, 202, "风向", &font_16);
+    Show(177, 202, buf, &font_16);
+
+    Show(140, 234, "空气", &font_16);
+    Show(177, 234, r->f[F_AIR], &font_16);
+    Show(140, 262, "湿度", &font_16);
+    Show(177, 262, r->f[F_HUMIDITY], &font_16);
+    Show(140, 292, "气压", &font_16);
+    Show(177, 292, r->f[F_PRESSURE], &font_16);
+
+    ST7789_Flush();
+}
+
+static double Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/**
+ * @brief  三字节 UTF-8 (基本多文种平面的汉字) 的码点
+ */
+static uint32_t Decode_CJK(const char* s)
+{
+    const uint8_t* u = (const uint8_t*) s;
+    return ((u[0] & 0x0F) << 12) | ((u[1] & 0x3F) << 6) | (u[2] & 0x3F);
+}
+
+/**
+ * @brief  字体的片内码点表是否收录该字
+ */
+static int Internal_Has(const font_info_t* font, uint32_t cp)
+{
+    for (uint16_t i = 0; i < font->hzk_count; i++)
+    {
+        if (font->hzk_code[i] == cp)
+            return 1;
+    }
+    return 0;
+}
+
+// ====================================================================
+// 测试
+// ====================================================================
+
+/**
+ * @brief  镜像寻址：取出的字模与写入的图案逐字节相同，镜像外的字缓存为缺字
+ */
+static void Test_Lookup(void)
+{
+    W25Q_Stats_t fs;
+    uint32_t     bad = 0;
+
+    static const uint32_t codes[] = {CJK_FIRST, 0x4E01, 0x5317, 0x96EA, 0x9F98, CJK_LAST, CELSIUS};
+
+    for (uint8_t s = 0; s < 2; s++)
+    {
+        uint8_t  w = s_section_size[s][0], h = s_section_size[s][1];
+        uint16_t size = (uint16_t) ((w + 7) / 8 * h);
+
+        for (uint32_t i = 0; i < sizeof(codes) / sizeof(codes[0]); i++)
+        {
+            const uint8_t* g = LCD_Font_Ext_Get(codes[i], w, h);
+            if (!TEST_CHECK(g != NULL))
+                continue;
+            for (uint16_t k = 0; k < size; k++)
+                bad += g[k] != Pattern_Byte(Code_To_Slot(codes[i]), s, k);
+        }
+        LCD_Font_Ext_Release();
+    }
+    TEST_CHECK_EQ(bad, 0);
+
+    // 镜像中没有的字：第一次读对照表，之后命中缓存的缺字记录
+    W25Q_Reset_Stats();
+    TEST_CHECK(LCD_Font_Ext_Get(0xE000, 16, 16) == NULL);
+    TEST_CHECK(LCD_Font_Ext_Get(0xE000, 16, 16) == NULL);
+    LCD_Font_Ext_Release();
+    W25Q_Get_Stats(&fs);
+    TEST_CHECK_EQ(fs.reads, 1);
+
+    // 镜像中没有的字号
+    TEST_CHECK(LCD_Font_Ext_Get(0x4E00, 24, 24) == NULL);
+}
+
+/**
+ * @brief  经 LCD_Show_String 画出的外部字模逐像素正确
+ */
+static void Test_Render(void)
+{
+    char     str[64] = "";
+    uint32_t n       = 0;
+
+    // 从样例数据里挑出片内没有的字
+    for (uint32_t i = 0; i < s_record_count && n < 12; i++)
+    {
+        const char* p = s_records[i].f[F_CITY];
+        while (*p && n < 12)
+        {
+            char ch[4] = {p[0], p[1], p[2], '\0'};
+            if (!Internal_Has(&font_16, Decode_CJK(ch)) && !strstr(str, ch))
+            {
+                strcat(str, ch);
+                n++;
+            }
+            p += 3;
+        }
+    }
+    TEST_CHECK(n > 0);
+
+    LCD_Show_String(0, 300, str, &font_16, WHITE, BLACK);
+    ST7789_Flush();
+
+    const uint16_t* fb  = ST7789_Emu_Framebuffer();
+    uint32_t        bad = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        int32_t slot = Code_To_Slot(Decode_CJK(str + i * 3));
+
+        for (uint16_t row = 0; row < 16; row++)
+        {
+            for (uint16_t col = 0; col < 16; col++)
+            {
+                uint8_t  byte = Pattern_Byte(slot, 0, row * 2 + col / 8);
+                uint16_t want = (byte >> (col % 8)) & 1 ? WHITE : BLACK;
+                bad += fb[(300 + row) * TFT_COLUMN_NUMBER + i * 16 + col] != want;
+            }
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+}
+
+/**
+ * @brief  测量字符串不读 Flash、不占缓存，宽度与绘制一致
+ */
+static void Test_Measure(void)
+{
+    LCD_Font_Ext_Stats_t st;
+    W25Q_Stats_t         fs;
+    uint16_t             w, h;
+
+    LCD_Font_Ext_Init();
+    LCD_Font_Ext_Reset_Stats();
+    W25Q_Reset_Stats();
+
+    for (uint32_t i = 0; i < s_record_count; i++)
+    {
+        LCD_Measure_String(s_records[i].f[F_CITY], &font_time_20, &w, &h);
+        TEST_CHECK_EQ(w, Char_Count(s_records[i].f[F_CITY]) * 20);
+        TEST_CHECK_EQ(h, 20);
+        LCD_Measure_String(s_records[i].f[F_WIN], &font_16, &w, &h);
+        TEST_CHECK_EQ(w, Char_Count(s_records[i].f[F_WIN]) * 16);
+    }
+
+    LCD_Font_Ext_Get_Stats(&st);
+    W25Q_Get_Stats(&fs);
+    TEST_CHECK_EQ(st.lookups, 0);
+    TEST_CHECK_EQ(fs.reads, 0);
+}
+
+/**
+ * @brief  重放样例数据：报告命中率、Flash 读取量与每字耗时
+ * @note   第 1 轮从空缓存开始，之后各轮缓存里留着上一轮的字；
+ *         最后同一次更新连画两遍，第二遍不应再读 Flash
+ */
+static void Test_Replay(void)
+{
+    LCD_Font_Ext_Stats_t st;
+    W25Q_Stats_t         fs;
+
+    LCD_Font_Ext_Init();
+    for (uint8_t pass = 1; pass <= 3; pass++)
+    {
+        LCD_Font_Ext_Reset_Stats();
+        W25Q_Reset_Stats();
+        s_glyphs_drawn = 0;
+
+        double t0 = Now_us();
+        for (uint32_t i = 0; i < s_record_count; i++)
+            Draw_Record(&s_records[i]);
+        double elapsed = Now_us() - t0;
+
+        LCD_Font_Ext_Get_Stats(&st);
+        W25Q_Get_Stats(&fs);
+
+        // 每次读取另加 4 字节指令与地址，每字节 8 个时钟
+        double spi_us = (fs.reads * 4.0 + fs.bytes) * 8 / SPI_MHZ;
+
+        printf("  pass %u: %u updates, %u glyphs, %u ext lookups, hit %.1f%% "
+               "(%u miss, %u absent, %u evict)\n",
+               pass,
+               s_record_count,
+               s_glyphs_drawn,
+               st.lookups,
+               st.lookups ? 100.0 * st.hits / st.lookups : 0.0,
+               st.misses,
+               st.absent,
+               st.evictions);
+        printf("          flash %u reads / %u bytes = %.0f us SPI @%dMHz (%.2f us per ext lookup), "
+               "host %.2f us per glyph\n",
+               fs.reads,
+               fs.bytes,
+               spi_us,
+               SPI_MHZ,
+               st.lookups ? spi_us / st.lookups : 0.0,
+               s_glyphs_drawn ? elapsed / s_glyphs_drawn : 0.0);
+
+        TEST_CHECK(st.lookups > 0);
+        TEST_CHECK_EQ(st.lookups, st.hits + st.misses + st.bypass);
+        TEST_CHECK_EQ(st.bypass, 0);
+        // 每次未命中读一次对照表，镜像中有的字再读一次字模
+        TEST_CHECK_EQ(fs.reads, st.misses * 2 - st.absent);
+    }
+
+    // 同一次更新重画：全部命中
+    Draw_Record(&s_records[0]);
+    LCD_Font_Ext_Reset_Stats();
+    W25Q_Reset_Stats();
+    Draw_Record(&s_records[0]);
+    LCD_Font_Ext_Get_Stats(&st);
+    W25Q_Get_Stats(&fs);
+    TEST_CHECK_EQ(st.hits, st.lookups);
+    TEST_CHECK_EQ(fs.reads, 0);
+}
+
+int main(void)
+{
+    if (!TEST_CHECK(Build_Image()) || !TEST_CHECK(Load_Fixture()))
+        return Test_Summary("test_font_ext");
+
+    W25Q_File_Set_Path(IMAGE_PATH);
+    TEST_CHECK_EQ(W25Q_Init(), W25Q_OK);
+    TEST_CHECK(LCD_Font_Ext_Init());
+    ST7789_Init();
+
+    Test_Lookup();
+    Test_Render();
+    Test_Measure();
+    Test_Replay();
+
+    return Test_Summary("test_font_ext");
+}
@@ -0,0 +1,371 @@
+/**
+ * @file    test_font_gray.c
+ * @brief   灰度字库测试：混色表、槽位复用与淘汰、半字节展开、灰度字体上屏
+ * @note    time_30x60 / ascii_week_10x20 / hzk_week_20 由 font_gray.py 在构建时生成 4-bpp 灰度字模
+ *          (同固件工程的 LCD_FONT_AA)。上屏结果与测试中逐像素读半字节、查混色表算出的结果比对，
+ *          比例字宽窗口覆盖奇数列起始 (从字节的高半字节开始) 的情况。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "lcd_font_gray.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_util.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEXT_Y 140 // 瓦片区下方
+
+#define MAX_GLYPHS 95
+
+#define CH_R(c) ((c) >> 11)
+#define CH_G(c) (((c) >> 5) & 0x3F)
+#define CH_B(c) ((c) & 0x1F)
+
+/**
+ * @brief 测试用的配色 (前景色, 背景色)
+ */
+static const uint16_t s_pairs[][2] = {
+    {WHITE, BLACK},
+    {BLACK, WHITE},
+    {RED, BLUE},
+    {0x07E0, 0xF81F},
+    {0xFD20, 0x18E3}, // 橙字深灰底
+    {0x1234, 0xABCD},
+    {0x5555, 0x5555},
+};
+
+#define PAIR_COUNT (sizeof(s_pairs) / sizeof(s_pairs[0]))
+
+static font_metric_t s_metrics[MAX_GLYPHS];
+
+// ====================================================================
+// 混色表
+// ====================================================================
+
+/**
+ * @brief  一个分量：端点准确、与精确值相差不超过 0.5、从背景到前景单调
+ * @retval 不满足的项数
+ */
+static uint32_t Check_Channel(const uint16_t* lut, uint16_t (*ch)(uint16_t), uint16_t f, uint16_t b)
+{
+    uint32_t bad = 0;
+
+    for (uint8_t i = 0; i < LCD_GRAY_LEVELS; i++)
+    {
+        double exact = b + (double) ((int) f - (int) b) * i / (LCD_GRAY_LEVELS - 1);
+        double got   = ch(lut[i]);
+
+        bad += (got - exact > 0.5 || exact - got > 0.5);
+        if (i > 0)
+        {
+            int step = (int) ch(lut[i]) - (int) ch(lut[i - 1]);
+            bad += (f >= b) ? (step < 0) : (step > 0);
+        }
+    }
+    return bad;
+}
+
+static uint16_t Ch_R(uint16_t c)
+{
+    return CH_R(c);
+}
+
+static uint16_t Ch_G(uint16_t c)
+{
+    return CH_G(c);
+}
+
+static uint16_t Ch_B(uint16_t c)
+{
+    return CH_B(c);
+}
+
+static void Test_LUT_Values(void)
+{
+    for (uint8_t p = 0; p < PAIR_COUNT; p++)
+    {
+        uint16_t        fg  = s_pairs[p][0];
+        uint16_t        bg  = s_pairs[p][1];
+        const uint16_t* lut = LCD_Gray_LUT(fg, bg);
+
+        TEST_CHECK_EQ(lut[0], bg);
+        TEST_CHECK_EQ(lut[LCD_GRAY_LEVELS - 1], fg);
+        TEST_CHECK_EQ(Check_Channel(lut, Ch_R, CH_R(fg), CH_R(bg)), 0);
+        TEST_CHECK_EQ(Check_Channel(lut, Ch_G, CH_G(fg), CH_G(bg)), 0);
+        TEST_CHECK_EQ(Check_Channel(lut, Ch_B, CH_B(fg), CH_B(bg)), 0);
+    }
+
+    // 白字黑底正中间一级：各分量取半 (四舍五入)
+    const uint16_t* lut = LCD_Gray_LUT(WHITE, BLACK);
+    TEST_CHECK_EQ(CH_R(lut[8]), (31 * 8 + 7) / 15);
+    TEST_CHECK_EQ(CH_G(lut[8]), (63 * 8 + 7) / 15);
+}
+
+/**
+ * @brief  槽位：命中时返回同一张表，超过 LCD_GRAY_LUT_SLOTS 种配色时淘汰最久未用的
+ */
+static void Test_LUT_Slots(void)
+{
+    LCD_Gray_Stats_t st;
+    const uint16_t*  tab[LCD_GRAY_LUT_SLOTS + 1];
+
+    // 先用满全部槽位 (之前的配色被依次淘汰)
+    for (uint8_t p = 0; p < LCD_GRAY_LUT_SLOTS; p++)
+        tab[p] = LCD_Gray_LUT(s_pairs[p][0], s_pairs[p][1]);
+
+    LCD_Gray_Reset_Stats();
+    for (uint8_t p = 0; p < LCD_GRAY_LUT_SLOTS; p++)
+        TEST_CHECK(LCD_Gray_LUT(s_pairs[p][0], s_pairs[p][1]) == tab[p]);
+    LCD_Gray_Get_Stats(&st);
+    TEST_CHECK_EQ(st.hits, LCD_GRAY_LUT_SLOTS);
+    TEST_CHECK_EQ(st.builds, 0);
+
+    // 各槽位是不同的表
+    for (uint8_t i = 0; i < LCD_GRAY_LUT_SLOTS; i++)
+        for (uint8_t j = i + 1; j < LCD_GRAY_LUT_SLOTS; j++)
+            TEST_CHECK(tab[i] != tab[j]);
+
+    // 再用一次第 0 种，最久未用的变成第 1 种；新配色占用它的槽位
+    LCD_Gray_LUT(s_pairs[0][0], s_pairs[0][1]);
+    tab[LCD_GRAY_LUT_SLOTS] =
+        LCD_Gray_LUT(s_pairs[LCD_GRAY_LUT_SLOTS][0], s_pairs[LCD_GRAY_LUT_SLOTS][1]);
+    LCD_Gray_Get_Stats(&st);
+    TEST_CHECK_EQ(st.builds, 1);
+    TEST_CHECK(tab[LCD_GRAY_LUT_SLOTS] == tab[1]);
+    TEST_CHECK_EQ(tab[LCD_GRAY_LUT_SLOTS][0], s_pairs[LCD_GRAY_LUT_SLOTS][1]);
+    TEST_CHECK_EQ(tab[LCD_GRAY_LUT_SLOTS][LCD_GRAY_LEVELS - 1], s_pairs[LCD_GRAY_LUT_SLOTS][0]);
+
+    // 第 0、2 种仍然命中；第 1 种需要重新计算，淘汰此时最久未用的第 3 种
+    TEST_CHECK(LCD_Gray_LUT(s_pairs[0][0], s_pairs[0][1]) == tab[0]);
+    TEST_CHECK(LCD_Gray_LUT(s_pairs[2][0], s_pairs[2][1]) == tab[2]);
+    const uint16_t* again = LCD_Gray_LUT(s_pairs[1][0], s_pairs[1][1]);
+    LCD_Gray_Get_Stats(&st);
+    TEST_CHECK_EQ(st.builds, 2);
+    TEST_CHECK_EQ(st.hits, LCD_GRAY_LUT_SLOTS + 3);
+    TEST_CHECK(again == tab[3]);
+    TEST_CHECK_EQ(again[0], s_pairs[1][1]);
+    TEST_CHECK_EQ(again[LCD_GRAY_LEVELS - 1], s_pairs[1][0]);
+}
+
+// ====================================================================
+// 逐行展开
+// ====================================================================
+
+/**
+ * @brief  字模一行中第 x 列的灰度级 (低半字节在前)
+ */
+static uint8_t Nibble(const uint8_t* row, uint16_t x)
+{
+    return (x & 1) ? (row[x / 2] >> 4) : (row[x / 2] & 0x0F);
+}
+
+/**
+ * @brief  每种起始列 (含奇数列) 与宽度：输出与逐个读半字节一致，不越界写
+ */
+static void Test_Expand_Row(void)
+{
+    uint8_t  row[17];
+    uint16_t lut[LCD_GRAY_LEVELS];
+    uint16_t out[34 + 2];
+    uint32_t bad = 0;
+
+    for (uint8_t i = 0; i < sizeof(row); i++)
+        row[i] = (uint8_t) (i * 0x37 + 0x1E);
+    for (uint8_t i = 0; i < LCD_GRAY_LEVELS; i++)
+        lut[i] = (uint16_t) (0x1000 + i); // 输出值直接就是灰度级
+
+    for (uint8_t skip = 0; skip < 32; skip++)
+    {
+        for (uint16_t w = 0; skip + w <= 32; w++)
+        {
+            for (uint8_t k = 0; k < sizeof(out) / 2; k++)
+                out[k] = 0xA5A5;
+
+            LCD_Gray_Expand_Row(out + 1, row, skip, w, lut);
+
+            bad += out[0] != 0xA5A5 || out[w + 1] != 0xA5A5;
+            for (uint16_t x = 0; x < w; x++)
+                bad += out[1 + x] != lut[Nibble(row, skip + x)];
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+}
+
+// ====================================================================
+// 上屏
+// ====================================================================
+
+/**
+ * @brief  字体收录的全部 ASCII 字符及其字模序号
+ * @retval 字符数
+ */
+static uint8_t Font_Chars(const font_info_t* font, char* out, uint16_t* index)
+{
+    uint8_t n = 0;
+
+    if (!font->ascii_ranges)
+    {
+        for (char c = 0x20; c <= 0x7E; c++, n++)
+        {
+            out[n]   = c;
+            index[n] = n;
+        }
+        return n;
+    }
+    for (uint8_t r = 0; r < font->ascii_range_count; r++)
+    {
+        for (uint16_t i = 0; i < font->ascii_ranges[r].count; i++, n++)
+        {
+            out[n]   = (char) (font->ascii_ranges[r].first + i);
+            index[n] = font->ascii_ranges[r].offset + i;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief  屏幕上 (x, y) 起的一个字与灰度字模 [left, left + w) 窗口逐像素比较
+ * @retval 不一致的像素数
+ */
+static uint32_t Diff_Glyph(uint16_t        x,
+                           uint16_t        y,
+                           const uint8_t*  glyph,
+                           uint8_t         stride,
+                           uint8_t         h,
+                           uint8_t         left,
+                           uint8_t         w,
+                           const uint16_t* lut)
+{
+    const uint16_t* fb   = ST7789_Emu_Framebuffer();
+    uint32_t        diff = 0;
+
+    for (uint16_t r = 0; r < h; r++)
+        for (uint16_t c = 0; c < w; c++)
+            diff += fb[(y + r) * TFT_COLUMN_NUMBER + x + c] !=
+                    lut[Nibble(glyph + r * stride, left + c)];
+    return diff;
+}
+
+/**
+ * @brief  ASCII 灰度字体的全部字 x 全部窗口
+ * @note   关掉字模缓存：缓存键不含 left，同一个字换窗口会命中旧的展开结果
+ */
+static void Test_Render_ASCII(const char* name, const font_info_t* font, uint16_t fg, uint16_t bg)
+{
+    font_info_t f = *font;
+    char        chars[MAX_GLYPHS + 1];
+    uint16_t    index[MAX_GLYPHS];
+    uint8_t     count  = Font_Chars(font, chars, index);
+    uint8_t     cw     = font->ascii_w;
+    uint8_t     stride = (cw + 1) / 2;
+    uint32_t    size   = (uint32_t) stride * font->ascii_h; // 单个字模的字节数
+    uint32_t    bad    = 0;
+
+    TEST_CHECK(font->ascii_gray != NULL);
+
+    f.glyph_cache   = 0;
+    f.ascii_metrics = s_metrics;
+
+    for (uint8_t left = 0; left < cw; left++)
+    {
+        for (uint8_t w = 1; left + w <= cw; w++)
+        {
+            // LCD_Show_String 在 cursor_x + cn_w 超出屏宽时换行：一批只放不会换行的字数
+            uint8_t per_line = (TFT_COLUMN_NUMBER - font->cn_w) / w + 1;
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                s_metrics[i].left    = left;
+                s_metrics[i].advance = w;
+            }
+
+            for (uint8_t i = 0; i < count; i += per_line)
+            {
+                char    line[MAX_GLYPHS + 1];
+                uint8_t n = (count - i < per_line) ? count - i : per_line;
+
+                memcpy(line, &chars[i], n);
+                line[n] = '\0';
+                LCD_Show_String(0, TEXT_Y, line, &f, fg, bg);
+                ST7789_Flush();
+
+                const uint16_t* lut = LCD_Gray_LUT(fg, bg);
+                for (uint8_t k = 0; k < n; k++)
+                {
+                    const uint8_t* glyph = font->ascii_gray + index[i + k] * size;
+                    bad += Diff_Glyph(k * w, TEXT_Y, glyph, stride, font->ascii_h, left, w, lut);
+                }
+            }
+        }
+    }
+
+    printf("  %s: %u glyphs x %u windows, %u mismatched pixels\n",
+           name,
+           count,
+           cw * (cw + 1) / 2,
+           bad);
+    TEST_CHECK_EQ(bad, 0);
+}
+
+/**
+ * @brief  描述符原样使用：20 点阵日期 (ASCII + 汉字，使用字模缓存)
+ */
+static void Test_Render_Date(void)
+{
+    static const struct
+    {
+        const char* utf8;
+        uint16_t    code;
+    } s_cjk[] = {{"星", 0x661F}, {"期", 0x671F}, {"三", 0x4E09}, {"日", 0x65E5}};
+
+    const font_info_t* font = &font_time_20;
+    char               str[32];
+    uint32_t           bad = 0;
+
+    TEST_CHECK(font->hzk_gray != NULL && font->glyph_cache);
+
+    snprintf(str, sizeof(str), "12%s%s%s%s", s_cjk[0].utf8, s_cjk[1].utf8, s_cjk[2].utf8,
+             s_cjk[3].utf8);
+
+    // 两遍：第一遍未命中 (展开存入缓存)，第二遍命中 (从缓存拷贝)
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        LCD_Show_String(0, TEXT_Y, str, font, 0xFD20, 0x18E3);
+        ST7789_Flush();
+
+        const uint16_t* lut = LCD_Gray_LUT(0xFD20, 0x18E3);
+        for (uint8_t k = 0; k < 2; k++)
+        {
+            const uint8_t* glyph = font->ascii_gray + (uint32_t) ('1' + k - 0x20) * 5 * 20;
+            bad += Diff_Glyph(k * 10, TEXT_Y, glyph, 5, 20, 0, 10, lut);
+        }
+        for (uint8_t k = 0; k < 4; k++)
+        {
+            uint16_t index = 0;
+            while (index < font->hzk_count && font->hzk_code[index] != s_cjk[k].code)
+                index++;
+            TEST_CHECK(index < font->hzk_count);
+
+            const uint8_t* glyph = font->hzk_gray + (uint32_t) index * 10 * 20;
+            bad += Diff_Glyph(20 + k * 20, TEXT_Y, glyph, 10, 20, 0, 20, lut);
+        }
+    }
+    TEST_CHECK_EQ(bad, 0);
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_LUT_Values();
+    Test_LUT_Slots();
+    Test_Expand_Row();
+
+    Test_Render_ASCII("time_30x60", &font_time_30x60, WHITE, 0x18E3);
+    Test_Render_ASCII("ascii_week_10x20", &font_time_20, 0xFD20, BLACK);
+    Test_Render_Date();
+
+    return Test_Summary("test_font_gray");
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    test_font_rle.c
+ * @brief   压缩字库测试：行程解码与位图展开逐像素一致
+ * @note    font_time_30x60 / font_ascii_16x32 由 font_rle_compress.py 在构建时压缩 (同固件工程)，
+ *          位图版本改名为 *_bitmap 一起链接作为参照。每个字在每种比例字宽窗口
+ *          [left, left + w) 下各画一次，两块区域逐像素比对，覆盖 LCD_RLE_Begin /
+ *          LCD_RLE_Next_Row 的包围盒裁剪、行组切换与行程拆分。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_util.h"
+#include <stdio.h>
+
+#define RLE_Y    140 // 压缩版本 (瓦片区下方)
+#define BITMAP_Y 220 // 位图版本
+
+#define MAX_GLYPHS 95 // 0x20 ~ 0x7E
+
+extern font_info_t font_time_30x60_bitmap;
+extern font_info_t font_ascii_16x32_bitmap;
+
+static font_metric_t s_metrics[MAX_GLYPHS];
+
+/**
+ * @brief  字体收录的全部字符
+ * @retval 字符数
+ */
+static uint8_t Font_Chars(const font_info_t* font, char* out)
+{
+    uint8_t n = 0;
+
+    if (!font->ascii_ranges)
+    {
+        for (char c = 0x20; c <= 0x7E; c++)
+            out[n++] = c;
+        return n;
+    }
+    for (uint8_t r = 0; r < font->ascii_range_count; r++)
+        for (uint16_t i = 0; i < font->ascii_ranges[r].count; i++)
+            out[n++] = (char) (font->ascii_ranges[r].first + i);
+    return n;
+}
+
+/**
+ * @brief  两块区域中不一致的像素数
+ */
+static uint32_t Diff_Rows(uint16_t h)
+{
+    const uint16_t* fb   = ST7789_Emu_Framebuffer();
+    uint32_t        diff = 0;
+
+    for (uint16_t y = 0; y < h; y++)
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            diff += fb[(RLE_Y + y) * TFT_COLUMN_NUMBER + x] !=
+                    fb[(BITMAP_Y + y) * TFT_COLUMN_NUMBER + x];
+    return diff;
+}
+
+/**
+ * @brief  一套字体的全部字 x 全部窗口
+ * @note   两份描述符都关掉字模缓存：缓存键不含 left，同一个字换窗口会命中旧的展开结果
+ */
+static void Test_Font(const char* name, const font_info_t* packed, const font_info_t* bitmap)
+{
+    font_info_t rle = *packed;
+    font_info_t ref = *bitmap;
+    char        chars[MAX_GLYPHS + 1];
+    uint8_t     count = Font_Chars(packed, chars);
+    uint8_t     cw    = packed->ascii_w;
+    uint32_t    bad = 0, windows = 0;
+
+    TEST_CHECK(packed->ascii_rle != NULL);
+    TEST_CHECK(bitmap->ascii_map != NULL && bitmap->ascii_rle == NULL);
+
+    rle.glyph_cache = ref.glyph_cache = 0;
+    rle.ascii_metrics = ref.ascii_metrics = s_metrics;
+
+    for (uint8_t left = 0; left < cw; left++)
+    {
+        for (uint8_t w = 1; left + w <= cw; w++)
+        {
+            for (uint8_t i = 0; i < count; i++)
+            {
+                s_metrics[i].left    = left;
+                s_metrics[i].advance = w;
+            }
+
+            // 一行放得下的字数为一批，整批一段发送 (同一段里各字的解码位置互不干扰)
+            uint8_t per_line = TFT_COLUMN_NUMBER / w;
+            for (uint8_t i = 0; i < count; i += per_line)
+            {
+                char    line[MAX_GLYPHS + 1];
+                uint8_t n = (count - i < per_line) ? count - i : per_line;
+
+                for (uint8_t k = 0; k < n; k++)
+                    line[k] = chars[i + k];
+                line[n] = '\0';
+
+                LCD_Show_String(0, RLE_Y, line, &rle, WHITE, BLUE);
+                LCD_Show_String(0, BITMAP_Y, line, &ref, WHITE, BLUE);
+                ST7789_Flush();
+
+                uint32_t diff = Diff_Rows(packed->ascii_h);
+                if (diff && bad == 0)
+                    printf("  %s: first mismatch at left=%u w=%u \"%s\"\n", name, left, w, line);
+                bad += diff;
+            }
+            windows++;
+        }
+    }
+
+    printf("  %s: %u glyphs x %u windows, %u mismatched pixels\n", name, count, windows, bad);
+    TEST_CHECK_EQ(windows, cw * (cw + 1) / 2);
+    TEST_CHECK_EQ(bad, 0);
+}
+
+/**
+ * @brief  描述符原样使用 (等宽、时钟字体按默认配置决定是否缓存)
+ */
+static void Test_Descriptor(const font_info_t* packed, const font_info_t* bitmap, const char* str)
+{
+    LCD_Show_String(0, RLE_Y, str, packed, BLACK, WHITE);
+    LCD_Show_String(0, BITMAP_Y, str, bitmap, BLACK, WHITE);
+    ST7789_Flush();
+    TEST_CHECK_EQ(Diff_Rows(packed->ascii_h), 0);
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_Font("time_30x60", &font_time_30x60, &font_time_30x60_bitmap);
+    Test_Font("ascii_16x32", &font_ascii_16x32, &font_ascii_16x32_bitmap);
+
+    Test_Descriptor(&font_time_30x60, &font_time_30x60_bitmap, "23:59-");
+    Test_Descriptor(&font_ascii_16x32, &font_ascii_16x32_bitmap, "Sat 29.5 C");
+
+    return Test_Summary("test_font_rle");
+}
@@ -0,0 +1,129 @@
+/**
+ * @file    test_fsmc_bus.c
+ * @brief   FSMC 后端测试：同一串绘制分别走 SPI 式字节流与 FSMC 地址窗口，结果必须一致
+ * @note    记录型后端按 SPI 的发送方式记下线上字节，换算成 FSMC 应有的写序列
+ *          (命令与参数每字节一次写，RAMWR 之后每两个字节拼成一个像素)，
+ *          再与 ST7789_FSMC_MOCK 记录的地址窗口写操作逐条比较。
+ *          覆盖初始化、窗口、阻塞填充、队列填充、原生 16 位搬运和大端字节流搬运，
+ *          整屏字节流 (153600 字节) 按 65535 切段，段尾会拆开一个像素。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_bus.h"
+#include "test_util.h"
+#include <stdio.h>
+
+#define WIRE_CAPACITY (ST7789_FSMC_MOCK_DEPTH * 2)
+
+static Test_Bus_Wire_t          s_wire[WIRE_CAPACITY];
+static ST7789_FSMC_Mock_Write_t s_expect[ST7789_FSMC_MOCK_DEPTH];
+
+static uint16_t s_pixels16[13 * 7];
+static uint8_t  s_bytes[TFT_COLUMN_NUMBER * TFT_LINE_NUMBER * 2 + 1];
+
+/**
+ * @brief  同一串绘制操作 (两个后端各执行一次)
+ */
+static void Draw_Sequence(void)
+{
+    static const uint8_t full[4] = {0x00, 0x00, 0x00, 0xEF};
+
+    ST7789_Init();
+
+    // 窗口缓存在两次执行之间不会复位：先绕过缓存写一次，保证两边从同一状态开始
+    ST7789_Write_Cmd(0x2A, full, 4);
+    ST7789_Write_Cmd(0x2B, full, 4);
+
+    TFT_Fill_Rect(10, 200, 20, 10, RED);
+    ST7789_Queue_Fill(0, 150, 240, 30, BLUE);
+    ST7789_Queue_Blit16(5, 140, 13, 7, s_pixels16, NULL, NULL);
+    ST7789_Queue_Blit(3, 130, 11, 9, s_bytes, NULL, NULL);
+    ST7789_Queue_Blit(40, 130, 7, 5, s_bytes + 1, NULL, NULL); // 源地址不对齐
+    ST7789_Queue_Blit(0, 0, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER, s_bytes, NULL, NULL);
+    ST7789_Flush();
+}
+
+/**
+ * @brief  SPI 线上字节换算为 FSMC 写序列
+ * @retval 写操作条数
+ */
+static uint32_t Wire_To_FSMC(uint32_t n)
+{
+    uint32_t out = 0;
+    uint8_t  cmd = 0, hi = 0, hi_valid = 0;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (!s_wire[i].dc)
+        {
+            cmd      = s_wire[i].byte;
+            hi_valid = 0;
+            s_expect[out].dc      = 0;
+            s_expect[out++].value = cmd;
+        }
+        else if (cmd == 0x2C || cmd == 0x3C)
+        {
+            if (!hi_valid)
+            {
+                hi       = s_wire[i].byte;
+                hi_valid = 1;
+                continue;
+            }
+            hi_valid              = 0;
+            s_expect[out].dc      = 1;
+            s_expect[out++].value = (uint16_t) ((hi << 8) | s_wire[i].byte);
+        }
+        else
+        {
+            s_expect[out].dc      = 1;
+            s_expect[out++].value = s_wire[i].byte;
+        }
+    }
+    return out;
+}
+
+int main(void)
+{
+    for (uint32_t i = 0; i < sizeof(s_pixels16) / 2; i++)
+        s_pixels16[i] = (uint16_t) (i * 0x0813 + 7);
+    for (uint32_t i = 0; i < sizeof(s_bytes); i++)
+        s_bytes[i] = (uint8_t) (i * 37 + (i >> 8));
+
+    // 1. SPI 式字节流
+    ST7789_Bus_Select(&g_test_bus);
+    Test_Bus_Wire_Log(s_wire, WIRE_CAPACITY);
+    Draw_Sequence();
+    uint32_t wire_n = Test_Bus_Wire_Count();
+    Test_Bus_Wire_Log(NULL, 0);
+
+    TEST_CHECK(wire_n <= WIRE_CAPACITY);
+    uint32_t expect_n = Wire_To_FSMC(wire_n);
+
+    // 2. FSMC 地址窗口
+    ST7789_Bus_Select(&g_st7789_bus_fsmc);
+    ST7789_FSMC_Mock_Clear();
+    Draw_Sequence();
+
+    uint32_t                        fsmc_n = ST7789_FSMC_Mock_Count();
+    const ST7789_FSMC_Mock_Write_t* log    = ST7789_FSMC_Mock_Log();
+
+    TEST_CHECK_EQ(fsmc_n, expect_n);
+    TEST_CHECK(fsmc_n <= ST7789_FSMC_MOCK_DEPTH);
+
+    uint32_t n     = fsmc_n < expect_n ? fsmc_n : expect_n;
+    uint32_t first = n;
+    for (uint32_t i = 0; i < n && first == n; i++)
+    {
+        if (log[i].dc != s_expect[i].dc || log[i].value != s_expect[i].value)
+            first = i;
+    }
+    if (!TEST_CHECK_EQ(first, n))
+        printf("  first mismatch: fsmc (%u, 0x%04X) vs spi (%u, 0x%04X)\n",
+               log[first].dc,
+               log[first].value,
+               s_expect[first].dc,
+               s_expect[first].value);
+
+    return Test_Summary("test_fsmc_bus");
+}
@@ -0,0 +1,245 @@
+/**
+ * @file    test_gfx.c
+ * @brief   扫描线图元测试：经仿真后端检查像素结果、DMA 填充次数与线段合并
+ * @note    每个图元画在瓦片区之外的空白屏幕上，仿真统计中的 streams 即 DMA 填充次数：
+ *          空心图形的填充次数应与周长成正比，可合并的部分 (竖线、圆角矩形中段、
+ *          渐变色带) 应只占一次。最后把所有图元画在一屏上与 golden/gfx.ppm 比对。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_gfx.h"
+#include "st7789_tile.h"
+#include "test_util.h"
+
+#define AREA_Y 128 // 瓦片区下方的绘图区
+#define AREA_H (TFT_LINE_NUMBER - AREA_Y)
+
+static uint16_t Pixel(int16_t x, int16_t y)
+{
+    return ST7789_Emu_Framebuffer()[y * TFT_COLUMN_NUMBER + x];
+}
+
+/**
+ * @brief  清空绘图区并把统计清零
+ */
+static void Clear(void)
+{
+    ST7789_Queue_Fill(0, AREA_Y, TFT_COLUMN_NUMBER, AREA_H, BLACK);
+    ST7789_Flush();
+    ST7789_Emu_Reset_Stats();
+}
+
+/**
+ * @brief  绘制完成并读出统计
+ */
+static void Finish(ST7789_Emu_Stats_t* st)
+{
+    ST7789_Flush();
+    ST7789_Emu_Get_Stats(st);
+}
+
+/**
+ * @brief  统计绘图区中指定颜色的像素数
+ */
+static uint32_t Count(uint16_t color)
+{
+    uint32_t n = 0;
+    for (int16_t y = AREA_Y; y < TFT_LINE_NUMBER; y++)
+        for (int16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            n += (Pixel(x, y) == color);
+    return n;
+}
+
+static void Test_Lines(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 水平线、竖直线：一个矩形
+    Clear();
+    TFT_Draw_Line(10, 150, 200, 150, 1, WHITE);
+    Finish(&st);
+    TEST_CHECK_EQ(st.streams, 1);
+    TEST_CHECK_EQ(Count(WHITE), 191);
+
+    Clear();
+    TFT_Draw_Line(50, 140, 50, 300, 3, WHITE);
+    Finish(&st);
+    TEST_CHECK_EQ(st.streams, 1);
+    TEST_CHECK_EQ(Count(WHITE), 3 * 161);
+
+    // 斜线：两端都画到，每行至少一个像素
+    Clear();
+    TFT_Draw_Line(0, 319, 239, 140, 1, WHITE);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(0, 319), WHITE);
+    TEST_CHECK_EQ(Pixel(239, 140), WHITE);
+    TEST_CHECK(st.streams <= 180);
+    TEST_CHECK(Count(WHITE) >= 240);
+
+    // 粗斜线：线宽方向覆盖
+    Clear();
+    TFT_Draw_Line(20, 300, 200, 160, 6, WHITE);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(110, 230), WHITE);
+    TEST_CHECK_EQ(Pixel(110, 160), BLACK);
+}
+
+static void Test_Circles(void)
+{
+    ST7789_Emu_Stats_t st;
+    const int16_t      cx = 120, cy = 220, r = 50;
+
+    // 实心圆：左右、上下对称，面积在 pi r^2 与 pi (r+1)^2 之间，每行最多一次填充
+    Clear();
+    TFT_Fill_Circle(cx, cy, r, RED);
+    Finish(&st);
+
+    uint32_t area = Count(RED);
+    TEST_CHECK(area > 7854 && area < 8171); // pi * 50^2 ~ pi * 51^2
+    TEST_CHECK(st.streams <= 2 * r + 1);
+    TEST_CHECK_EQ(Pixel(cx, cy), RED);
+    TEST_CHECK_EQ(Pixel(cx - r - 1, cy), BLACK);
+
+    uint32_t asym = 0;
+    for (int16_t dy = -r; dy <= r; dy++)
+        for (int16_t dx = -r; dx <= r; dx++)
+            asym += Pixel(cx + dx, cy + dy) != Pixel(cx - dx, cy + dy) ||
+                    Pixel(cx + dx, cy + dy) != Pixel(cx + dx, cy - dy);
+    TEST_CHECK_EQ(asym, 0);
+
+    // 圆环：中心不画，像素数与周长成正比，填充次数每行最多两次
+    Clear();
+    TFT_Draw_Circle(cx, cy, r, 4, GREEN);
+    Finish(&st);
+
+    uint32_t ring = Count(GREEN);
+    TEST_CHECK_EQ(Pixel(cx, cy), BLACK);
+    TEST_CHECK_EQ(Pixel(cx, cy - r), GREEN);
+    TEST_CHECK(ring > 1100 && ring < 1300); // pi * (50^2 - 46^2) = 1206
+    TEST_CHECK(st.streams <= 2 * (2 * r + 1));
+    TEST_CHECK_EQ(st.pixels, ring);
+
+    // 圆弧 (3 点钟为 0 度，顺时针)：只画右下 90 度扇区
+    Clear();
+    TFT_Draw_Arc(cx, cy, r, 6, 10, 80, YELLOW);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(cx + 33, cy + 33), YELLOW); // 45 度
+    TEST_CHECK_EQ(Pixel(cx + r - 2, cy - 2), BLACK); // 0 度之前
+    TEST_CHECK_EQ(Pixel(cx - r + 2, cy), BLACK);     // 180 度
+    TEST_CHECK_EQ(Pixel(cx, cy - r + 2), BLACK);     // 270 度
+    TEST_CHECK(st.streams <= r + 1);                 // 只跨下半圆的行
+}
+
+static void Test_Round_Rects(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 实心圆角矩形：中段一次填完，上下圆角每行一次
+    Clear();
+    TFT_Fill_Round_Rect(20, 150, 200, 100, 10, BLUE);
+    Finish(&st);
+    TEST_CHECK(st.streams <= 2 * 10 + 1);
+    TEST_CHECK_EQ(Pixel(20, 150), BLACK); // 角被切掉
+    TEST_CHECK_EQ(Pixel(20, 200), BLUE);
+    TEST_CHECK_EQ(Pixel(120, 150), BLUE);
+    TEST_CHECK(Count(BLUE) < 200 * 100);
+
+    // 空心圆角矩形：只画边框，两条竖边各一次
+    Clear();
+    TFT_Draw_Round_Rect(20, 150, 200, 100, 10, 2, MAGENTA);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(120, 200), BLACK);
+    TEST_CHECK_EQ(Pixel(20, 200), MAGENTA);
+    TEST_CHECK_EQ(Pixel(120, 151), MAGENTA);
+    TEST_CHECK(st.pixels < 2 * (200 + 100) * 2);
+}
+
+static void Test_Gradients(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 竖直渐变：每行同色，首尾为端点颜色，量化后相同的行合并
+    Clear();
+    TFT_Fill_Gradient_V(0, 140, 240, 160, RED, BLUE);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(0, 140), RED);
+    TEST_CHECK_EQ(Pixel(239, 299), BLUE);
+    TEST_CHECK(st.streams < 160);
+
+    uint32_t uneven = 0;
+    for (int16_t y = 140; y < 300; y++)
+        for (int16_t x = 1; x < 240; x++)
+            uneven += Pixel(x, y) != Pixel(0, y);
+    TEST_CHECK_EQ(uneven, 0);
+
+    // 水平渐变：每列同色，越过右边界的部分裁掉
+    Clear();
+    TFT_Fill_Gradient_H(0, 140, 300, 100, GREEN, BLACK);
+    Finish(&st);
+    TEST_CHECK_EQ(Pixel(0, 140), GREEN);
+    TEST_CHECK_EQ(st.pixels, 240 * 100);
+
+    uneven = 0;
+    for (int16_t x = 0; x < 240; x++)
+        for (int16_t y = 141; y < 240; y++)
+            uneven += Pixel(x, y) != Pixel(x, 140);
+    TEST_CHECK_EQ(uneven, 0);
+}
+
+static void Test_Clipping(void)
+{
+    ST7789_Emu_Stats_t st;
+
+    // 完全在屏幕外：不产生任何传输
+    Clear();
+    TFT_Fill_Circle(-100, 200, 30, WHITE);
+    TFT_Draw_Line(250, 150, 400, 300, 3, WHITE);
+    Finish(&st);
+    TEST_CHECK_EQ(st.streams, 0);
+    TEST_CHECK_EQ(st.pixels, 0);
+
+    // 部分在屏幕外：只画屏幕内的部分
+    Clear();
+    TFT_Draw_Circle(-10, 300, 30, 2, WHITE);
+    Finish(&st);
+    TEST_CHECK(st.pixels > 0);
+    TEST_CHECK_EQ(st.pixels, Count(WHITE));
+}
+
+/**
+ * @brief  所有图元画在一屏上 (含瓦片区)，与基准图比对
+ */
+static void Test_Golden(void)
+{
+    TFT_Fill_Rect(0, 0, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER, BLACK);
+    TFT_Fill_Gradient_V(0, 0, 120, 120, RED, BLUE);
+    TFT_Fill_Gradient_H(120, 0, 120, 120, GREEN, MAGENTA);
+    TFT_Fill_Round_Rect(10, 135, 100, 20, 8, BLUE);
+    TFT_Draw_Round_Rect(120, 135, 110, 20, 8, 2, MAGENTA);
+    TFT_Fill_Circle(60, 190, 30, RED);
+    TFT_Draw_Circle(180, 190, 30, 4, GREEN);
+    TFT_Draw_Arc(60, 270, 40, 8, 300, 60, YELLOW);
+    TFT_Draw_Arc(180, 270, 40, 8, 45, 315, CYAN);
+    TFT_Draw_Line(0, 319, 239, 230, 1, WHITE);
+    TFT_Draw_Line(10, 310, 200, 240, 5, WHITE);
+    TFT_Draw_Circle(-10, -10, 30, 2, WHITE);
+
+    ST7789_Tile_Flush();
+    ST7789_Flush();
+    Test_Golden_PPM("gfx");
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_Lines();
+    Test_Circles();
+    Test_Round_Rects();
+    Test_Gradients();
+    Test_Clipping();
+    Test_Golden();
+
+    return Test_Summary("test_gfx");
+}
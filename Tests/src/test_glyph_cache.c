@@ -0,0 +1,312 @@
+/**
+ * @file    test_glyph_cache.c
+ * @brief   字模缓存测试：命中/未命中/淘汰/bypass 计数、LRU 淘汰顺序、首次适配、段内钉住
+ * @note    同一程序编译两次：test_glyph_cache 为默认的瓦片 8 行 (像素池 4K，单字上限 512 像素)，
+ *          test_glyph_cache_2row 定义 ST7789_TILE_ROWS=2 (像素池 49K)，检查 30x60 时钟数字
+ *          全部进入缓存后不再淘汰。文字画在瓦片区下方，缓存结果与不用缓存的绘制逐像素比对。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "lcd_glyph_cache.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_util.h"
+#include <string.h>
+
+#if ST7789_TILE_ROWS == 2
+#define TEST_NAME "test_glyph_cache_2row"
+#else
+#define TEST_NAME "test_glyph_cache"
+#endif
+
+#define TEXT_Y  200 // 瓦片区下方
+#define PLAIN_Y 260 // 不用缓存的对照绘制
+
+#define ASCII_20_PIXELS (10 * 20) // font_time_20 的 ASCII 字模像素数
+#define POOL_PIXELS     (LCD_GLYPH_CACHE_BYTES / 2)
+
+/**
+ * @brief  清空缓存与计数
+ */
+static void Reset(void)
+{
+    LCD_Glyph_Cache_Clear();
+    LCD_Glyph_Cache_Reset_Stats();
+}
+
+static void Stats(LCD_Glyph_Cache_Stats_t* st)
+{
+    ST7789_Flush();
+    LCD_Glyph_Cache_Get_Stats(st);
+}
+
+/**
+ * @brief  用缓存与不用缓存各画一次，比较两块区域
+ * @retval 不一致的像素数
+ */
+static uint32_t Diff_Uncached(const char* str, const font_info_t* font, uint16_t fg, uint16_t bg)
+{
+    font_info_t plain = *font;
+    uint32_t    diff  = 0;
+
+    plain.glyph_cache = 0;
+    LCD_Show_String(0, TEXT_Y, str, font, fg, bg);
+    LCD_Show_String(0, PLAIN_Y, str, &plain, fg, bg);
+    ST7789_Flush();
+
+    const uint16_t* fb = ST7789_Emu_Framebuffer();
+    for (uint16_t y = 0; y < font->ascii_h; y++)
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            diff += fb[(TEXT_Y + y) * TFT_COLUMN_NUMBER + x] !=
+                    fb[(PLAIN_Y + y) * TFT_COLUMN_NUMBER + x];
+    return diff;
+}
+
+/**
+ * @brief  重复绘制同一串：第一次全部未命中，之后全部命中；换颜色是新的条目
+ */
+static void Test_Hit_Miss(void)
+{
+    LCD_Glyph_Cache_Stats_t st;
+
+    Reset();
+    LCD_Show_String(0, TEXT_Y, "12", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 2);
+    TEST_CHECK_EQ(st.hits, 0);
+    TEST_CHECK_EQ(st.entries, 2);
+    TEST_CHECK_EQ(st.bytes_used, 2 * ASCII_20_PIXELS * 2);
+
+    for (uint8_t i = 0; i < 3; i++)
+        LCD_Show_String(0, TEXT_Y, "21", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 2);
+    TEST_CHECK_EQ(st.hits, 6);
+
+    // 同一个字出现两次：第二次命中段内刚存入的条目
+    LCD_Show_String(0, TEXT_Y, "11", &font_time_20, RED, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 3);
+    TEST_CHECK_EQ(st.hits, 7);
+    TEST_CHECK_EQ(st.entries, 3);
+    TEST_CHECK_EQ(st.evictions, 0);
+    TEST_CHECK_EQ(st.bypass, 0);
+
+    // 命中时拷贝出的像素与直接展开一致
+    TEST_CHECK_EQ(Diff_Uncached("2112", &font_time_20, WHITE, BLACK), 0);
+    TEST_CHECK_EQ(Diff_Uncached("2112", &font_time_20, RED, BLACK), 0);
+}
+
+/**
+ * @brief  池满后淘汰最久未用的字，刚用过的字留下
+ */
+static void Test_LRU_Order(void)
+{
+    LCD_Glyph_Cache_Stats_t st;
+    const uint8_t           fit = POOL_PIXELS / ASCII_20_PIXELS; // 池中放得下的 ASCII 字数
+    char                    all[16];
+
+    if (fit > 10)
+        return; // 大像素池放得下所有数字，淘汰顺序由默认配置覆盖
+
+    for (uint8_t i = 0; i < fit; i++)
+        all[i] = (char) ('0' + i);
+    all[fit] = '\0';
+
+    Reset();
+    LCD_Show_String(0, TEXT_Y, all, &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, fit);
+    TEST_CHECK_EQ(st.evictions, 0);
+
+    // '0' 最早存入，再用一次后最久未用的是 '1'
+    LCD_Show_String(0, TEXT_Y, "0", &font_time_20, WHITE, BLACK);
+    LCD_Show_String(0, TEXT_Y, "-", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.hits, 1);
+    TEST_CHECK_EQ(st.misses, fit + 1);
+    TEST_CHECK_EQ(st.evictions, 1);
+    TEST_CHECK_EQ(st.entries, fit);
+
+    // '0' 与 '-' 还在，'1' 已被淘汰，再存入 '1' 时淘汰的是 '2'
+    LCD_Show_String(0, TEXT_Y, "0-", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.hits, 3);
+    LCD_Show_String(0, TEXT_Y, "1", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, fit + 2);
+    TEST_CHECK_EQ(st.evictions, 2);
+    LCD_Show_String(0, TEXT_Y, "3", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.hits, 4);
+    LCD_Show_String(0, TEXT_Y, "2", &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, fit + 3);
+    TEST_CHECK_EQ(st.bytes_used, fit * ASCII_20_PIXELS * 2);
+}
+
+/**
+ * @brief  一段文字取到的字都被钉住：段内放不下的字走 bypass，不淘汰本段的字
+ */
+static void Test_Pinned_Run(void)
+{
+    LCD_Glyph_Cache_Stats_t st;
+    const uint8_t           fit = POOL_PIXELS / ASCII_20_PIXELS;
+    char                    run[24];
+
+    if (fit + 1 >= sizeof(run) || (fit + 1) * 10 > TFT_COLUMN_NUMBER)
+        return; // 一行放不下比像素池多一个字的文字
+
+    for (uint8_t i = 0; i <= fit; i++)
+        run[i] = (char) ('!' + i); // font_time_20 的 ASCII 只有 ' '~'9'
+    run[fit + 1] = '\0';
+
+    Reset();
+    LCD_Show_String(0, TEXT_Y, run, &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, fit);
+    TEST_CHECK_EQ(st.bypass, 1);
+    TEST_CHECK_EQ(st.evictions, 0);
+
+    // 重画：前面的字命中并再次被钉住，最后一个字仍然 bypass
+    LCD_Show_String(0, TEXT_Y, run, &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.hits, fit);
+    TEST_CHECK_EQ(st.bypass, 2);
+    TEST_CHECK_EQ(st.evictions, 0);
+
+    // bypass 的字直接展开，结果与不用缓存一致
+    TEST_CHECK_EQ(Diff_Uncached(run, &font_time_20, WHITE, BLACK), 0);
+
+    // 段结束后解除钉住：单独画最后一个字时可以淘汰
+    LCD_Glyph_Cache_Reset_Stats();
+    LCD_Show_String(0, TEXT_Y, run + fit, &font_time_20, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 1);
+    TEST_CHECK_EQ(st.evictions, 1);
+    TEST_CHECK_EQ(st.bypass, 0);
+}
+
+/**
+ * @brief  首次适配：最久未用的条目在池中间，淘汰后新字放回这个空隙
+ */
+static void Test_First_Fit(void)
+{
+    static const uint8_t    key[3] = {0};
+    static const uint8_t    filler[LCD_GLYPH_CACHE_ENTRIES + 1];
+    LCD_Glyph_Cache_Stats_t st;
+    uint16_t*               px[3];
+    uint16_t*               reused = NULL;
+    uint8_t                 hit;
+
+    Reset();
+    for (uint8_t i = 0; i < 3; i++)
+        px[i] = LCD_Glyph_Cache_Get(&key[i], 10, 20, WHITE, BLACK, &hit);
+    LCD_Glyph_Cache_Release();
+    TEST_CHECK(px[0] && px[1] && px[2]);
+    TEST_CHECK_EQ(px[1] - px[0], ASCII_20_PIXELS);
+    TEST_CHECK_EQ(px[2] - px[1], ASCII_20_PIXELS);
+
+    // 再用 0 与 2，最久未用的变成夹在中间的 1
+    LCD_Glyph_Cache_Get(&key[0], 10, 20, WHITE, BLACK, &hit);
+    LCD_Glyph_Cache_Get(&key[2], 10, 20, WHITE, BLACK, &hit);
+    LCD_Glyph_Cache_Release();
+
+    // 接着存入新字直到第一次淘汰 (像素池或条目表满)：被淘汰的是 1，新字放进它的空隙
+    for (uint8_t n = 0; n < sizeof(filler); n++)
+    {
+        uint16_t* p = LCD_Glyph_Cache_Get(&filler[n], 10, 20, WHITE, BLACK, &hit);
+        LCD_Glyph_Cache_Release();
+        LCD_Glyph_Cache_Get_Stats(&st);
+        if (st.evictions)
+        {
+            reused = p;
+            break;
+        }
+        TEST_CHECK(p > px[2]); // 淘汰之前都接在末尾
+    }
+    TEST_CHECK_EQ(st.evictions, 1);
+    TEST_CHECK(reused == px[1]);
+
+    // 0 与 2 仍然命中
+    TEST_CHECK(LCD_Glyph_Cache_Get(&key[0], 10, 20, WHITE, BLACK, &hit) == px[0] && hit);
+    TEST_CHECK(LCD_Glyph_Cache_Get(&key[2], 10, 20, WHITE, BLACK, &hit) == px[2] && hit);
+    LCD_Glyph_Cache_Release();
+
+    // 超过单字上限的字不缓存
+    LCD_Glyph_Cache_Reset_Stats();
+    TEST_CHECK(LCD_Glyph_Cache_Get(&key[0], 240, 240, WHITE, BLACK, &hit) == NULL);
+    LCD_Glyph_Cache_Get_Stats(&st);
+    TEST_CHECK_EQ(st.bypass, 1);
+    TEST_CHECK_EQ(st.evictions, 0);
+}
+
+/**
+ * @brief  30x60 时钟数字：小像素池不缓存 (不产生 bypass)，大像素池全部缓存后不再淘汰
+ */
+static void Test_Clock_Digits(void)
+{
+    LCD_Glyph_Cache_Stats_t st;
+    char                    hhmm[8];
+
+    Reset();
+    if (!LCD_GLYPH_CACHE_FITS(30, 60))
+    {
+        TEST_CHECK_EQ(font_time_30x60.glyph_cache, 0);
+        LCD_Show_String(0, TEXT_Y, "12:59", &font_time_30x60, WHITE, BLACK);
+        Stats(&st);
+        TEST_CHECK_EQ(st.misses + st.hits + st.bypass, 0);
+
+        // 强行打开时每个字都是 bypass：这正是描述符按像素池大小置位的原因
+        font_info_t forced = font_time_30x60;
+        forced.glyph_cache = 1;
+        LCD_Show_String(0, TEXT_Y, "12:59", &forced, WHITE, BLACK);
+        Stats(&st);
+        TEST_CHECK_EQ(st.bypass, 5);
+        TEST_CHECK_EQ(st.misses, 0);
+        return;
+    }
+
+    TEST_CHECK_EQ(font_time_30x60.glyph_cache, 1);
+
+    // 一天里的每一分钟：只有 0~9 与冒号 11 个字会未命中
+    for (uint16_t m = 0; m < 24 * 60; m++)
+    {
+        hhmm[0] = (char) ('0' + m / 600);
+        hhmm[1] = (char) ('0' + m / 60 % 10);
+        hhmm[2] = ':';
+        hhmm[3] = (char) ('0' + m % 60 / 10);
+        hhmm[4] = (char) ('0' + m % 10);
+        hhmm[5] = '\0';
+        LCD_Show_String(0, TEXT_Y, hhmm, &font_time_30x60, WHITE, BLACK);
+    }
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 11);
+    TEST_CHECK_EQ(st.hits, 24 * 60 * 5 - 11);
+    TEST_CHECK_EQ(st.evictions, 0);
+    TEST_CHECK_EQ(st.bypass, 0);
+    TEST_CHECK_EQ(st.bytes_used, 11 * 30 * 60 * 2);
+
+    // 秒与日期 (20 点阵) 同时缓存也不挤掉时钟数字
+    LCD_Show_String(0, TEXT_Y + 70, "0123456789", &font_time_20, WHITE, BLACK);
+    LCD_Show_String(0, TEXT_Y, "23:59", &font_time_30x60, WHITE, BLACK);
+    Stats(&st);
+    TEST_CHECK_EQ(st.misses, 21);
+    TEST_CHECK_EQ(st.evictions, 0);
+
+    TEST_CHECK_EQ(Diff_Uncached("09:41", &font_time_30x60, WHITE, BLACK), 0);
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_Hit_Miss();
+    Test_LRU_Order();
+    Test_Pinned_Run();
+    Test_First_Fit();
+    Test_Clock_Digits();
+
+    return Test_Summary(TEST_NAME);
+}
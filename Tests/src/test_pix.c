@@ -0,0 +1,158 @@
+/**
+ * @file    test_pix.c
+ * @brief   像素转换内核测试：按字处理的版本与逐像素参考实现逐位一致
+ * @note    同一程序编译两次：test_pix 为主机默认的可移植版本 (位运算)，
+ *          test_pix_simd 定义 ST7789_PIX_SIMD=1 并强制包含 test_simd_emu.h，
+ *          走目标板的 SIMD 路径。遍历输出对齐、源地址偏移、起始位与 0 ~ 240 的宽度，
+ *          输出前后各放一个哨兵检查越界写；最后运行 ST7789_Pix_Benchmark() 的自检。
+ */
+
+#include "st7789.h"
+#include "st7789_pix.h"
+#include "test_util.h"
+#include <stdio.h>
+
+#define MAX_W    TFT_COLUMN_NUMBER
+#define SENTINEL 0xA5A5
+
+#if ST7789_PIX_SIMD
+#define TEST_NAME "test_pix_simd"
+#else
+#define TEST_NAME "test_pix"
+#endif
+
+static uint8_t  s_src[MAX_W * 3 + 8];
+static uint16_t s_ref[MAX_W + 4] __attribute__((aligned(4)));
+static uint16_t s_out[MAX_W + 4] __attribute__((aligned(4)));
+
+typedef enum
+{
+    KERNEL_EXPAND = 0,
+    KERNEL_SWAP16,
+    KERNEL_RGB888,
+    KERNEL_COUNT
+} Kernel_e;
+
+static const char* const s_kernel_name[KERNEL_COUNT] = {"expand", "swap16", "rgb888"};
+
+/**
+ * @brief  同一组参数分别跑参考实现与被测实现
+ * @param  off: 输出相对 4 字节对齐的像素偏移 (0 / 1)
+ * @param  arg: expand 为起始位，其余为源地址偏移
+ * @retval 不一致 (含哨兵被改写) 的像素数
+ */
+static uint32_t Run(Kernel_e k, uint8_t off, uint8_t arg, uint16_t w)
+{
+    uint32_t diff = 0;
+
+    for (uint16_t i = 0; i < MAX_W + 4; i++)
+        s_ref[i] = s_out[i] = SENTINEL;
+
+    uint16_t* ref = s_ref + 1 + off; // 前面留一个哨兵
+    uint16_t* out = s_out + 1 + off;
+
+    switch (k)
+    {
+    case KERNEL_EXPAND:
+        ST7789_Pix_Expand_Bits_Ref(ref, s_src, arg, w, 0xF800 | w, 0x07E0 | arg);
+        ST7789_Pix_Expand_Bits(out, s_src, arg, w, 0xF800 | w, 0x07E0 | arg);
+        break;
+    case KERNEL_SWAP16:
+        ST7789_Pix_Swap16_Ref(ref, s_src + arg, w);
+        ST7789_Pix_Swap16(out, s_src + arg, w);
+        break;
+    default:
+        ST7789_Pix_RGB888_To_565_Ref(ref, s_src + arg, w);
+        ST7789_Pix_RGB888_To_565(out, s_src + arg, w);
+        break;
+    }
+
+    for (uint16_t i = 0; i < MAX_W + 4; i++)
+        diff += s_ref[i] != s_out[i];
+    return diff;
+}
+
+/**
+ * @brief  全部组合逐位对比
+ */
+static void Test_Kernels(void)
+{
+    for (Kernel_e k = 0; k < KERNEL_COUNT; k++)
+    {
+        uint32_t bad = 0, runs = 0;
+
+        for (uint8_t off = 0; off < 2; off++)
+        {
+            for (uint8_t arg = 0; arg < (k == KERNEL_EXPAND ? 8 : 4); arg++)
+            {
+                for (uint16_t w = 0; w <= MAX_W; w++)
+                {
+                    uint32_t diff = Run(k, off, arg, w);
+                    if (diff && bad == 0)
+                        printf("  %s: first mismatch at off=%u arg=%u w=%u\n",
+                               s_kernel_name[k],
+                               off,
+                               arg,
+                               w);
+                    bad += diff;
+                    runs++;
+                }
+            }
+        }
+
+        printf("  %s: %u runs, %u mismatched pixels\n", s_kernel_name[k], runs, bad);
+        TEST_CHECK_EQ(bad, 0);
+    }
+}
+
+/**
+ * @brief  已知数值：字节序与 RGB888 截断
+ */
+static void Test_Values(void)
+{
+    static const uint8_t be[4]  = {0x12, 0x34, 0xAB, 0xCD};
+    static const uint8_t rgb[6] = {0xFF, 0x80, 0x07, 0x08, 0x04, 0xF8};
+    static const uint8_t bits   = 0xA5; // LSB First: 1 0 1 0 0 1 0 1
+
+    ST7789_Pix_Swap16(s_out, be, 2);
+    TEST_CHECK_EQ(s_out[0], 0x1234);
+    TEST_CHECK_EQ(s_out[1], 0xABCD);
+
+    ST7789_Pix_RGB888_To_565(s_out, rgb, 2);
+    TEST_CHECK_EQ(s_out[0], TFT_RGB(0xFF, 0x80, 0x07));
+    TEST_CHECK_EQ(s_out[1], TFT_RGB(0x08, 0x04, 0xF8));
+
+    ST7789_Pix_Expand_Bits(s_out, &bits, 0, 8, 0xFFFF, 0x0000);
+    TEST_CHECK(s_out[0] == 0xFFFF && s_out[1] == 0 && s_out[2] == 0xFFFF && s_out[3] == 0);
+    TEST_CHECK(s_out[4] == 0 && s_out[5] == 0xFFFF && s_out[6] == 0 && s_out[7] == 0xFFFF);
+}
+
+/**
+ * @brief  驱动自带的对比测量 (板上 ST7789_PIX_BENCH 运行的同一函数)
+ */
+static void Test_Benchmark(void)
+{
+    ST7789_Pix_Bench_t bench;
+
+    ST7789_Pix_Benchmark(&bench);
+    TEST_CHECK_EQ(bench.expand.mismatches, 0);
+    TEST_CHECK_EQ(bench.swap16.mismatches, 0);
+    TEST_CHECK_EQ(bench.rgb888.mismatches, 0);
+}
+
+int main(void)
+{
+    uint32_t seed = 0x2545F491;
+
+    for (uint32_t i = 0; i < sizeof(s_src); i++)
+    {
+        seed     = seed * 1664525 + 1013904223;
+        s_src[i] = (uint8_t) (seed >> 24);
+    }
+
+    Test_Values();
+    Test_Kernels();
+    Test_Benchmark();
+
+    return Test_Summary(TEST_NAME);
+}
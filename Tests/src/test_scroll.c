@@ -0,0 +1,266 @@
+/**
+ * @file    test_scroll.c
+ * @brief   硬件垂直滚动测试：VSCRDEF / VSCSAD 参数字节与屏幕行 -> 显存行的换算
+ * @note    经记录型后端取线上字节，按数据手册的定义 (TFA / VSA / BFA 与 VSP) 模拟面板的显示：
+ *          滚动区的第一行显示显存第 VSP 行，之后逐行递增，到滚动区末尾回绕到 TFA。
+ *          测试中每个显存行只记一种颜色，按 ST7789_Scroll_Map_Row 写入新露出的行，
+ *          再把面板显示的每一行与预期的滚动结果比对，覆盖顶部固定区、滚动区与底部固定区，
+ *          以及偏移越过滚动区末尾的回绕。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_bus.h"
+#include "test_util.h"
+#include <stddef.h>
+
+#define WIRE_CAP 64
+
+static Test_Bus_Wire_t s_wire[WIRE_CAP];
+static uint32_t        s_wire_n; // 最近一次记录到的字节数
+
+/**
+ * @brief 面板当前的滚动参数 (从线上字节解码)
+ */
+static uint16_t s_tfa = 0, s_vsa = TFT_LINE_NUMBER, s_bfa = 0, s_vsp = 0;
+
+static uint16_t s_gram[TFT_LINE_NUMBER];   // 每个显存行的颜色
+static uint16_t s_screen[TFT_LINE_NUMBER]; // 屏幕上每一行应显示的颜色
+
+/**
+ * @brief  开始记录之后滚动调用发出的线上字节
+ */
+static void Capture_Begin(void)
+{
+    ST7789_Flush();
+    Test_Bus_Wire_Log(s_wire, WIRE_CAP);
+}
+
+/**
+ * @brief  停止记录，把记录到的 VSCRDEF / VSCSAD 参数应用到面板模型
+ * @param  cmds: 输出，依次记录到的命令字节 (最多 4 个)
+ * @retval 记录到的命令数
+ */
+static uint8_t Capture_End(uint8_t* cmds)
+{
+    uint32_t n;
+    uint8_t  count = 0;
+
+    ST7789_Flush();
+    n = s_wire_n = Test_Bus_Wire_Count();
+    Test_Bus_Wire_Log(NULL, 0);
+    TEST_CHECK(n <= WIRE_CAP);
+
+    for (uint32_t i = 0; i < n && i < WIRE_CAP; i++)
+    {
+        if (s_wire[i].dc != 0)
+            continue;
+        if (count < 4)
+            cmds[count] = s_wire[i].byte;
+        count++;
+
+        if (s_wire[i].byte == 0x33 && i + 6 < n)
+        {
+            s_tfa = (uint16_t) ((s_wire[i + 1].byte << 8) | s_wire[i + 2].byte);
+            s_vsa = (uint16_t) ((s_wire[i + 3].byte << 8) | s_wire[i + 4].byte);
+            s_bfa = (uint16_t) ((s_wire[i + 5].byte << 8) | s_wire[i + 6].byte);
+        }
+        else if (s_wire[i].byte == 0x37 && i + 2 < n)
+        {
+            s_vsp = (uint16_t) ((s_wire[i + 1].byte << 8) | s_wire[i + 2].byte);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief  面板上屏幕第 y 行显示的显存行 (数据手册的定义，不经驱动的换算)
+ */
+static uint16_t Panel_Row(uint16_t y)
+{
+    if (y < s_tfa || y >= s_tfa + s_vsa)
+        return y;
+
+    uint16_t r = s_vsp + (y - s_tfa);
+    return (r >= s_tfa + s_vsa) ? r - s_vsa : r;
+}
+
+/**
+ * @brief  面板显示与预期不一致的行数
+ */
+static uint32_t Diff_Screen(void)
+{
+    uint32_t diff = 0;
+
+    for (uint16_t y = 0; y < TFT_LINE_NUMBER; y++)
+        diff += s_gram[Panel_Row(y)] != s_screen[y];
+    return diff;
+}
+
+/**
+ * @brief  按屏幕行号绘制一行 (经 ST7789_Scroll_Map_Row 换算到显存)
+ */
+static void Draw_Row(uint16_t y, uint16_t color)
+{
+    s_gram[ST7789_Scroll_Map_Row(y)] = color;
+    s_screen[y]                      = color;
+}
+
+/**
+ * @brief  VSCRDEF 六个参数字节与紧随其后的 VSCSAD 归零
+ */
+static void Test_Define_Bytes(void)
+{
+    uint8_t cmds[4];
+
+    Capture_Begin();
+    ST7789_Scroll_Define(20, 200);
+    TEST_CHECK_EQ(Capture_End(cmds), 2);
+    TEST_CHECK(cmds[0] == 0x33 && cmds[1] == 0x37);
+    TEST_CHECK_EQ(s_wire_n, 1 + 6 + 1 + 2);
+
+    // 20 / 200 / 100 (三者之和为 320)，高字节在前；VSP 为顶部固定区之后的第一行
+    static const uint8_t expect[] = {0x00, 20, 0x00, 200, 0x00, 100};
+    for (uint8_t i = 0; i < 6; i++)
+        TEST_CHECK_EQ(s_wire[1 + i].byte, expect[i]);
+    TEST_CHECK(s_wire[8].byte == 0x00 && s_wire[9].byte == 20);
+
+    // 超过 255 的参数用到高字节
+    Capture_Begin();
+    ST7789_Scroll_Define(0, 0); // 0 = 顶部固定区以下全部滚动
+    Capture_End(cmds);
+    TEST_CHECK(s_tfa == 0 && s_vsa == TFT_LINE_NUMBER && s_bfa == 0 && s_vsp == 0);
+    TEST_CHECK(s_wire[3].byte == (TFT_LINE_NUMBER >> 8));
+    TEST_CHECK(s_wire[4].byte == (TFT_LINE_NUMBER & 0xFF));
+
+    // 滚动区超出屏幕时截到屏幕底部；顶部固定区占满整屏时不发送
+    Capture_Begin();
+    ST7789_Scroll_Define(300, 100);
+    Capture_End(cmds);
+    TEST_CHECK(s_tfa == 300 && s_vsa == 20 && s_bfa == 0 && s_vsp == 300);
+
+    Capture_Begin();
+    ST7789_Scroll_Define(TFT_LINE_NUMBER, 10);
+    TEST_CHECK_EQ(Capture_End(cmds), 0);
+
+    ST7789_Scroll_Reset();
+}
+
+/**
+ * @brief  VSCSAD：每次推进只发两个参数字节，偏移越过滚动区末尾时回绕
+ */
+static void Test_Advance_Bytes(void)
+{
+    uint8_t  cmds[4];
+    uint16_t exposed;
+
+    Capture_Begin();
+    ST7789_Scroll_Define(20, 200);
+    Capture_End(cmds);
+
+    Capture_Begin();
+    exposed = ST7789_Scroll_Advance(150);
+    TEST_CHECK_EQ(Capture_End(cmds), 1);
+    TEST_CHECK_EQ(cmds[0], 0x37);
+    TEST_CHECK_EQ(s_wire_n, 3);
+    TEST_CHECK_EQ(exposed, 20);
+    TEST_CHECK_EQ(s_vsp, 20 + 150);
+
+    // 150 + 80 = 230 越过 200：VSP = 20 + 30
+    Capture_Begin();
+    exposed = ST7789_Scroll_Advance(80);
+    Capture_End(cmds);
+    TEST_CHECK_EQ(exposed, 20 + 150);
+    TEST_CHECK_EQ(s_vsp, 20 + 30);
+
+    // 0 行：不发送，返回当前滚动区顶部对应的显存行
+    Capture_Begin();
+    exposed = ST7789_Scroll_Advance(0);
+    TEST_CHECK_EQ(Capture_End(cmds), 0);
+    TEST_CHECK_EQ(exposed, 20 + 30);
+
+    // 超过滚动区高度按整个滚动区算：偏移不变
+    Capture_Begin();
+    exposed = ST7789_Scroll_Advance(1000);
+    TEST_CHECK_EQ(Capture_End(cmds), 1);
+    TEST_CHECK_EQ(exposed, 20 + 30);
+    TEST_CHECK_EQ(s_vsp, 20 + 30);
+
+    // 取消滚动：整屏为滚动区，VSP 归零
+    Capture_Begin();
+    ST7789_Scroll_Reset();
+    Capture_End(cmds);
+    TEST_CHECK(s_tfa == 0 && s_vsa == TFT_LINE_NUMBER && s_bfa == 0 && s_vsp == 0);
+}
+
+/**
+ * @brief  滚动日志：固定区不动，滚动区上移，新露出的行按 Map_Row 绘制后屏幕与预期一致
+ * @param  top, height: 滚动区定义
+ * @param  step:        每次推进的行数
+ * @param  steps:       推进次数 (累计超过滚动区高度，覆盖回绕)
+ */
+static void Test_Scroll_Log(uint16_t top, uint16_t height, uint16_t step, uint16_t steps)
+{
+    uint8_t  cmds[4];
+    uint16_t color  = 1;
+    uint32_t bad    = 0;
+    uint32_t mapped = 0;
+
+    Capture_Begin();
+    ST7789_Scroll_Define(top, height);
+    Capture_End(cmds);
+
+    // 初始画面：每一行一种颜色 (固定区与滚动区都有)
+    for (uint16_t y = 0; y < TFT_LINE_NUMBER; y++)
+        Draw_Row(y, color++);
+    TEST_CHECK_EQ(Diff_Screen(), 0);
+
+    for (uint16_t s = 0; s < steps; s++)
+    {
+        Capture_Begin();
+        uint16_t exposed = ST7789_Scroll_Advance(step);
+        Capture_End(cmds);
+
+        // 预期：滚动区内容上移 step 行，底部 step 行是新内容；固定区不变
+        for (uint16_t y = top; y + step < top + height; y++)
+            s_screen[y] = s_screen[y + step];
+
+        // 新露出的行从返回值开始，在滚动区末尾回绕
+        for (uint16_t i = 0; i < step; i++)
+        {
+            uint16_t y = top + height - step + i;
+
+            mapped += ST7789_Scroll_Map_Row(y) != top + (exposed - top + i) % height;
+            Draw_Row(y, color++);
+        }
+        bad += Diff_Screen();
+    }
+
+    // 固定区的行号不换算
+    for (uint16_t y = 0; y < top; y++)
+        mapped += ST7789_Scroll_Map_Row(y) != y;
+    for (uint16_t y = top + height; y < TFT_LINE_NUMBER; y++)
+        mapped += ST7789_Scroll_Map_Row(y) != y;
+
+    TEST_CHECK((uint32_t) step * steps > height); // 确实越过了一次回绕
+    TEST_CHECK_EQ(mapped, 0);
+    TEST_CHECK_EQ(bad, 0);
+
+    ST7789_Scroll_Reset();
+}
+
+int main(void)
+{
+    ST7789_Bus_Select(&g_test_bus);
+    ST7789_Init();
+
+    Test_Define_Bytes();
+    Test_Advance_Bytes();
+
+    Test_Scroll_Log(20, 200, 37, 7);                   // 顶部、底部都有固定区
+    Test_Scroll_Log(0, 300, 16, 25);                   // 只有底部固定区
+    Test_Scroll_Log(40, TFT_LINE_NUMBER - 40, 1, 300); // 只有顶部固定区，逐行推进
+    Test_Scroll_Log(0, TFT_LINE_NUMBER, 320, 2);       // 整屏滚动，一次推进整个滚动区
+
+    return Test_Summary("test_scroll");
+}
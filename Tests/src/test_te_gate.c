@@ -0,0 +1,197 @@
+/**
+ * @file    test_te_gate.c
+ * @brief   TE 帧同步测试：闸门放行、超时关闭同步、跨周期帧计数、生产者等待时提前放行
+ * @note    时钟冻结，只由 Test_Tick_Advance 推进；TE 脉冲由 ST7789_TE_Sim_Advance 产生。
+ */
+
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "st7789_pipe.h"
+#include "test_util.h"
+
+/**
+ * @brief  驱动轮询若干次 (不推进时间)
+ */
+static void Poll_N(uint32_t n)
+{
+    while (n--)
+        ST7789_Poll();
+}
+
+static uint32_t Emu_Pixels(void)
+{
+    ST7789_Emu_Stats_t st;
+    ST7789_Emu_Get_Stats(&st);
+    return st.pixels;
+}
+
+/**
+ * @brief  帧在闸门后面等待，直到下一个 TE 才发送
+ */
+static void Test_Gate_Release(void)
+{
+    ST7789_TE_Stats_t te;
+
+    ST7789_Emu_Reset_Stats();
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 200, 240, 40, RED);
+    ST7789_Frame_End();
+
+    Poll_N(100);
+    TEST_CHECK(ST7789_Is_Busy());
+    TEST_CHECK_EQ(Emu_Pixels(), 0);
+
+    ST7789_TE_Sim_Advance(ST7789_TE_SIM_PERIOD_US);
+    Poll_N(100);
+    TEST_CHECK(!ST7789_Is_Busy());
+    TEST_CHECK_EQ(Emu_Pixels(), 240 * 40);
+
+    ST7789_TE_Get_Stats(&te);
+    TEST_CHECK_EQ(te.te_count, 1);
+    TEST_CHECK_EQ(te.frames, 1);
+    TEST_CHECK_EQ(te.missed, 0);
+    TEST_CHECK_EQ(te.timeouts, 0);
+}
+
+/**
+ * @brief  放行之后、写完之前又来了 TE：计为跨周期帧
+ */
+static void Test_Missed_Frame(void)
+{
+    ST7789_TE_Stats_t before, after;
+
+    ST7789_TE_Get_Stats(&before);
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 200, 240, 40, GREEN);
+    ST7789_Frame_End();
+
+    ST7789_TE_Sim_Advance(ST7789_TE_SIM_PERIOD_US); // 放行，填充开始
+    ST7789_TE_Sim_Advance(ST7789_TE_SIM_PERIOD_US); // 仿真流传输要到 poll 才完成
+    Poll_N(100);
+
+    ST7789_TE_Get_Stats(&after);
+    TEST_CHECK_EQ(after.frames - before.frames, 1);
+    TEST_CHECK_EQ(after.missed - before.missed, 1);
+
+    // 下一帧在一个周期内写完：不计入
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 200, 240, 40, BLUE);
+    ST7789_Frame_End();
+    ST7789_TE_Sim_Advance(ST7789_TE_SIM_PERIOD_US);
+    Poll_N(100);
+
+    ST7789_TE_Get_Stats(&before);
+    TEST_CHECK_EQ(before.frames - after.frames, 1);
+    TEST_CHECK_EQ(before.missed, after.missed);
+}
+
+/**
+ * @brief  行缓冲管线等不到缓冲时提前放行，CPU 不空转到下一个 TE
+ * @note   时钟冻结且不产生 TE：如果没有提前放行，这里会一直忙等 (ctest 超时)
+ */
+static void Test_Pipe_Early_Release(void)
+{
+    ST7789_TE_Stats_t before, after;
+
+    ST7789_TE_Get_Stats(&before);
+    ST7789_Emu_Reset_Stats();
+    ST7789_Frame_Begin();
+
+    TEST_CHECK(ST7789_Pipe_Begin_Direct(0, 260, TFT_COLUMN_NUMBER, 20));
+    for (uint16_t row = 0; row < 20; row++)
+    {
+        uint16_t* line = ST7789_Pipe_Line();
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            line[x] = YELLOW;
+    }
+    ST7789_Pipe_End();
+    ST7789_Frame_End();
+    ST7789_Flush();
+
+    ST7789_TE_Get_Stats(&after);
+    TEST_CHECK_EQ(after.early - before.early, 1);
+    TEST_CHECK_EQ(after.timeouts, before.timeouts);
+    TEST_CHECK_EQ(after.te_count, before.te_count);
+    TEST_CHECK_EQ(Emu_Pixels(), TFT_COLUMN_NUMBER * 20);
+    TEST_CHECK_EQ(ST7789_Emu_Framebuffer()[279 * TFT_COLUMN_NUMBER + 239], YELLOW);
+}
+
+/**
+ * @brief  闸门后面排满队列：入队等待之前提前放行
+ */
+static void Test_Queue_Full_Early_Release(void)
+{
+    ST7789_TE_Stats_t before, after;
+
+    ST7789_TE_Get_Stats(&before);
+    ST7789_Frame_Begin();
+    for (uint16_t i = 0; i < ST7789_QUEUE_DEPTH * 2; i++)
+        ST7789_Queue_Fill(i, 200 + i, 1, 1, WHITE);
+    ST7789_Frame_End();
+    ST7789_Flush();
+
+    ST7789_TE_Get_Stats(&after);
+    TEST_CHECK_EQ(after.early - before.early, 1);
+    TEST_CHECK_EQ(after.timeouts, before.timeouts);
+}
+
+/**
+ * @brief  一直没有 TE：50ms 后放行并关闭同步，之后的帧立即发送
+ */
+static void Test_Timeout(void)
+{
+    ST7789_TE_Stats_t te;
+
+    ST7789_Emu_Reset_Stats();
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 300, 240, 20, CYAN);
+    ST7789_Frame_End();
+
+    Test_Tick_Advance(ST7789_TE_TIMEOUT_MS - 1);
+    Poll_N(100);
+    TEST_CHECK(ST7789_Is_Busy());
+
+    Test_Tick_Advance(1);
+    Poll_N(100);
+    TEST_CHECK(!ST7789_Is_Busy());
+    TEST_CHECK_EQ(Emu_Pixels(), 240 * 20);
+
+    ST7789_TE_Get_Stats(&te);
+    TEST_CHECK_EQ(te.timeouts, 1);
+
+    // 同步已关闭：Frame_Begin 不再入队闸门
+    ST7789_Emu_Reset_Stats();
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 300, 240, 20, MAGENTA);
+    ST7789_Frame_End();
+    Poll_N(100);
+    TEST_CHECK(!ST7789_Is_Busy());
+    TEST_CHECK_EQ(Emu_Pixels(), 240 * 20);
+
+    // 重新打开同步后闸门恢复
+    ST7789_TE_Sync(1);
+    ST7789_Frame_Begin();
+    ST7789_Queue_Fill(0, 300, 240, 20, RED);
+    ST7789_Frame_End();
+    Poll_N(100);
+    TEST_CHECK(ST7789_Is_Busy());
+    ST7789_TE_Sim_Advance(ST7789_TE_SIM_PERIOD_US);
+    Poll_N(100);
+    TEST_CHECK(!ST7789_Is_Busy());
+}
+
+int main(void)
+{
+    ST7789_Init();
+    ST7789_TE_Init(ST7789_TE_SCANLINE);
+    ST7789_Flush();
+    Test_Tick_Freeze(1);
+
+    Test_Gate_Release();
+    Test_Missed_Frame();
+    Test_Pipe_Early_Release();
+    Test_Queue_Full_Early_Release();
+    Test_Timeout();
+
+    return Test_Summary("test_te_gate");
+}
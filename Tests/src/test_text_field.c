@@ -0,0 +1,267 @@
+/**
+ * @file    test_text_field.c
+ * @brief   差分文本框测试：每种更新的屏幕结果与整串绘制一致，且只发送变化的字
+ * @note    文本框画在瓦片区下方，另一块区域用 LCD_Show_String 在清空的背景上整串绘制作为参照，
+ *          两块区域逐像素比对。每次更新的窗口数取仿真统计的 RAMWR 次数，像素数即发送的像素。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "lcd_text_field.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_util.h"
+#include <stddef.h>
+
+#define FIELD_X 10
+#define FIELD_Y 140 // 瓦片区下方
+#define REF_Y   230 // 参照绘制
+#define AREA_H  80  // 比对的行数 (两行 20 点阵 + 余量)
+
+static LCD_Text_Field_t s_field;
+
+/**
+ * @brief 一次更新的传输开销
+ */
+typedef struct
+{
+    uint32_t windows;
+    uint32_t pixels;
+} Update_Cost_t;
+
+/**
+ * @brief  清空文本框与参照区，重新初始化文本框
+ */
+static void Setup(const font_info_t* font)
+{
+    TFT_Fill_Rect_DMA(0, FIELD_Y, TFT_COLUMN_NUMBER, TFT_LINE_NUMBER - FIELD_Y, BLACK);
+    ST7789_Flush();
+    LCD_Text_Field_Init(&s_field, FIELD_X, FIELD_Y, font, WHITE, BLACK);
+}
+
+/**
+ * @brief  更新文本框并统计这一次的窗口数与像素数
+ */
+static Update_Cost_t Set(const char* text)
+{
+    ST7789_Emu_Stats_t st;
+    Update_Cost_t      cost;
+
+    ST7789_Flush();
+    ST7789_Emu_Reset_Stats();
+    LCD_Text_Field_Set(&s_field, text);
+    ST7789_Flush();
+    ST7789_Emu_Get_Stats(&st);
+
+    cost.windows = st.windows;
+    cost.pixels  = st.pixels;
+    return cost;
+}
+
+/**
+ * @brief  文本框区域与在空白背景上整串绘制的结果逐像素比较
+ * @retval 不一致的像素数
+ */
+static uint32_t Diff_Reference(const char* text)
+{
+    const uint16_t* fb   = ST7789_Emu_Framebuffer();
+    uint32_t        diff = 0;
+
+    TFT_Fill_Rect_DMA(0, REF_Y, TFT_COLUMN_NUMBER, AREA_H, BLACK);
+    LCD_Show_String(FIELD_X, REF_Y, text, s_field.font, WHITE, BLACK);
+    ST7789_Flush();
+
+    for (uint16_t y = 0; y < AREA_H; y++)
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            diff += fb[(FIELD_Y + y) * TFT_COLUMN_NUMBER + x] !=
+                    fb[(REF_Y + y) * TFT_COLUMN_NUMBER + x];
+    return diff;
+}
+
+/**
+ * @brief  30x60 时钟：12:59 -> 13:00 只重画两段 (冒号不动)
+ */
+static void Test_Clock_Rollover(void)
+{
+    Update_Cost_t c;
+
+    Setup(&font_time_30x60);
+    c = Set("12:59");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, 5 * 30 * 60);
+    TEST_CHECK_EQ(Diff_Reference("12:59"), 0);
+
+    c = Set("13:00");
+    TEST_CHECK_EQ(c.windows, 2); // "3" 与 "00"
+    TEST_CHECK_EQ(c.pixels, 3 * 30 * 60);
+    TEST_CHECK_EQ(Diff_Reference("13:00"), 0);
+
+    // 内容不变：不发送任何东西
+    c = Set("13:00");
+    TEST_CHECK_EQ(c.windows, 0);
+    TEST_CHECK_EQ(c.pixels, 0);
+}
+
+/**
+ * @brief  秒：每秒只有个位变化，进位时两位都变
+ */
+static void Test_Seconds(void)
+{
+    Update_Cost_t c;
+
+    Setup(&font_time_20);
+    Set("58");
+    c = Set("59");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, 10 * 20);
+    TEST_CHECK_EQ(Diff_Reference("59"), 0);
+
+    c = Set("00");
+    TEST_CHECK_EQ(c.windows, 1); // 两个相邻的字合并为一段
+    TEST_CHECK_EQ(c.pixels, 2 * 10 * 20);
+    TEST_CHECK_EQ(Diff_Reference("00"), 0);
+}
+
+/**
+ * @brief  新文字变短时擦掉多出来的一条，变长时只画新增的字
+ */
+static void Test_Shorter_Longer(void)
+{
+    Update_Cost_t c;
+
+    Setup(&font_time_20);
+    Set("12日31星");
+    TEST_CHECK_EQ(Diff_Reference("12日31星"), 0);
+
+    // 前缀不变、去掉两个字：只擦除尾部 (10 + 20 列)
+    c = Set("12日3");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, (10 + 20) * 20);
+    TEST_CHECK_EQ(Diff_Reference("12日3"), 0);
+
+    // 首字变化且变短：一段重画加一次擦除
+    c = Set("1日");
+    TEST_CHECK_EQ(c.windows, 2);
+    TEST_CHECK_EQ(c.pixels, 20 * 20 + (10 + 10) * 20);
+    TEST_CHECK_EQ(Diff_Reference("1日"), 0);
+
+    // 变长：前两个字不动，只画新增的字
+    c = Set("1日1星");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, (10 + 20) * 20);
+    TEST_CHECK_EQ(Diff_Reference("1日1星"), 0);
+
+    // 变成空串：整条擦掉
+    c = Set("");
+    TEST_CHECK_EQ(c.pixels, (10 + 20 + 10 + 20) * 20);
+    TEST_CHECK_EQ(Diff_Reference(""), 0);
+}
+
+/**
+ * @brief  比例字体：一个字变宽时后面的字位置改变，一起重画
+ */
+static void Test_Proportional(void)
+{
+    Update_Cost_t c;
+    uint16_t      w_1, w_4;
+
+    LCD_Measure_String("1", &font_16_prop, &w_1, NULL);
+    LCD_Measure_String("4", &font_16_prop, &w_4, NULL);
+    TEST_CHECK(w_4 > w_1);
+
+    Setup(&font_16_prop);
+    Set("11:11");
+
+    // 第 4 个字变宽：它和被挤开的第 5 个字合并为一段，不需要擦除
+    c = Set("11:41");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, (w_4 + w_1) * 16);
+    TEST_CHECK_EQ(Diff_Reference("11:41"), 0);
+
+    // 变回去：同样的两个字重画，再擦掉右边空出的 w_4 - w_1 列
+    c = Set("11:11");
+    TEST_CHECK_EQ(c.windows, 2);
+    TEST_CHECK_EQ(c.pixels, (2 * w_1 + (w_4 - w_1)) * 16);
+    TEST_CHECK_EQ(Diff_Reference("11:11"), 0);
+
+    // 宽度相同的字互换 ('4' 与 '5')：只画这一个字
+    Set("11:41");
+    c = Set("11:51");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, w_4 * 16);
+    TEST_CHECK_EQ(Diff_Reference("11:51"), 0);
+}
+
+/**
+ * @brief  失效后整串重画；换行与超出容量时退回整串重画，行高变化时先擦掉旧区域
+ */
+static void Test_Full_Redraw(void)
+{
+    Update_Cost_t c;
+    uint16_t      w_1;
+    char          many[LCD_TEXT_FIELD_MAX_GLYPHS + 2];
+
+    Setup(&font_time_20);
+    Set("10-30");
+
+    // 文字被别的绘制盖掉后失效：相同内容也整串重画
+    TFT_Fill_Rect_DMA(FIELD_X, FIELD_Y, 5 * 10, 20, BLUE);
+    LCD_Text_Field_Invalidate(&s_field);
+    c = Set("10-30");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, 5 * 10 * 20);
+    TEST_CHECK_EQ(Diff_Reference("10-30"), 0);
+
+    // 含换行：行高变为两行，先擦掉旧文字，再逐行整串绘制 (每行一段)
+    c = Set("10\n30");
+    TEST_CHECK_EQ(c.windows, 1 + 2);
+    TEST_CHECK_EQ(c.pixels, 5 * 10 * 20 + 2 * 2 * 10 * 20);
+    TEST_CHECK_EQ(Diff_Reference("10\n30"), 0);
+
+    // 回到单行：擦掉旧的两行区域 (宽为最宽的一行)，再整串绘制
+    c = Set("10-31");
+    TEST_CHECK_EQ(c.windows, 2);
+    TEST_CHECK_EQ(c.pixels, 2 * 10 * 40 + 5 * 10 * 20);
+    TEST_CHECK_EQ(Diff_Reference("10-31"), 0);
+
+    // 超过最大字数：每次都整串重画，之后变短时全部重画并擦掉尾部
+    LCD_Measure_String("1", &font_16_prop, &w_1, NULL);
+    for (uint8_t i = 0; i <= LCD_TEXT_FIELD_MAX_GLYPHS; i++)
+        many[i] = '1';
+    many[LCD_TEXT_FIELD_MAX_GLYPHS + 1] = '\0';
+
+    Setup(&font_16_prop);
+    Set("1");
+    c = Set(many);
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(c.pixels, (LCD_TEXT_FIELD_MAX_GLYPHS + 1) * w_1 * 16);
+    c = Set(many);
+    TEST_CHECK_EQ(c.windows, 1); // 没有逐字记录，无法跳过
+    TEST_CHECK_EQ(Diff_Reference(many), 0);
+
+    c = Set("11");
+    TEST_CHECK_EQ(c.windows, 2);
+    TEST_CHECK_EQ(c.pixels, (LCD_TEXT_FIELD_MAX_GLYPHS + 1) * w_1 * 16);
+    TEST_CHECK_EQ(Diff_Reference("11"), 0);
+
+    // 超过缓冲字节数 (汉字 3 字节)：同样整串重画
+    c = Set("一二三四五六七八九十一");
+    TEST_CHECK_EQ(c.windows, 1);
+    TEST_CHECK_EQ(Diff_Reference("一二三四五六七八九十一"), 0);
+    c = Set("11");
+    TEST_CHECK_EQ(c.windows, 2);
+    TEST_CHECK_EQ(Diff_Reference("11"), 0);
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_Clock_Rollover();
+    Test_Seconds();
+    Test_Shorter_Longer();
+    Test_Proportional();
+    Test_Full_Redraw();
+
+    return Test_Summary("test_text_field");
+}
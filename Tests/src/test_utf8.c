@@ -0,0 +1,314 @@
+/**
+ * @file    test_utf8.c
+ * @brief   UTF-8 解码与码点查找测试：逐条查表、未收录码点、非法/截断序列的占位块
+ * @note    HZK_16_Code 与 HZK_Week_20_Code 的每一项 (含首尾) 都用测试自己的编码器转成 UTF-8，
+ *          解码后查到的序号必须就是表中的位置，上屏结果与对应字模逐像素一致。
+ *          非法序列按表格列出输入与预期：预期串中的 '#' 表示一个占位块 (汉字点阵大小的红色方块)，
+ *          其余字符照常绘制；参照区按预期串逐格画出后与被测字符串的绘制结果逐像素比对。
+ */
+
+#include "font_variable.h"
+#include "lcd_font.h"
+#include "st7789.h"
+#include "st7789_bus.h"
+#include "test_util.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEXT_Y 140 // 被测绘制 (瓦片区下方)
+#define REF_Y  200 // 参照绘制
+#define AREA_H 24  // 比对的行数
+
+#define MISSING_COLOR 0xF800 // 与 lcd_font.c 的 LCD_MISSING_COLOR 一致
+#define TEXT_FG       WHITE
+#define TEXT_BG       BLUE
+
+/**
+ * @brief  码点编码为 UTF-8 (测试自己的编码器，不经被测代码)
+ * @retval 字节数
+ */
+static uint8_t Encode(uint32_t cp, char* out)
+{
+    uint8_t n;
+
+    if (cp < 0x80)
+    {
+        out[0] = (char) cp;
+        n      = 1;
+    }
+    else if (cp < 0x800)
+    {
+        out[0] = (char) (0xC0 | (cp >> 6));
+        out[1] = (char) (0x80 | (cp & 0x3F));
+        n      = 2;
+    }
+    else if (cp < 0x10000)
+    {
+        out[0] = (char) (0xE0 | (cp >> 12));
+        out[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char) (0x80 | (cp & 0x3F));
+        n      = 3;
+    }
+    else
+    {
+        out[0] = (char) (0xF0 | (cp >> 18));
+        out[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char) (0x80 | (cp & 0x3F));
+        n      = 4;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+/**
+ * @brief  两块区域中不一致的像素数
+ */
+static uint32_t Diff_Rows(void)
+{
+    const uint16_t* fb   = ST7789_Emu_Framebuffer();
+    uint32_t        diff = 0;
+
+    for (uint16_t y = 0; y < AREA_H; y++)
+        for (uint16_t x = 0; x < TFT_COLUMN_NUMBER; x++)
+            diff += fb[(TEXT_Y + y) * TFT_COLUMN_NUMBER + x] !=
+                    fb[(REF_Y + y) * TFT_COLUMN_NUMBER + x];
+    return diff;
+}
+
+/**
+ * @brief  清空被测区与参照区
+ */
+static void Clear(void)
+{
+    TFT_Fill_Rect_DMA(0, TEXT_Y, TFT_COLUMN_NUMBER, AREA_H, BLACK);
+    TFT_Fill_Rect_DMA(0, REF_Y, TFT_COLUMN_NUMBER, AREA_H, BLACK);
+}
+
+// ====================================================================
+// 码点表
+// ====================================================================
+
+/**
+ * @brief  码点表的每一项：解码、查表得到自己的序号，上屏与字模逐像素一致
+ */
+static void Test_Code_Table(const char* name, const font_info_t* font)
+{
+    const uint16_t* fb     = ST7789_Emu_Framebuffer();
+    uint8_t         stride = (font->cn_w + 7) / 8;
+    uint32_t        found = 0, decoded = 0, bad = 0, ordered = 0;
+
+    TEST_CHECK(font->hzk_count > 1 && font->hzk_glyph != NULL);
+
+    for (uint16_t i = 0; i < font->hzk_count; i++)
+    {
+        uint32_t cp = font->hzk_code[i];
+        uint32_t got;
+        char     utf8[5];
+        uint8_t  n = Encode(cp, utf8);
+
+        ordered += (i > 0 && font->hzk_code[i - 1] >= cp); // 二分查找要求严格升序
+        decoded += (LCD_UTF8_Decode(utf8, &got) != n || got != cp) && n > 1;
+        found += LCD_Find_Code(font, cp) != i;
+
+        // 码点 < 0x80 的条目 (如 hzk16 的 '~') 查得到，但绘制时走 ASCII 字模
+        if (n == 1)
+            continue;
+
+        LCD_Show_String(0, TEXT_Y, utf8, font, TEXT_FG, TEXT_BG);
+        ST7789_Flush();
+
+        const uint8_t* glyph = font->hzk_glyph + (uint32_t) i * font->hzk_data_size;
+        for (uint16_t r = 0; r < font->cn_h; r++)
+        {
+            for (uint16_t c = 0; c < font->cn_w; c++)
+            {
+                uint8_t  bit    = (glyph[r * stride + c / 8] >> (c % 8)) & 1; // LSB First
+                uint16_t expect = bit ? TEXT_FG : TEXT_BG;
+                bad += fb[(TEXT_Y + r) * TFT_COLUMN_NUMBER + c] != expect;
+            }
+        }
+    }
+
+    printf("  %s: %u codes (U+%04X .. U+%04X), %u mismatched pixels\n",
+           name,
+           font->hzk_count,
+           font->hzk_code[0],
+           font->hzk_code[font->hzk_count - 1],
+           bad);
+    TEST_CHECK_EQ(ordered, 0);
+    TEST_CHECK_EQ(decoded, 0);
+    TEST_CHECK_EQ(found, 0);
+    TEST_CHECK_EQ(bad, 0);
+
+    // 首尾两项单独再查一次
+    TEST_CHECK_EQ(LCD_Find_Code(font, font->hzk_code[0]), 0);
+    TEST_CHECK_EQ(LCD_Find_Code(font, font->hzk_code[font->hzk_count - 1]), font->hzk_count - 1);
+}
+
+/**
+ * @brief  未收录的码点：首项之前、末项之后、相邻两项之间、超出 BMP
+ */
+static void Test_Absent(const font_info_t* font)
+{
+    const uint16_t* code  = font->hzk_code;
+    uint16_t        count = font->hzk_count;
+    uint32_t        gaps  = 0;
+
+    TEST_CHECK_EQ(LCD_Find_Code(font, 0), -1);
+    TEST_CHECK_EQ(LCD_Find_Code(font, code[0] - 1), -1);
+    TEST_CHECK_EQ(LCD_Find_Code(font, code[count - 1] + 1), -1);
+    TEST_CHECK_EQ(LCD_Find_Code(font, 0xFFFF), -1);
+    TEST_CHECK_EQ(LCD_Find_Code(font, 0x10000 + code[0]), -1); // 低 16 位相同也不能命中
+    TEST_CHECK_EQ(LCD_Find_Code(font, 0x1F600), -1);
+
+    for (uint16_t i = 0; i + 1 < count; i++)
+    {
+        if (code[i] + 1 < code[i + 1])
+        {
+            gaps += LCD_Find_Code(font, code[i] + 1) != -1;
+            gaps += LCD_Find_Code(font, code[i + 1] - 1) != -1;
+        }
+    }
+    TEST_CHECK_EQ(gaps, 0);
+}
+
+// ====================================================================
+// 解码
+// ====================================================================
+
+/**
+ * @brief 解码表：输入字节、消耗的字节数、码点 (非法为 0)
+ */
+static const struct
+{
+    const char* bytes;
+    uint8_t     len;
+    uint32_t    cp;
+} s_decode[] = {
+    {"\xC2\x80", 2, 0x80},                // 2 字节最小
+    {"\xDF\xBF", 2, 0x7FF},               // 2 字节最大
+    {"\xE0\xA0\x80", 3, 0x800},           // 3 字节最小
+    {"\xE6\x97\xA5", 3, 0x65E5},          // 日
+    {"\xEF\xBF\xBF", 3, 0xFFFF},          // 3 字节最大
+    {"\xF0\x9F\x98\x80", 4, 0x1F600},     // 4 字节 (超出 BMP)
+    {"\xC0\x80", 2, 0},                   // 过长编码：按解出的码点处理
+    {"\xC1\xBE", 2, 0x7E},                // 过长编码的 '~'
+    {"\x80", 1, 0},                       // 孤立的后续字节
+    {"\xBF", 1, 0},
+    {"\xF8\x88\x80\x80\x80", 1, 0},       // 5 字节首字节
+    {"\xFF", 1, 0},                       // 非法首字节
+    {"\xC3", 1, 0},                       // 截断在 '\0'
+    {"\xE6\x97", 1, 0},                   // 3 字节少一个
+    {"\xF0\x9F\x98", 1, 0},               // 4 字节少一个
+    {"\xE6" "A" "\xA5", 1, 0},            // 后续字节位置是 ASCII
+    {"\xE6\x97\xE6\x97\xA5", 1, 0},       // 后续字节位置是新的首字节
+    {"\x01", 1, 0},                       // 控制字符
+    {"\x7F", 1, 0},                       // DEL
+};
+
+static void Test_Decode(void)
+{
+    for (uint8_t i = 0; i < sizeof(s_decode) / sizeof(s_decode[0]); i++)
+    {
+        uint32_t cp  = 0xDEADBEEF;
+        uint8_t  len = LCD_UTF8_Decode(s_decode[i].bytes, &cp);
+
+        if (!TEST_CHECK_EQ(len, s_decode[i].len) || !TEST_CHECK_EQ(cp, s_decode[i].cp))
+            printf("  decode case %u\n", i);
+    }
+}
+
+// ====================================================================
+// 上屏：非法序列逐字节跳过，每个跳过的字节画一个占位块
+// ====================================================================
+
+/**
+ * @brief 绘制表：被测字符串与预期 ('#' = 一个占位块)
+ */
+static const struct
+{
+    const char* str;
+    const char* expect;
+} s_render[] = {
+    {"1\xE6\x97" "2", "1##2"},                       // 截断的 "日"：首字节与后续字节各一个占位块
+    {"\xE6\x97", "##"},                              // 截断在字符串末尾
+    {"\x80" "1", "#1"},                              // 孤立的后续字节
+    {"\xFF\xFE" "1", "##1"},                         // 非法首字节
+    {"\xF8\x88\x80\x80\x80", "#####"},               // 5 字节序列：逐字节跳过
+    {"\xE4\xB8" "\xE4\xB8\x80", "##\xE4\xB8\x80"},   // 截断之后的完整字符正常显示 ("一")
+    {"\xF0\x9F\x98\x80" "1", "#1"},                  // 合法但超出 BMP：整个字符一个占位块
+    {"\xC0\x80" "1", "#1"},                          // 过长编码：整个序列一个占位块
+    {"\x01\x7F", "##"},                              // 控制字符与 DEL
+    {"\xE6\x9C\x88", "#"},                           // 未收录的 "月"
+};
+
+/**
+ * @brief  按预期串逐格画出参照：'#' 画占位块，其余字符照常绘制
+ * @retval 总宽度
+ */
+static uint16_t Draw_Expect(const char* expect, const font_info_t* font)
+{
+    uint16_t x = 0;
+
+    while (*expect)
+    {
+        if (*expect == '#')
+        {
+            TFT_Fill_Rect_DMA(x, REF_Y, font->cn_w, font->cn_h, MISSING_COLOR);
+            x += font->cn_w;
+            expect++;
+            continue;
+        }
+
+        // 一个字符 (ASCII 或合法的 UTF-8 多字节序列)
+        char     one[5];
+        uint32_t cp;
+        uint8_t  n = (*expect & 0x80) ? LCD_UTF8_Decode(expect, &cp) : 1;
+        uint16_t w;
+
+        memcpy(one, expect, n);
+        one[n] = '\0';
+        LCD_Show_String(x, REF_Y, one, font, TEXT_FG, TEXT_BG);
+        LCD_Measure_String(one, font, &w, NULL);
+        x += w;
+        expect += n;
+    }
+    return x;
+}
+
+static void Test_Render(const font_info_t* font)
+{
+    for (uint8_t i = 0; i < sizeof(s_render) / sizeof(s_render[0]); i++)
+    {
+        uint16_t w, expect_w;
+        uint32_t diff;
+
+        Clear();
+        LCD_Show_String(0, TEXT_Y, s_render[i].str, font, TEXT_FG, TEXT_BG);
+        expect_w = Draw_Expect(s_render[i].expect, font);
+        ST7789_Flush();
+        LCD_Measure_String(s_render[i].str, font, &w, NULL);
+
+        diff = Diff_Rows();
+        if (!TEST_CHECK_EQ(diff, 0) || !TEST_CHECK_EQ(w, expect_w))
+            printf("  render case %u (\"%s\")\n", i, s_render[i].expect);
+    }
+}
+
+int main(void)
+{
+    ST7789_Init();
+
+    Test_Decode();
+
+    Test_Code_Table("HZK_16_Code", &font_16);
+    Test_Code_Table("HZK_Week_20_Code", &font_time_20);
+    Test_Absent(&font_16);
+    Test_Absent(&font_time_20);
+
+    Test_Render(&font_16);
+    Test_Render(&font_time_20);
+
+    return Test_Summary("test_utf8");
+}
@@ -0,0 +1,157 @@
+/**
+ * @file    test_util.c
+ * @brief   主机测试公共工具实现
+ */
+
+#include "test_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ST7789_BUS_EMU
+#include "st7789.h"
+#include "st7789_bus.h"
+#endif
+
+#define TEST_MAX_REPORTS 20 // 最多打印的失败条数 (大循环里的失败只计数)
+
+static uint32_t s_test_checks = 0;
+static uint32_t s_test_failed = 0;
+
+// ====================================================================
+// 私有函数
+// ====================================================================
+
+/**
+ * @brief  记录失败并在未超过上限时打印位置 (私有)
+ */
+static int Test_Fail(const char* file, int line)
+{
+    s_test_failed++;
+    if (s_test_failed <= TEST_MAX_REPORTS)
+        printf("  FAIL %s:%d: ", file, line);
+    return s_test_failed <= TEST_MAX_REPORTS;
+}
+
+#ifdef ST7789_BUS_EMU
+/**
+ * @brief  读入整个文件 (私有)
+ * @retval 缓冲区 (调用方 free)，失败返回 NULL
+ */
+static uint8_t* Test_Read_File(const char* path, long* size)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp)
+        return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    uint8_t* buf = malloc(*size > 0 ? *size : 1);
+    if (buf && fread(buf, 1, *size, fp) != (size_t) *size)
+    {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(fp);
+    return buf;
+}
+#endif
+
+// ====================================================================
+// 对外接口
+// ====================================================================
+int Test_Check(int ok, const char* expr, const char* file, int line)
+{
+    s_test_checks++;
+    if (!ok && Test_Fail(file, line))
+        printf("%s\n", expr);
+    return ok;
+}
+
+int Test_Check_Eq(
+    long long a, long long b, const char* ea, const char* eb, const char* file, int line)
+{
+    s_test_checks++;
+    if (a != b && Test_Fail(file, line))
+        printf("%s == %s (%lld != %lld)\n", ea, eb, a, b);
+    return a == b;
+}
+
+int Test_Summary(const char* name)
+{
+    printf("%s: %u checks, %u failed\n", name, s_test_checks, s_test_failed);
+    return s_test_failed ? 1 : 0;
+}
+
+#ifdef ST7789_BUS_EMU
+int Test_Golden_PPM(const char* name)
+{
+    char out_path[512], golden_path[512];
+    snprintf(out_path, sizeof(out_path), "%s/%s.ppm", TEST_OUTPUT_DIR, name);
+    snprintf(golden_path, sizeof(golden_path), "%s/%s.ppm", TEST_GOLDEN_DIR, name);
+
+    s_test_checks++;
+    if (ST7789_Emu_Dump_PPM(out_path) != 0)
+    {
+        if (Test_Fail(__FILE__, __LINE__))
+            printf("cannot write %s\n", out_path);
+        return 0;
+    }
+
+    const char* update = getenv("UPDATE_GOLDEN");
+    if (update && update[0] == '1')
+    {
+        rename(out_path, golden_path);
+        printf("  updated %s\n", golden_path);
+        return 1;
+    }
+
+    long     out_size = 0, golden_size = 0;
+    uint8_t* out    = Test_Read_File(out_path, &out_size);
+    uint8_t* golden = Test_Read_File(golden_path, &golden_size);
+    int      ok     = 0;
+
+    if (!golden)
+    {
+        if (Test_Fail(__FILE__, __LINE__))
+            printf("missing golden %s (run with UPDATE_GOLDEN=1)\n", golden_path);
+    }
+    else if (!out || out_size != golden_size)
+    {
+        if (Test_Fail(__FILE__, __LINE__))
+            printf("%s: size %ld != golden %ld\n", name, out_size, golden_size);
+    }
+    else
+    {
+        // P6 头之后每 3 字节一个像素，统计不同的像素数并报告第一个位置
+        long     header = out_size - (long) TFT_COLUMN_NUMBER * TFT_LINE_NUMBER * 3;
+        uint32_t diff   = 0;
+        long     first  = -1;
+
+        for (long i = header; i < out_size; i += 3)
+        {
+            if (memcmp(out + i, golden + i, 3) != 0)
+            {
+                if (first < 0)
+                    first = (i - header) / 3;
+                diff++;
+            }
+        }
+
+        ok = (diff == 0 && memcmp(out, golden, header) == 0);
+        if (!ok && Test_Fail(__FILE__, __LINE__))
+            printf("%s: %u pixels differ, first at (%ld, %ld), see %s\n",
+                   name,
+                   diff,
+                   first % TFT_COLUMN_NUMBER,
+                   first / TFT_COLUMN_NUMBER,
+                   out_path);
+    }
+
+    free(out);
+    free(golden);
+    return ok;
+}
+#endif
@@ -2,6 +2,7 @@
 #include "BSP_Tick_Delay.h"
 #include "bsp_rtc.h"
 #include "ui_main_page.h"
+#include "app_ui.h"
 #include <stdint.h>
 
 // 记录上一次显示的秒数 (初始化为无效值 60，确保第一次一定刷新)
@@ -10,6 +11,10 @@ static uint32_t s_poll_tick = 0; // 用 uint32_t，跟系统滴答匹配
 
 void APP_Calendar_Task(void)
 {
+    // 开机画面期间不画主页面，就绪后 s_last_sec 仍是无效值，第一轮必定刷新
+    if (!APP_UI_Is_Ready())
+        return;
+
     // 策略优化：高频轮询 (每 50ms 检查一次)
     // 目的：一旦 RTC 硬件跳秒，屏幕能立刻跟上，减少视觉延迟
     if (BSP_GetTick_ms() - s_poll_tick > 50)
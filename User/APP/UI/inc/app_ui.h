@@ -11,6 +11,7 @@
 #define __APP_UI_H
 
 #include "app_data.h" // 引用通用数据结构
+#include <stdbool.h>
 #include <stdint.h>
 
 /* ==================================================================
@@ -19,13 +20,21 @@
 
 /**
  * @brief  UI 模块初始化
- * @note   负责绘制静态的背景框架（分割线、标签等）。
- *         此函数应在系统启动时调用一次，依赖 ST7789_Init() 已完成。
- *         初始化后屏幕进入待更新状态，全屏DMA清背景一次，包括开机屏显示 2s + 主页面框架。
+ * @note   只启动屏幕的非阻塞初始化 (ST7789_Init_Start) 就返回，应在系统启动时尽早调用一次。
+ *         之后由 APP_UI_Task() 推进：屏幕就绪 -> 开机画面 (UI_SPLASH_MS) -> 主页面框架，
+ *         期间 RTC 初始化、ESP32 复位等照常进行。
  * @retval None
  */
 void APP_UI_Init(void);
 
+/**
+ * @brief  主页面是否已经就绪
+ * @note   开机阶段 (屏幕初始化、开机画面) 返回 false，此时其他模块不应直接绘制主页面。
+ *         APP_UI_ShowStatus() 例外：开机阶段的状态文字会暂存，主页面就绪后补画最后一条。
+ * @retval true: 主页面已绘制
+ */
+bool APP_UI_Is_Ready(void);
+
 /**
  * @brief  刷新天气数据（动态内容）
  * @note   根据传入的天气数据，更新屏幕上对应的显示区域。
@@ -46,4 +55,13 @@ void APP_UI_Update(const APP_Weather_Data_t* data);
  */
 void APP_UI_ShowStatus(const char* status, uint16_t color);
 
+/**
+ * @brief  UI 周期任务
+ * @note   在主循环中调用：开机阶段推进屏幕初始化与开机画面；
+ *         之后把本轮各模块写入瓦片层的改动合并后推送到屏幕。
+ *         同一轮内重叠的更新 (如状态文字与 WiFi 图标) 只传输一次。
+ * @retval None
+ */
+void APP_UI_Task(void);
+
 #endif /* __APP_UI_H */
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "BSP_Tick_Delay.h"
 #include "lcd_image.h"
 #include "st7789.h"
+#include "st7789_tile.h"
+#include "st7789_fb8.h"
 #include "app_ui_config.h"
 #include "sys_log.h"
 #include "bsp_rtc.h"
@@ -11,32 +13,89 @@
 #include "ui_main_page.h"
 #include <string.h>
 
-static uint8_t s_last_status_len = 0; // 上个状态文字的长度，用于覆盖刷新
+static void APP_UI_Flush(void);
+
+// 上个状态文字占用的像素尺寸，新文字较短时只擦除多出来的部分
+static uint16_t s_last_status_w = 0;
+static uint16_t s_last_status_h = 0;
+
+/**
+ * @brief 开机阶段
+ */
+typedef enum
+{
+    UI_BOOT_LCD_INIT = 0, // 屏幕上电序列执行中
+    UI_BOOT_SPLASH,       // 开机画面停留中
+    UI_BOOT_READY,        // 主页面已绘制
+} UI_Boot_State_e;
+
+static UI_Boot_State_e s_boot_state = UI_BOOT_LCD_INIT;
+static uint32_t        s_splash_ms  = 0; // 开机画面上屏时刻
+
+// 开机阶段暂存的最后一条状态文字
+static char     s_pending_status[32] = {0};
+static uint16_t s_pending_color      = 0;
 
 /**
  * @brief  系统开机界面
- * @note   负责初始化 LCD 硬件驱动，清屏，展示整个系统的开机界面。
+ * @note   屏幕初始化完成后调用：展示开机界面，并打印从复位到首个像素的耗时。
  * @retval None
  */
 static void APP_Start_UP(void)
 {
-    // 1. ST7789 底层初始化
-    ST7789_Init();
+    ST7789_TE_Init(ST7789_TE_SCANLINE); // 之后的帧都从 TE 脉冲开始发送，避免撕裂
 
-    // 2. 显示开机界面
     LCD_Show_Image(0, 0, 240, 320, gImage_Startup_Screen);
+    APP_UI_Flush(); // 合成层接管的部分立即上屏
+    ST7789_Flush();
 
-    // 3. 延时2s
-    BSP_Delay_ms(2000);
+    s_splash_ms = (uint32_t) BSP_GetTick_ms();
+    LOG_I("[UI] Splash on screen at %dms after reset", (int) s_splash_ms);
+}
+
+/**
+ * @brief  推进开机流程 (私有)
+ * @retval true: 主页面已就绪
+ */
+static bool APP_UI_Boot_Step(void)
+{
+    switch (s_boot_state)
+    {
+    case UI_BOOT_LCD_INIT:
+        if (ST7789_Init_Poll())
+        {
+            LOG_I("[UI] LCD ready at %dms after reset", (int) BSP_GetTick_ms());
+            APP_Start_UP();
+            s_boot_state = UI_BOOT_SPLASH;
+        }
+        return false;
+
+    case UI_BOOT_SPLASH:
+        if ((uint32_t) BSP_GetTick_ms() - s_splash_ms < UI_SPLASH_MS)
+            return false;
+
+        APP_UI_MainPage_Init();
+        s_boot_state = UI_BOOT_READY;
+
+        if (s_pending_status[0])
+            APP_UI_ShowStatus(s_pending_status, s_pending_color);
+        return true;
+
+    default:
+        return true;
+    }
 }
 
 void APP_UI_Init(void)
 {
-    // 1. 启动开机界面
-    APP_Start_UP();
+    // 屏幕上电序列在后台推进，由 APP_UI_Task() 接力
+    s_boot_state = UI_BOOT_LCD_INIT;
+    ST7789_Init_Start();
+}
 
-    // 2. 调用主页面初始化
-    APP_UI_MainPage_Init();
+bool APP_UI_Is_Ready(void)
+{
+    return s_boot_state == UI_BOOT_READY;
 }
 
 void APP_UI_Update(const APP_Weather_Data_t* data)
@@ -52,25 +111,60 @@ void APP_UI_ShowStatus(const char* status, uint16_t color)
 {
     LOG_I("[APP] %s", status); // 调试时可打开
 
-    // 1. 直接绘制新状态
-    LCD_Show_String(35, BOX_STATUS_Y + 5, status, &font_16, color, UI_STATUS_BG);
+    // 开机阶段主页面还没画：只记下最后一条，就绪后补画
+    if (s_boot_state != UI_BOOT_READY)
+    {
+        strncpy(s_pending_status, status, sizeof(s_pending_status) - 1);
+        s_pending_color = color;
+        return;
+    }
 
-    // 2. 如果新文字比旧文字短，多出来的旧文字需要擦除
-    //    方法：在屁股后面画空格，空格会自动填充背景色
-    size_t new_len = strlen(status);
+    uint16_t w, h;
+    LCD_Measure_String(status, &font_16_prop, &w, &h);
 
-    if (new_len < s_last_status_len)
-    {
-        uint16_t x_offset = 35 + new_len * 8; // 计算空格开始的 x 坐标
+    // 1. 直接绘制新状态 (比例字体，同样宽度放得下更多字符)
+    LCD_Show_String(35, BOX_STATUS_Y + 5, status, &font_16_prop, color, UI_STATUS_BG);
 
-        for (size_t i = new_len; i < s_last_status_len; i++)
-        {
-            // 画一个背景色的空格，就把旧字盖掉了
-            LCD_Show_String(x_offset, BOX_STATUS_Y + 5, " ", &font_16, UI_STATUS_BG, UI_STATUS_BG);
-            x_offset += 8;
-        }
+    // 2. 新文字比旧文字窄时，旧文字多出来的一条用一次填充擦掉
+    if (w < s_last_status_w)
+    {
+        TFT_Fill_Rect_DMA(35 + w,
+                          BOX_STATUS_Y + 5,
+                          s_last_status_w - w,
+                          s_last_status_h,
+                          UI_STATUS_BG);
     }
 
-    // 3. 更新历史长度
-    s_last_status_len = new_len;
+    // 3. 更新历史尺寸
+    s_last_status_w = w;
+    s_last_status_h = h;
+}
+
+/**
+ * @brief  把瓦片层/影子帧缓冲的脏区域合并上屏 (私有)
+ */
+static void APP_UI_Flush(void)
+{
+    // 没有脏数据就不开新帧，免得空等一个 TE
+    if (!ST7789_FB8_Is_Dirty() && !ST7789_Tile_Is_Dirty())
+        return;
+
+    // 本帧内容从下一个 TE 脉冲开始发送
+    ST7789_Frame_Begin();
+
+    // 影子帧缓冲脏行上屏 (未开启时为空操作)
+    ST7789_FB8_Flush();
+
+    // 脏瓦片合并上屏 (CCM -> SRAM 行缓冲 -> DMA)
+    ST7789_Tile_Flush();
+
+    ST7789_Frame_End();
+}
+
+void APP_UI_Task(void)
+{
+    if (s_boot_state != UI_BOOT_READY && !APP_UI_Boot_Step())
+        return;
+
+    APP_UI_Flush();
 }
@@ -4,6 +4,7 @@
 #include "lcd_image.h"
 #include "st7789.h"
 #include "lcd_font.h"
+#include "lcd_text_field.h"
 #include "font_variable.h"
 #include <stdio.h>
 #include <string.h>
@@ -39,6 +40,11 @@ static const Weather_Map_t s_weather_map[] = {{"雨夹雪", gImage_weather_yujia
 
 #define WEATHER_MAP_SIZE (sizeof(s_weather_map) / sizeof(s_weather_map[0]))
 
+// 时间区的文字每秒更新，用差分文本框只重画变化的字 (通常只有秒的个位)
+static LCD_Text_Field_t s_field_hhmm; // 时:分
+static LCD_Text_Field_t s_field_sec;  // 秒
+static LCD_Text_Field_t s_field_date; // 日期 + 星期
+
 // === 内部查找函数 ===
 static const unsigned char* Get_Weather_Icon(const char* weather_str)
 {
@@ -57,8 +63,8 @@ static const unsigned char* Get_Weather_Icon(const char* weather_str)
 
 void APP_UI_MainPage_Init(void)
 {
-    // 1. 全屏米白色 (形成缝隙)
-    TFT_full(UI_BG_COLOR);
+    // 1. 全屏米白色 (形成缝隙)，76800 像素由 DMA 分段连续发送
+    TFT_full_DMA(UI_BG_COLOR);
 
     // 2. 绘制 5 个色块区域
     // --- 状态栏 ---
@@ -66,6 +72,9 @@ void APP_UI_MainPage_Init(void)
 
     // --- 时间 ---
     TFT_Fill_Rect_DMA(BOX_TIME_X, BOX_TIME_Y, BOX_TIME_W, BOX_TIME_H, UI_TIME_BG);
+    LCD_Text_Field_Init(&s_field_hhmm, 30, 35, &font_time_30x60, UI_TEXT_WHITE, UI_TIME_BG);
+    LCD_Text_Field_Init(&s_field_sec, 182, 68, &font_time_20, UI_TEXT_WHITE, UI_TIME_BG);
+    LCD_Text_Field_Init(&s_field_date, 35, 95, &font_time_20, UI_TEXT_WHITE, UI_TIME_BG);
 
     // --- 当前天气 ---
     TFT_Fill_Rect_DMA(BOX_ICON_X, BOX_ICON_Y, BOX_ICON_W, BOX_ICON_H, UI_ICON_BG);
@@ -135,13 +144,13 @@ void APP_UI_UpdateCalendar(BSP_RTC_Calendar_t cal)
     char time_buf[8];
     char date_buf[32];
 
-    // 显示 时分
+    // 显示 时分 (每分钟变一次)
     snprintf(time_buf, sizeof(time_buf), "%02d:%02d", cal.hour, cal.min);
-    LCD_Show_String(30, 35, time_buf, &font_time_30x60, UI_TEXT_WHITE, UI_TIME_BG);
+    LCD_Text_Field_Set(&s_field_hhmm, time_buf);
 
-    // 显示 秒
+    // 显示 秒 (通常只重画个位)
     snprintf(time_buf, sizeof(time_buf), "%02d", cal.sec);
-    LCD_Show_String(182, 68, time_buf, &font_time_20, UI_TEXT_WHITE, UI_TIME_BG);
+    LCD_Text_Field_Set(&s_field_sec, time_buf);
 
     snprintf(date_buf,
              sizeof(date_buf),
@@ -150,7 +159,7 @@ void APP_UI_UpdateCalendar(BSP_RTC_Calendar_t cal)
              cal.month,
              cal.date,
              WEEK_STR[cal.week]);
-    LCD_Show_String(35, 95, date_buf, &font_time_20, UI_TEXT_WHITE, UI_TIME_BG);
+    LCD_Text_Field_Set(&s_field_date, date_buf);
 }
 
 void APP_UI_Update_WiFi(bool is_connected, const char* ssid)
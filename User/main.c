@@ -4,6 +4,13 @@
 #include "uart_handle_variable.h"
 #include "uart_driver.h"
 #include "sys_log.h"
+#if LCD_FONT_EXT
+#include "w25qxx.h"
+#include "lcd_font_ext.h"
+#endif
+#if ST7789_PIX_BENCH
+#include "st7789_pix.h"
+#endif
 
 // === Ӧòģ ===
 #include "app_ui.h"
@@ -17,17 +24,48 @@ int main(void)
     BSP_SysTick_Init();
     UART_Init(&g_debug_uart_handler);
 
+    // Ļϵλ/Sleep Out ĵȴ RTC ʼ
+    // ѭе ESP32 λصУ APP_UI_Task() ƽ
+    APP_UI_Init();
+
     BSP_RTC_Status_e rtc_status = BSP_RTC_Init();
     if (rtc_status != BSP_RTC_OK && rtc_status != BSP_RTC_ALREADY_INIT)
     {
         LOG_E("[Main] RTC Error: %d", rtc_status);
     }
 
+#if LCD_FONT_EXT
+    // ⲿֿ⣺ Flash ʱֻƬֿ⣬ȱճʾռλ
+    if (W25Q_Init() != W25Q_OK || !LCD_Font_Ext_Init())
+    {
+        LOG_W("[Main] External font not found");
+    }
+#endif
+
+#if ST7789_PIX_BENCH
+    // תںˣοʵضԱȲʱ (Ϊ 64  x 240 صܺʱ)
+    {
+        ST7789_Pix_Bench_t bench;
+
+        ST7789_Pix_Benchmark(&bench);
+        LOG_I("[Pix] expand %d -> %d cycles, %d mismatches",
+              (int) bench.expand.ref_cycles,
+              (int) bench.expand.fast_cycles,
+              (int) bench.expand.mismatches);
+        LOG_I("[Pix] swap16 %d -> %d cycles, %d mismatches",
+              (int) bench.swap16.ref_cycles,
+              (int) bench.swap16.fast_cycles,
+              (int) bench.swap16.mismatches);
+        LOG_I("[Pix] rgb888 %d -> %d cycles, %d mismatches",
+              (int) bench.rgb888.ref_cycles,
+              (int) bench.rgb888.fast_cycles,
+              (int) bench.rgb888.mismatches);
+    }
+#endif
+
     LOG_I("System Start...");
 
     // 2. APP ʼ
-    APP_UI_Init();
-
     // ʼ (UIص)
     APP_Weather_Init(APP_UI_UpdateWeather, APP_UI_ShowStatus); // עҪ
 
@@ -45,6 +83,9 @@ int main(void)
         //  B: ϵͳ
         APP_Calendar_Task();
 
+        //  C: Ļˢ (ϲֵͳһ)
+        APP_UI_Task();
+
         // ι
         BSP_IWDG_Feed();
 
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_ext_image.py
+@brief 外部 SPI Flash 字库镜像生成工具：GBK 全字符集点阵 + Unicode -> GBK 对照表
+@note  输出的 .bin 用编程器写到 W25Qxx 的 LCD_FONT_EXT_BASE (默认 0) 地址，
+       固件打开 LCD_FONT_EXT 后片内字库缺字时到这里查找 (Resources/Font/src/lcd_font_ext.c)
+@note  镜像布局 (小端，各段 4K 对齐)：
+       - 0x0000: 字库头 (LCD_Font_Ext_Header_t，magic "WCFX"，版本 1)
+       - 0x1000: 对照表，65536 个 uint16_t，下标为 Unicode 码点，值为 GBK 码，0 表示没有
+       - 之后每个字号一段：126 x 190 个字模按 GBK 码排列，
+         字模为逐行 LSB First、行按字节对齐 (与片内字库相同)，未定义的码位填 0
+@note  需要 Pillow；一个字号 (如 16 点阵宋体) 约 766K，16 + 20 两个字号约 2.3M
+"""
+
+import os
+import sys
+import struct
+import argparse
+import logging
+
+from font_subset import render_ttf
+
+MAGIC = b'WCFX'
+VERSION = 1
+MAX_SECTIONS = 4  # 与 lcd_font_ext.h 中 LCD_FONT_EXT_MAX_SECTIONS 一致
+HEADER_SIZE = 12 + MAX_SECTIONS * 8
+ALIGN = 0x1000  # 按扇区对齐，方便单独重写某一段
+
+GBK_LEADS = range(0x81, 0xFF)
+GBK_TRAILS = [lo for lo in range(0x40, 0xFF) if lo != 0x7F]  # 每个首字节 190 个
+
+
+def setup_logging():
+    logging.basicConfig(level=logging.INFO, format='[%(levelname)s] %(message)s')
+    return logging.getLogger(__name__)
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def gbk_table():
+    """
+    @brief 枚举全部 GBK 码位，返回 [(GBK 码, 字符或 None)]，顺序即字模序号
+    """
+    table = []
+    for hi in GBK_LEADS:
+        for lo in GBK_TRAILS:
+            try:
+                char = bytes([hi, lo]).decode('gbk')
+            except UnicodeDecodeError:
+                char = None
+            table.append(((hi << 8) | lo, char if char and len(char) == 1 else None))
+    return table
+
+
+def build_image(fonts):
+    """
+    @brief 生成镜像
+    @param fonts [(宽, 高, TTF 路径)]
+    @retval bytes
+    """
+    table = gbk_table()
+    chars = [c for _, c in table if c]
+
+    # 对照表：同一个 Unicode 字符只取第一个 GBK 码
+    mapping = [0] * 0x10000
+    for code, char in table:
+        if char and ord(char) <= 0xFFFF and not mapping[ord(char)]:
+            mapping[ord(char)] = code
+
+    map_offset = align(HEADER_SIZE)
+    offset = align(map_offset + len(mapping) * 2)
+
+    sections, blobs = [], []
+    for width, height, ttf in fonts:
+        glyph_bytes = (width + 7) // 8 * height
+        glyphs = render_ttf(chars, ttf, width, height)
+        blob = bytearray()
+        for _, char in table:
+            blob += bytes(glyphs[ord(char)]) if char else bytes(glyph_bytes)
+        sections.append((width, height, glyph_bytes, offset))
+        blobs.append((offset, blob))
+        offset = align(offset + len(blob))
+
+    header = MAGIC + struct.pack('<HHI', VERSION, len(sections), map_offset)
+    for section in sections:
+        header += struct.pack('<BBHI', *section)
+    header += bytes(HEADER_SIZE - len(header))
+
+    image = bytearray(b'\xFF' * offset)  # 空隙保持擦除后的 0xFF
+    image[0:HEADER_SIZE] = header
+    image[map_offset:map_offset + len(mapping) * 2] = struct.pack(f'<{len(mapping)}H', *mapping)
+    for start, blob in blobs:
+        image[start:start + len(blob)] = blob
+    return bytes(image)
+
+
+def main():
+    logger = setup_logging()
+
+    parser = argparse.ArgumentParser(description='生成外部 SPI Flash GBK 字库镜像')
+    parser.add_argument('output', help='输出 .bin 文件路径')
+    parser.add_argument('--font', nargs=3, action='append', required=True,
+                        metavar=('W', 'H', 'TTF'),
+                        help='一个字号：点阵宽、高与渲染用的 TrueType 字体，可重复')
+    args = parser.parse_args()
+
+    try:
+        fonts = [(int(w), int(h), ttf) for w, h, ttf in args.font]
+        if len(fonts) > MAX_SECTIONS:
+            raise ValueError(f"最多 {MAX_SECTIONS} 个字号")
+        image = build_image(fonts)
+
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, 'wb') as f:
+            f.write(image)
+    except (IOError, ValueError) as e:
+        logger.error(f"{args.output}: {e}")
+        return 1
+
+    sizes = ", ".join(f"{w}x{h}" for w, h, _ in fonts)
+    logger.info(f"{args.output}: {sizes}，共 {len(image)} 字节")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
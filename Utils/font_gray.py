@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_gray.py
+@brief 抗锯齿字库生成工具：1-bpp 位图 -> 4-bpp 灰度字模 (XXX_GRAY)
+@note  由 CMake 在构建时调用 (LCD_FONT_AA=ON)，源文件保持不变
+@note  输入两种格式：
+       - ASCII 字库 (time_30x60.c 等)：const uint8_t XXX[] = {...}，每个字以 /*"c",n*/ 注释结尾
+       - 汉字字库 (hzk_week_20.c 等)：XXX_Code 码点表 + XXX[][N] 字模数组 + 字体描述符
+       输出文件在位图数组后插入同样顺序的 XXX_GRAY，文件其余部分原样保留，
+       描述符用 #if LCD_FONT_AA 选择引用哪一份 (位图不再被引用，链接时回收)。
+@note  灰度由现有位图推导，不需要 TrueType 字体：先用 Scale2x 放大两次 (4 倍，
+       只在阶梯状的斜边上补角，横竖笔画保持原样)，再按 4x4 求平均量化为 16 级。
+       字形、字宽与原位图一致，只有斜边与圆弧出现过渡灰度。
+@note  格式见 font_variable.h 中 ascii_gray 的说明：逐行、低半字节在前，行按字节对齐，
+       0 为背景色、15 为前景色
+"""
+
+import os
+import re
+import sys
+import argparse
+import logging
+
+from font_rle_compress import parse_font
+from font_subset import CODE_PATTERN, GLYPH_PATTERN, SIZE_PATTERN, to_rows
+
+LEVELS = 15  # 最大灰度级 (4-bpp)
+SCALE = 4  # 超采样倍数 = Scale2x 两次
+
+
+def setup_logging():
+    logging.basicConfig(level=logging.INFO, format='[%(levelname)s] %(message)s')
+    return logging.getLogger(__name__)
+
+
+def scale2x(rows):
+    """
+    @brief Scale2x (EPX) 放大一倍：两条相邻边同色且与对边不同时，该角取邻边颜色
+    """
+    h, w = len(rows), len(rows[0])
+
+    def at(r, c):
+        return rows[r][c] if 0 <= r < h and 0 <= c < w else 0
+
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for r in range(h):
+        for c in range(w):
+            e = rows[r][c]
+            b, d, f, hh = at(r - 1, c), at(r, c - 1), at(r, c + 1), at(r + 1, c)
+            e0 = e1 = e2 = e3 = e
+            if b != hh and d != f:
+                e0 = d if d == b else e
+                e1 = f if b == f else e
+                e2 = d if d == hh else e
+                e3 = f if hh == f else e
+            out[r * 2][c * 2], out[r * 2][c * 2 + 1] = e0, e1
+            out[r * 2 + 1][c * 2], out[r * 2 + 1][c * 2 + 1] = e2, e3
+    return out
+
+
+def gray_glyph(rows):
+    """
+    @brief 一个字：位图行 -> 4-bpp 字节 (逐行，低半字节在前，行按字节对齐)
+    """
+    h, w = len(rows), len(rows[0])
+    big = scale2x(scale2x(rows))
+    area = SCALE * SCALE
+
+    data = []
+    for r in range(h):
+        levels = []
+        for c in range(w):
+            total = sum(big[r * SCALE + y][c * SCALE + x] for y in range(SCALE) for x in range(SCALE))
+            levels.append((total * LEVELS + area // 2) // area)
+        if w % 2:
+            levels.append(0)
+        data += [levels[i] | (levels[i + 1] << 4) for i in range(0, len(levels), 2)]
+    return data
+
+
+def parse_hzk(content):
+    """
+    @brief 解析汉字字库，返回 (数组名, 宽, 高, [码点], [逐字像素行], 字模数组在原文中的区间)
+    @note  按数组原有顺序返回 (不去重)，灰度字模与位图字模下标一一对应
+    """
+    code, glyph = CODE_PATTERN.search(content), GLYPH_PATTERN.search(content)
+    if not code or not glyph or code.group(1) != glyph.group(1):
+        raise ValueError("未找到成对的 XXX_Code[] 码点表与 XXX[][N] 字模数组")
+
+    name, glyph_size = glyph.group(1), int(glyph.group(2))
+    size = dict(SIZE_PATTERN.findall(content))
+    if 'w' not in size or 'h' not in size:
+        raise ValueError(f"{name}: 未找到字体描述符中的 .cn_w / .cn_h")
+    width, height = int(size['w']), int(size['h'])
+
+    codes = [int(c, 16) for c in re.findall(r'0x([0-9A-Fa-f]{4})', code.group(2))]
+    glyphs = []
+    for body in re.findall(r'\{([^{}]+)\}', glyph.group(3)):
+        data = [int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2})', body)]
+        if len(data) != glyph_size:
+            raise ValueError(f"{name}: 字模 {len(glyphs)} 有 {len(data)} 字节，应为 {glyph_size}")
+        glyphs.append(to_rows(data, width, height))
+    if len(codes) != len(glyphs):
+        raise ValueError(f"{name}: 码点数 {len(codes)} 与字模数 {len(glyphs)} 不一致")
+
+    return name, width, height, codes, glyphs, glyph.span()
+
+
+def gray_lines(name, width, height, labels, glyphs, per_glyph):
+    """
+    @brief 生成 XXX_GRAY 数组的 C 代码行
+    @param per_glyph True: 二维数组 XXX_GRAY[][N] (汉字)  False: 一维数组 (ASCII)
+    """
+    glyph_size = (width + 1) // 2 * height
+    lines = [f"/* {name}_GRAY: {width}x{height}，{len(glyphs)} 字，4-bpp 灰度 "
+             f"{len(glyphs) * glyph_size} 字节 (由上面的位图生成，LCD_FONT_AA) */"]
+
+    if per_glyph:
+        lines.append(f"const uint8_t {name}_GRAY[][{glyph_size}] = {{")
+    else:
+        lines.append(f"const uint8_t {name}_GRAY[{len(glyphs) * glyph_size}] = {{")
+
+    for label, rows in zip(labels, glyphs):
+        data = gray_glyph(rows)
+        lines.append(f"    /* {label} */")
+        if per_glyph:
+            lines.append("    {")
+        indent = "        " if per_glyph else "    "
+        for k in range(0, len(data), 16):
+            lines.append(indent + ", ".join(f"0x{b:02X}" for b in data[k:k + 16]) + ",")
+        if per_glyph:
+            lines.append("    },")
+    lines.append("};")
+    return lines, len(glyphs) * glyph_size
+
+
+def main():
+    logger = setup_logging()
+
+    parser = argparse.ArgumentParser(description='点阵字库生成 4-bpp 灰度 (抗锯齿) 字模')
+    parser.add_argument('input', help='ASCII 或汉字字库 .c 文件')
+    parser.add_argument('output', help='输出 .c 文件路径')
+    args = parser.parse_args()
+
+    try:
+        with open(args.input, 'r', encoding='utf-8') as f:
+            content = f.read()
+
+        if GLYPH_PATTERN.search(content):
+            name, width, height, codes, glyphs, span = parse_hzk(content)
+            labels = [f'"{chr(cp)}" U+{cp:04X}, {i}' for i, cp in enumerate(codes)]
+            per_glyph = True
+        else:
+            name, width, height, chars, glyphs, span = parse_font(content)
+            labels = [f"'{chr(c)}'" for c in chars]
+            per_glyph = False
+
+        lines, size = gray_lines(name, width, height, labels, glyphs, per_glyph)
+
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, 'w', encoding='utf-8', newline='\r\n') as f:
+            f.write(f"/* 自动生成，请勿手改。源文件: {os.path.basename(args.input)} (4-bpp 灰度字模) */\n\n")
+            f.write(content[:span[1]])
+            f.write("\n\n")
+            f.write("\n".join(lines))
+            f.write(content[span[1]:])
+    except (IOError, ValueError) as e:
+        logger.error(f"{args.input}: {e}")
+        return 1
+
+    logger.info(f"{name}: {len(glyphs)} 字，4-bpp 灰度 {size} 字节")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
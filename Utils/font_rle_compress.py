@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_rle_compress.py
+@brief 点阵字库压缩工具：逐字位图 -> 包围盒 + 行程编码 (font_rle_t)
+@note  由 CMake 在构建时调用 (LCD_FONT_RLE=ON)，源文件保持不变
+@note  输入为取模软件导出的 const uint8_t XXX[] = {...}; (逐行式、LSB First、行按字节对齐)，
+       每个字以 /*"c",n*/ 注释结尾，字号取自 /* (W X H , 字体 )*/ 注释。
+       输出文件中该数组替换为 XXX_RLE_Glyphs / XXX_RLE_Data 与 const font_rle_t XXX_RLE，
+       字模顺序不变，文件其余部分 (字符区间表、字体描述符等) 原样保留，
+       描述符用 #if LCD_FONT_RLE 选择引用哪一份。
+@note  编码格式见 font_variable.h 中 font_rle_glyph_t 的说明
+"""
+
+import re
+import os
+import sys
+import argparse
+import logging
+
+ARRAY_PATTERN = re.compile(r'const\s+uint8_t\s+(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\}\s*;', re.S)
+TOKEN_PATTERN = re.compile(r'0[xX]([0-9a-fA-F]{1,2})|/\*"(.)",(\d+)\*/')
+SIZE_PATTERN = re.compile(r'\(\s*(\d+)\s*[xX]\s*(\d+)\s*,')
+
+RAW_FLAG = 0x80  # 组头 bit7：原始位图行
+MAX_REPEAT = 0x7F  # 组头 bit6~0：相同行数
+MAX_NIBBLES = 0xFF  # 行程行的半字节数用 1 字节表示
+
+
+def setup_logging():
+    logging.basicConfig(level=logging.INFO, format='[%(levelname)s] %(message)s')
+    return logging.getLogger(__name__)
+
+
+def parse_font(content):
+    """
+    @brief 解析字库数组，返回 (数组名, 宽, 高, [字符], [逐字像素行], 数组在原文中的区间)
+    """
+    match = ARRAY_PATTERN.search(content)
+    if not match:
+        raise ValueError("未找到 const uint8_t 字模数组")
+
+    name, body = match.group(1), match.group(2)
+
+    size = SIZE_PATTERN.search(body)
+    if not size:
+        raise ValueError(f"{name}: 未找到 (W X H , 字体) 字号注释")
+    width, height = int(size.group(1)), int(size.group(2))
+    bytes_per_row = (width + 7) // 8
+    glyph_size = bytes_per_row * height
+
+    # 逐个字：字节累积到 /*"c",n*/ 注释为止
+    chars, glyphs, pending = [], [], []
+    for byte, char, _ in TOKEN_PATTERN.findall(body):
+        if byte:
+            pending.append(int(byte, 16))
+            continue
+        if len(pending) != glyph_size:
+            raise ValueError(f"{name}: '{char}' 有 {len(pending)} 字节，应为 {glyph_size}")
+        chars.append(ord(char))
+        glyphs.append([[(pending[r * bytes_per_row + c // 8] >> (c % 8)) & 1 for c in range(width)]
+                       for r in range(height)])
+        pending = []
+
+    if not glyphs:
+        raise ValueError(f"{name}: 未找到 /*\"c\",n*/ 字符注释")
+    if pending:
+        raise ValueError(f"{name}: 末尾有 {len(pending)} 字节不属于任何字符")
+
+    return name, width, height, chars, glyphs, match.span()
+
+
+def bounding_box(rows):
+    """
+    @brief 求前景像素的包围盒 (x, y, w, h)，空白字返回全 0
+    """
+    ys = [r for r, row in enumerate(rows) if any(row)]
+    if not ys:
+        return 0, 0, 0, 0
+    xs = [c for c in range(len(rows[0])) if any(row[c] for row in rows)]
+    return xs[0], ys[0], xs[-1] - xs[0] + 1, ys[-1] - ys[0] + 1
+
+
+def encode_row(pixels):
+    """
+    @brief 编码一行：行程 (半字节) 与原始位图取较短者，返回组头之后的字节
+    """
+    raw = [0] * ((len(pixels) + 7) // 8)
+    for c, bit in enumerate(pixels):
+        raw[c // 8] |= bit << (c % 8)
+
+    # 行程从背景色开始交替，行尾的背景不编码 (解码时补齐)
+    nibbles, color, run = [], 0, 0
+    end = max((c + 1 for c, bit in enumerate(pixels) if bit), default=0)
+    for bit in pixels[:end]:
+        if bit != color:
+            nibbles.append(run)
+            color, run = bit, 0
+        run += 1
+    if end:
+        nibbles.append(run)
+
+    split = []
+    for run in nibbles:
+        while run > 15:
+            split += [15, 0]
+            run -= 15
+        split.append(run)
+
+    rle = [len(split)] + [split[i] | ((split[i + 1] if i + 1 < len(split) else 0) << 4)
+                          for i in range(0, len(split), 2)]
+    if len(split) > MAX_NIBBLES or len(rle) >= len(raw):
+        return True, raw
+    return False, rle
+
+
+def encode_glyph(rows):
+    """
+    @brief 编码一个字，返回 ((x, y, w, h), 行组字节)
+    """
+    x, y, w, h = bounding_box(rows)
+    data = []
+    r = y
+    while r < y + h:
+        line = rows[r][x:x + w]
+        repeat = 1
+        while r + repeat < y + h and repeat < MAX_REPEAT and rows[r + repeat][x:x + w] == line:
+            repeat += 1
+
+        is_raw, payload = encode_row(line)
+        data.append((RAW_FLAG if is_raw else 0) | repeat)
+        data += payload
+        r += repeat
+
+    return (x, y, w, h), data
+
+
+def rle_tables(name, glyphs, labels):
+    """
+    @brief 逐字编码，返回 (C 代码行, 压缩后字节数)：XXX_RLE_Glyphs / XXX_RLE_Data 与 const font_rle_t XXX_RLE
+    @param labels 每个字在注释中的显示
+    """
+    descs, data = [], []
+    for rows in glyphs:
+        box, encoded = encode_glyph(rows)
+        if len(data) + len(encoded) > 0xFFFF:
+            raise ValueError(f"{name}: 压缩数据超过 64K，offset 溢出")
+        descs.append((len(data), box))
+        data += encoded
+
+    lines = [f"static const font_rle_glyph_t {name}_RLE_Glyphs[{len(descs)}] = {{"]
+    for label, (offset, (x, y, w, h)) in zip(labels, descs):
+        lines.append(f"    {{0x{offset:04X}, {x}, {y}, {w}, {h}}}, /* {label} */")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"static const uint8_t {name}_RLE_Data[{max(len(data), 1)}] = {{")
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    if not data:
+        lines.append("    0x00,")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const font_rle_t {name}_RLE = {{")
+    lines.append(f"    .glyphs = {name}_RLE_Glyphs,")
+    lines.append(f"    .data   = {name}_RLE_Data,")
+    lines.append("};")
+
+    return lines, len(data) + len(descs) * 6
+
+
+def write_c_file(output_file, source_name, content, font):
+    """
+    @brief 生成 C 文件：字模数组替换为压缩表，其余内容原样保留
+    """
+    name, width, height, chars, glyphs, (start, end) = font
+    bitmap_size = len(glyphs) * ((width + 7) // 8) * height
+
+    tables, packed_size = rle_tables(name, glyphs, [f"'{chr(c)}'" for c in chars])
+    lines = [f"/* {name}: {width}x{height}，{len(glyphs)} 字，"
+             f"位图 {bitmap_size} 字节 -> "
+             f"压缩 {packed_size} 字节 (含字模描述) */"] + tables
+
+    os.makedirs(os.path.dirname(os.path.abspath(output_file)), exist_ok=True)
+
+    with open(output_file, 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(f"/* 自动生成，请勿手改。源文件: {source_name} (包围盒 + 行程编码) */\n\n")
+        f.write(content[:start])
+        f.write("\n".join(lines))
+        f.write(content[end:])
+
+    return bitmap_size, packed_size
+
+
+def main():
+    logger = setup_logging()
+
+    parser = argparse.ArgumentParser(description='点阵字库压缩为包围盒 + 行程编码')
+    parser.add_argument('input', help='取模软件导出的字库 .c 文件')
+    parser.add_argument('output', help='输出 .c 文件路径')
+    args = parser.parse_args()
+
+    try:
+        with open(args.input, 'r', encoding='utf-8') as f:
+            content = f.read()
+        font = parse_font(content)
+        before, after = write_c_file(args.output, os.path.basename(args.input), content, font)
+    except (IOError, ValueError) as e:
+        logger.error(f"{args.input}: {e}")
+        return 1
+
+    logger.info(f"{font[0]}: {before} -> {after} 字节")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file font_subset.py
+@brief 汉字字库裁剪工具：按固件实际用到的字重新生成码点表与字模 (升序、去重、可压缩)
+@note  由 CMake 在构建时调用 (LCD_FONT_SUBSET=ON)，源文件保持不变
+@note  字符集 = 扫描目录中 C 源文件的字符串字面量 (跳过注释) + 词表文件 + 城市库中的城市名 (可选)，
+       只收录非 ASCII 字符 (ASCII 走字体的 ascii_map)。
+@note  模板为 hzk16.c 这类文件：XXX_Code 码点表 + XXX[][N] 字模数组 + 字体描述符，
+       两张表替换为裁剪结果，文件其余部分原样保留。字模优先沿用模板中已有的，
+       缺少的用 --ttf 指定的字体渲染 (需要 Pillow)；仍有缺字时报错并列出，构建失败，
+       运行时不会再出现缺字的红色占位块。
+@note  包围盒 + 行程编码 (font_rle_compress.py) 比位图小时输出 XXX_RLE 并定义 XXX_PACKED 为 1，
+       描述符据此选择 hzk_rle 或 hzk_glyph。笔画密的小字号汉字压缩后可能反而更大，此时保持位图。
+       --bitmap 时总是输出位图，供 font_gray.py 继续生成灰度字模 (LCD_FONT_AA)。
+"""
+
+import re
+import os
+import sys
+import argparse
+import logging
+
+from font_rle_compress import rle_tables
+
+CODE_PATTERN = re.compile(r'const\s+uint16_t\s+(\w+)_Code\s*\[\s*\]\s*=\s*\{(.*?)\};', re.S)
+GLYPH_PATTERN = re.compile(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\n\};', re.S)
+SIZE_PATTERN = re.compile(r'\.cn_(w|h)\s*=\s*(\d+)')
+COUNT_PATTERN = re.compile(r'共 \d+ 个字符')
+CITY_PATTERN = re.compile(r'\{\s*"([^"]+)"\s*,\s*"\d+"\s*\}')
+
+# 注释与字符/字符串字面量，只取字符串 (第 1 组)
+C_TOKEN_PATTERN = re.compile(r'//[^\n]*|/\*.*?\*/|"((?:[^"\\\n]|\\.)*)"|\'(?:[^\'\\\n]|\\.)*\'', re.S)
+
+SOURCE_SUFFIXES = ('.c', '.h')
+
+
+def setup_logging():
+    logging.basicConfig(level=logging.INFO, format='[%(levelname)s] %(message)s')
+    return logging.getLogger(__name__)
+
+
+def read_text(path):
+    """
+    @brief 读取源文件：工程里多数文件是 UTF-8，少数 (main.c、st7789.c) 是 GBK
+    """
+    with open(path, 'rb') as f:
+        raw = f.read()
+    try:
+        text = raw.decode('utf-8')
+    except UnicodeDecodeError:
+        text = raw.decode('gbk', errors='replace')
+    return text.replace('\r\n', '\n')
+
+
+def wanted(text):
+    """
+    @brief 取出需要汉字字库的字符 (非 ASCII)
+    """
+    return {c for c in text if ord(c) > 0x7F}
+
+
+def scan_sources(paths):
+    """
+    @brief 收集目录/文件中所有 C 字符串字面量里的非 ASCII 字符
+    """
+    files = []
+    for path in paths:
+        if os.path.isfile(path):
+            files.append(path)
+            continue
+        for root, _, names in os.walk(path):
+            files += [os.path.join(root, n) for n in names if n.endswith(SOURCE_SUFFIXES)]
+
+    chars = set()
+    for path in sorted(files):
+        for match in C_TOKEN_PATTERN.finditer(read_text(path)):
+            if match.group(1):
+                chars |= wanted(match.group(1))
+    return chars
+
+
+def read_vocab(path):
+    """
+    @brief 词表文件：UTF-8，空白分隔的词，# 开头的行是注释
+    """
+    chars = set()
+    for line in read_text(path).splitlines():
+        if not line.strip().startswith('#'):
+            chars |= wanted(line)
+    return chars
+
+
+def read_cities(path):
+    """
+    @brief 城市库 city_code.c 中的全部城市名 (运行时可切换到任意城市)
+    """
+    names = CITY_PATTERN.findall(read_text(path))
+    if not names:
+        raise ValueError(f"{path}: 未找到 {{\"城市\", \"代码\"}} 条目")
+    return wanted("".join(names))
+
+
+def parse_template(content):
+    """
+    @brief 解析模板，返回 (数组名, 宽, 高, {码点: 位图字节}, 码点表区间, 字模表区间)
+    """
+    code = CODE_PATTERN.search(content)
+    glyph = GLYPH_PATTERN.search(content)
+    if not code or not glyph or code.group(1) != glyph.group(1):
+        raise ValueError("未找到成对的 XXX_Code[] 码点表与 XXX[][N] 字模数组")
+
+    name, glyph_size = glyph.group(1), int(glyph.group(2))
+    size = dict(SIZE_PATTERN.findall(content))
+    if 'w' not in size or 'h' not in size:
+        raise ValueError(f"{name}: 未找到字体描述符中的 .cn_w / .cn_h")
+    width, height = int(size['w']), int(size['h'])
+    if (width + 7) // 8 * height != glyph_size:
+        raise ValueError(f"{name}: {width}x{height} 与字模大小 {glyph_size} 不符")
+
+    codes = [int(c, 16) for c in re.findall(r'0x([0-9A-Fa-f]{4})', code.group(2))]
+    bodies = re.findall(r'\{([^{}]+)\}', glyph.group(3))
+    if len(codes) != len(bodies):
+        raise ValueError(f"{name}: 码点数 {len(codes)} 与字模数 {len(bodies)} 不一致")
+
+    glyphs = {}
+    for cp, body in zip(codes, bodies):
+        data = [int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2})', body)]
+        if len(data) == glyph_size:
+            glyphs.setdefault(cp, data)
+
+    return name, width, height, glyphs, code.span(), glyph.span()
+
+
+def render_ttf(chars, ttf, width, height):
+    """
+    @brief 用 TrueType 字体渲染缺少的字 (与 输入汉字自动生成要求格式的模文件.py 相同：LSB First)
+    """
+    try:
+        from PIL import Image, ImageFont, ImageDraw
+    except ImportError:
+        raise ValueError("渲染缺字需要 Pillow (pip install pillow)")
+
+    font = ImageFont.truetype(ttf, height)
+    bytes_per_row = (width + 7) // 8
+    glyphs = {}
+    for c in chars:
+        image = Image.new("1", (width, height), 0)
+        ImageDraw.Draw(image).text((0, 0), c, font=font, fill=1)
+        pixels = image.load()
+
+        data = [0] * (bytes_per_row * height)
+        for y in range(height):
+            for x in range(width):
+                if pixels[x, y]:
+                    data[y * bytes_per_row + x // 8] |= 1 << (x % 8)
+        glyphs[ord(c)] = data
+    return glyphs
+
+
+def to_rows(data, width, height):
+    bytes_per_row = (width + 7) // 8
+    return [[(data[r * bytes_per_row + c // 8] >> (c % 8)) & 1 for c in range(width)]
+            for r in range(height)]
+
+
+def write_c_file(output_file, source_name, content, template, entries, bitmap_only=False):
+    """
+    @brief 生成 C 文件：码点表与字模表替换为裁剪结果，压缩更小时改为 XXX_RLE
+    @param bitmap_only 总是输出位图 (后续还要由 font_gray.py 从位图生成灰度字模)
+    @retval (位图字节数, 压缩字节数, 是否压缩)
+    """
+    name, width, height, _, code_span, glyph_span = template
+    glyph_size = (width + 7) // 8 * height
+    bitmap_size = len(entries) * glyph_size
+
+    code_lines = [f"const uint16_t {name}_Code[] = {{"]
+    code_lines += [f"    0x{cp:04X}, // {chr(cp)}" for cp, _ in entries]
+    code_lines.append("};")
+
+    # 压缩数据超过 64K (offset 为 16 位) 或不比位图小时保持位图
+    try:
+        tables, packed_size = rle_tables(name,
+                                         [to_rows(data, width, height) for _, data in entries],
+                                         [f'"{chr(cp)}"' for cp, _ in entries])
+    except ValueError:
+        tables, packed_size = None, None
+    packed = not bitmap_only and tables is not None and packed_size < bitmap_size
+
+    if packed:
+        glyph_lines = [f"#define {name}_PACKED 1", ""] + tables
+    else:
+        glyph_lines = [f"const uint8_t {name}[][{glyph_size}] = {{"]
+        for i, (cp, data) in enumerate(entries):
+            glyph_lines.append(f'    /* "{chr(cp)}" U+{cp:04X}, {i} */')
+            glyph_lines.append("    {")
+            for k in range(0, len(data), 8):
+                glyph_lines.append("        " + ", ".join(f"0x{b:02X}" for b in data[k:k + 8]) + ",")
+            glyph_lines.append("    },")
+        glyph_lines.append("};")
+
+    head = COUNT_PATTERN.sub(f"共 {len(entries)} 个字符", content[:code_span[0]])
+
+    os.makedirs(os.path.dirname(os.path.abspath(output_file)), exist_ok=True)
+
+    with open(output_file, 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(f"/* 自动生成，请勿手改。源文件: {source_name} (按固件用到的字裁剪) */\n\n")
+        f.write(head)
+        f.write("\n".join(code_lines))
+        f.write(content[code_span[1]:glyph_span[0]])
+        f.write("\n".join(glyph_lines))
+        f.write(content[glyph_span[1]:])
+
+    return bitmap_size, packed_size, packed
+
+
+def main():
+    logger = setup_logging()
+
+    parser = argparse.ArgumentParser(description='汉字字库按固件用到的字裁剪')
+    parser.add_argument('input', help='字库模板 .c 文件 (hzk16.c 等)')
+    parser.add_argument('output', help='输出 .c 文件路径')
+    parser.add_argument('--scan', nargs='+', default=[], help='扫描字符串字面量的目录或文件')
+    parser.add_argument('--vocab', help='词表文件 (运行时才出现的文字：天气现象、风向等)')
+    parser.add_argument('--cities', help='城市库 city_code.c，收录全部城市名')
+    parser.add_argument('--ttf', help='渲染缺字用的 TrueType 字体')
+    parser.add_argument('--bitmap', action='store_true', help='不压缩，总是输出位图 (LCD_FONT_AA)')
+    args = parser.parse_args()
+
+    try:
+        chars = scan_sources(args.scan)
+        if args.vocab:
+            chars |= read_vocab(args.vocab)
+        if args.cities:
+            chars |= read_cities(args.cities)
+
+        # 码点表是 uint16_t，只能收录基本多文种平面 (BMP) 内的字符
+        wide = sorted(c for c in chars if ord(c) > 0xFFFF)
+        if wide:
+            raise ValueError(f"码点超出 0xFFFF，无法收录: {''.join(wide)}")
+
+        content = read_text(args.input)
+        template = parse_template(content)
+        name, width, height, glyphs = template[:4]
+
+        missing = sorted((c for c in chars if ord(c) not in glyphs), key=ord)
+        if missing and args.ttf:
+            glyphs.update(render_ttf(missing, args.ttf, width, height))
+            missing = []
+        if missing:
+            raise ValueError(f"{name}: 缺少 {len(missing)} 个字模且未指定 --ttf: {''.join(missing)}")
+
+        entries = [(cp, glyphs[cp]) for cp in sorted(ord(c) for c in chars)]
+        bitmap_size, packed_size, packed = write_c_file(args.output,
+                                                        os.path.basename(args.input),
+                                                        content,
+                                                        template,
+                                                        entries,
+                                                        args.bitmap)
+    except (IOError, ValueError) as e:
+        logger.error(f"{args.input}: {e}")
+        return 1
+
+    logger.info(f"{name}: {len(entries)} 字，位图 {bitmap_size} 字节，"
+                f"压缩 {packed_size if packed_size else '-'} 字节 -> "
+                f"{'压缩' if packed else '位图'}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
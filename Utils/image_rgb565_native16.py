@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file image_rgb565_native16.py
+@brief 图片数组格式转换工具：大端字节流 -> 原生 16 位 RGB565
+@note  由 CMake 在构建时调用 (LCD_IMAGE_NATIVE16=ON)，源文件保持不变
+@note  输入为取模软件导出的 const unsigned char gImage_xxx[N] = {...}; (高字节在前)
+       输出为同名数组，每两个字节交换顺序并 4 字节对齐，
+       小端 CPU 按 uint16_t 读取即得到 RGB565 值，可直接走 16 位 DMA + 16 位 SPI
+"""
+
+import re
+import os
+import sys
+import argparse
+import logging
+
+ARRAY_PATTERN = re.compile(r'const\s+unsigned\s+char\s+(gImage_\w+)\s*\[\s*(\d*)\s*\]\s*=\s*\{(.*?)\}\s*;',
+                           re.S)
+BYTE_PATTERN = re.compile(r'0[xX]([0-9a-fA-F]{1,2})')
+COMMENT_PATTERN = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+
+
+def setup_logging():
+    logging.basicConfig(level=logging.INFO, format='[%(levelname)s] %(message)s')
+    return logging.getLogger(__name__)
+
+
+def parse_image(input_file):
+    """
+    @brief 解析图片源文件，返回 [(数组名, 字节列表), ...]
+    """
+    with open(input_file, 'r', encoding='utf-8', errors='ignore') as f:
+        content = f.read()
+
+    images = []
+    for name, size, body in ARRAY_PATTERN.findall(content):
+        # 取模软件会把图片头 (/* 0X10,0X10,... */) 写在数组里，必须先去掉
+        body = COMMENT_PATTERN.sub('', body)
+        data = [int(b, 16) for b in BYTE_PATTERN.findall(body)]
+
+        if size and int(size) != len(data):
+            raise ValueError(f"{name}: 声明 {size} 字节，实际解析到 {len(data)} 字节")
+        if len(data) % 2 != 0:
+            raise ValueError(f"{name}: RGB565 数据长度必须为偶数")
+
+        images.append((name, data))
+
+    return images
+
+
+def swap_pairs(data):
+    """
+    @brief 每个像素的高低字节互换 (大端 -> 小端)
+    """
+    out = list(data)
+    out[0::2], out[1::2] = data[1::2], data[0::2]
+    return out
+
+
+def write_c_file(output_file, source_name, images):
+    """
+    @brief 生成 C 文件 (数组名与原文件一致，调用方无需修改)
+    """
+    os.makedirs(os.path.dirname(os.path.abspath(output_file)), exist_ok=True)
+
+    with open(output_file, 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(f"/* 自动生成，请勿手改。源文件: {source_name} (原生 16 位 RGB565) */\n\n")
+
+        for name, data in images:
+            swapped = swap_pairs(data)
+            f.write(f"const unsigned char {name}[{len(swapped)}] __attribute__((aligned(4))) = {{\n")
+            for i in range(0, len(swapped), 16):
+                line = ', '.join(f"0X{b:02X}" for b in swapped[i:i + 16])
+                f.write(f"    {line},\n")
+            f.write("};\n\n")
+
+
+def main():
+    logger = setup_logging()
+
+    parser = argparse.ArgumentParser(description='RGB565 图片数组转原生 16 位格式')
+    parser.add_argument('input', help='取模软件导出的图片 .c 文件')
+    parser.add_argument('output', help='输出 .c 文件路径')
+    args = parser.parse_args()
+
+    try:
+        images = parse_image(args.input)
+    except (IOError, ValueError) as e:
+        logger.error(f"{args.input}: {e}")
+        return 1
+
+    if not images:
+        logger.error(f"{args.input}: 未找到 gImage_ 数组")
+        return 1
+
+    write_c_file(args.output, os.path.basename(args.input), images)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -31,81 +31,63 @@ def optimize_hzk_file(input_path, output_path):
     with open(input_path, 'r', encoding='utf-8') as f:
         content = f.read()
 
-    # 3. 智能定位数组区域 (掐头去尾)
-    # 匹配 const HZK_16_t HZK_16[] = {
-    start_marker = r'(const\s+HZK_16_t\s+HZK_16\[\]\s*=\s*\{)'
-    start_match = re.search(start_marker, content)
-    # 从后往前找最后一个 };
-    end_idx = content.rfind('};')
-
-    if not start_match or end_idx == -1:
-        print("错误: 无法解析 HZK_16 数组结构，请检查文件格式。")
+    # 3. 定位码点表与字模表
+    # const uint16_t HZK_16_Code[] = { 0x4E00, // 一 ... };
+    # const uint8_t HZK_16[][32] = { /* "一" U+4E00, 0 */ { 0x.., ... }, ... };
+    code_match = re.search(r'const\s+uint16_t\s+HZK_16_Code\[\]\s*=\s*\{(.*?)\};', content, re.DOTALL)
+    glyph_match = re.search(r'const\s+uint8_t\s+HZK_16\[\]\[(\d+)\]\s*=\s*\{(.*)\n\};', content, re.DOTALL)
+
+    if not code_match or not glyph_match:
+        print("错误: 无法解析 HZK_16_Code / HZK_16 数组结构，请检查文件格式。")
         return False
 
-    header = content[:start_match.end()]
-    body_raw = content[start_match.end():end_idx]
-    footer = content[end_idx:]
+    glyph_size = int(glyph_match.group(1))
+    codes = [int(c, 16) for c in re.findall(r'0x([0-9A-Fa-f]{4,5})', code_match.group(1))]
+    glyphs = re.findall(r'\{([^{}]+)\}', glyph_match.group(2))
 
-    # 4. 核心正则提取 (这是重点！看懂为什么这么写)
-    # 逻辑: { "字", {数据...}, /*"字",索引*/ ... }
-    # 技巧: 使用 [^}]+ 匹配内部数据，防止在中间的 } 处断开
-
-    # Group 1 (Full): 整个条目 (用于重构)
-    # Group 2 (Char): 汉字 (用于Log)
-    # Group 3 (Data): 16进制数据 (用于Hash去重)
-    # Group 4 (Idx) : 旧索引数字 (用于动态更新)
-
-    pattern = r'(\{\s*"([^"]+)"\s*,\s*\{([^}]+)\}\s*,\s*/\*[^"]*"[^,]+,(\d+)\*/\s*.*?\})'
-
-    matches = re.findall(pattern, body_raw, re.DOTALL)
-
-    if not matches:
-        print("警告: 未识别到任何汉字数据。请检查正则逻辑。")
+    if not codes or len(codes) != len(glyphs):
+        print(f"错误: 码点数 {len(codes)} 与字模数 {len(glyphs)} 不一致。")
         return False
 
-    print(f"扫描到 {len(matches)} 个条目，开始处理...")
+    print(f"扫描到 {len(codes)} 个条目，开始处理...")
 
-    # 5. 去重与索引重排
-    unique_entries = []
-    seen_hashes = set()
+    # 4. 去重 (同一码点保留第一次出现的字模) 并按码点升序重排
+    # 固件二分查找码点表，顺序错了会找不到字
+    unique = {}
     duplicates = 0
-    new_index = 0
-
-    for full_str, char, data_str, old_idx in matches:
-        # 清洗数据: 去掉所有空白字符，只留hex内容，计算MD5
-        clean_data = re.sub(r'\s+', '', data_str)
-        # 取前8位Hash足够混淆了，省内存
-        data_hash = hashlib.md5(clean_data.encode('utf-8')).hexdigest()[:8]
-
-        # 唯一键: 汉字+数据Hash (双保险)
-        unique_key = f"{char}_{data_hash}"
-
-        if unique_key not in seen_hashes:
-            seen_hashes.add(unique_key)
-
-            # === 动态更新索引 (这是最骚的操作) ===
-            # 我们不重新拼字符串，而是精准替换掉注释里的旧数字
-            # 旧片段: /*"朱",0*/
-            # 新片段: /*"朱",new_index*/
-
-            # 构造要查找的旧注释特征 (注意转义引号)
-            target_str = f'"{char}",{old_idx}'
-            replace_str = f'"{char}",{new_index}'
-
-            # 只替换第一次出现的索引 (防止误伤数据区)
-            updated_entry = full_str.replace(target_str, replace_str, 1)
-
-            unique_entries.append(updated_entry)
-            new_index += 1
-        else:
+    for code, data_str in zip(codes, glyphs):
+        data = [int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', data_str)]
+        if len(data) != glyph_size:
+            print(f"警告: '{chr(code)}' 字模长度 {len(data)} != {glyph_size}，已跳过")
+            continue
+        if code in unique:
             duplicates += 1
-            print(f"剔除重复: '{char}' (Hash: {data_hash})")
-
-    # 6. 重新组装 (保持C语言美观缩进)
-    # 每个条目缩进4格，条目之间加逗号和换行
-    new_body = "\n    " + ",\n\n    ".join(unique_entries) + ",\n\n"
-
-    final_content = header + new_body + footer
+            data_hash = hashlib.md5(bytes(data)).hexdigest()[:8]
+            print(f"剔除重复: '{chr(code)}' (Hash: {data_hash})")
+            continue
+        unique[code] = data
+
+    entries = sorted(unique.items())
+
+    # 5. 重新生成两张表
+    code_lines = ["const uint16_t HZK_16_Code[] = {"]
+    for code, _ in entries:
+        code_lines.append(f"    0x{code:04X}, // {chr(code)}")
+    code_lines.append("};")
+
+    lines = [f"const uint8_t HZK_16[][{glyph_size}] = {{"]
+    for i, (code, data) in enumerate(entries):
+        lines.append(f'    /* "{chr(code)}" U+{code:04X}, {i} */')
+        lines.append("    {")
+        for k in range(0, len(data), 8):
+            lines.append("        " + ", ".join(f"0x{b:02X}" for b in data[k:k + 8]) + ",")
+        lines.append("    },")
+    lines.append("};")
+
+    # 6. 替换原文件中两张表所在的区域，其余内容 (注释、字体描述符等) 保持不变
+    final_content = (content[:code_match.start()] + "\n".join(code_lines) +
+                     content[code_match.end():glyph_match.start()] + "\n".join(lines) +
+                     content[glyph_match.end():])
 
     # 7. 写入与验证
     with open(output_path, 'w', encoding='utf-8') as f:
@@ -117,7 +99,7 @@ def optimize_hzk_file(input_path, output_path):
 
     print("=" * 50)
     print(f"处理完成！")
-    print(f"条目变化: {len(matches)} -> {len(unique_entries)}")
+    print(f"条目变化: {len(codes)} -> {len(entries)}")
     print(f"删除重复: {duplicates} 个")
     print(f"空间优化: {orig_size}B -> {new_size}B (省 {saved_bytes} B)")
     print(f"输出文件: {output_path}")
@@ -34,7 +34,7 @@ def get_char_bitmap_lsb(char, font):
                 current_byte |= (1 << (x % 8))  # LSB First
 
             if (x + 1) % 8 == 0 or x == FONT_SIZE - 1:
-                row_bytes.APPend(current_byte)
+                row_bytes.append(current_byte)
                 current_byte = 0
 
         bitmap_data.extend(row_bytes)
@@ -53,31 +53,32 @@ def main():
         print(f"加载字体失败: {e}")
         return
 
-    # === 1. 自动去重并保持顺序 ===
-    # 使用 dict.fromkeys 来去重，同时保留原始出现的顺序
-    unique_chars = list(dict.fromkeys(RAW_CHARS))
+    # === 1. 自动去重，并按 Unicode 码点升序排列 ===
+    # 固件在码点表中二分查找 (lcd_font.c: LCD_Find_Code)，表必须严格升序
+    # 码点表是 uint16_t，只收录基本多文种平面 (BMP) 内的字符
+    unique_chars = sorted(set(RAW_CHARS), key=ord)
+    unique_chars = [c for c in unique_chars if ord(c) <= 0xFFFF]
 
-    print(f"// 字体: 宋体 (LSB First), 大小: {FONT_SIZE}x{FONT_SIZE}")
-    print(f"// 共生成 {len(unique_chars)} 个字符 (已自动去重)\n")
-    print("const CN_Font_16_t HZK_16[] = {")
+    glyph_size = (FONT_SIZE + 7) // 8 * FONT_SIZE
 
-    for i, char in enumerate(unique_chars):
-        data = get_char_bitmap_lsb(char, font)
-
-        # 将数据格式化为 hex 字符串
-        hex_str = ", ".join([f"0x{b:02X}" for b in data])
+    print(f"/* 字体: 宋体 (LSB First)，共 {len(unique_chars)} 个字符 */\n")
 
-        # === 2. 严格按你要求的格式输出 ===
-        # 第一行： {"字符",
-        print(f'    {{"{char}",')
+    # === 2. 码点表 ===
+    print("const uint16_t HZK_16_Code[] = {")
+    for char in unique_chars:
+        print(f"    0x{ord(char):04X}, // {char}")
+    print("};\n")
 
-        # 第二行： {数据}, /*"字符",索引*/
-        # 注意：这里的数据花括号后面加了逗号，这是C语言允许的结构体初始化语法
-        print(f'     {{{hex_str}}}, /*"{char}",{i}*/')
+    # === 3. 字模表 (与码点表一一对应) ===
+    print(f"const uint8_t HZK_16[][{glyph_size}] = {{")
+    for i, char in enumerate(unique_chars):
+        data = get_char_bitmap_lsb(char, font)
 
-        # 第三行： /* (16 X 16 , 宋体 )*/},
-        # 注意：这里的 }, 表示数组元素的结束
-        print(f'     /* (16 X 16 , 宋体 )*/}},')
+        print(f'    /* "{char}" U+{ord(char):04X}, {i} */')
+        print("    {")
+        for k in range(0, len(data), 8):
+            print("        " + ", ".join([f"0x{b:02X}" for b in data[k:k + 8]]) + ",")
+        print("    },")
 
     print("};")
 